@@ -131,6 +131,10 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Editor::Core
                     {
                         ed_model.category = QString::fromStdString(ss_node->NodeCategory());
                     }
+                    else if (const auto* ss_decorator = dynamic_cast<const BehaviorTree::Core::BehaviorTreeDecoratorNode*>(node))
+                    {
+                        ed_model.category = QString::fromStdString(ss_decorator->NodeCategory());
+                    }
 
                     delete node;
                 }
@@ -17,7 +17,10 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
 
+#include <SparkyStudios/AI/Behave/BehaviorTree/Blackboard/SharedBlackboard.h>
 #include <SparkyStudios/AI/Behave/BehaviorTree/Core/Factory.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/TimerWheel.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/TreeInstancePool.h>
 
 namespace SparkyStudios::AI::Behave::BehaviorTree
 {
@@ -33,6 +36,29 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
          * @return const Factory&
          */
         [[nodiscard]] virtual const Core::Factory& GetFactory() const = 0;
+
+        /**
+         * @brief Get the game time timer wheel shared by all the behavior trees.
+         * The wheel is advanced once per frame, before the behavior trees are ticked.
+         *
+         * @return Core::TimerWheel&
+         */
+        [[nodiscard]] virtual Core::TimerWheel& GetTimerWheel() = 0;
+
+        /**
+         * @brief Get the pool of behavior tree instances reused by the behavior tree components.
+         *
+         * @return Core::TreeInstancePool&
+         */
+        [[nodiscard]] virtual Core::TreeInstancePool& GetTreeInstancePool() = 0;
+
+        /**
+         * @brief Get the blackboards shared between the behavior trees, per scope.
+         * Their queued writes are committed once per frame, before the behavior trees are ticked.
+         *
+         * @return Blackboard::SharedBlackboardRegistry&
+         */
+        [[nodiscard]] virtual Blackboard::SharedBlackboardRegistry& GetSharedBlackboards() = 0;
     };
 
     class BehaveBehaviorTreeBusTraits : public AZ::EBusTraits
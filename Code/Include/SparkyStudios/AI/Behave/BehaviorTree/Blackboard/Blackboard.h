@@ -9,11 +9,36 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
 {
+    /**
+     * @brief A command run on the blackboard from the thread owning it.
+     */
+    using BlackboardCommand = AZStd::function<void(BT::Blackboard&)>;
+
+    /**
+     * @brief A copy of the values of a blackboard, which can be read from any thread.
+     */
+    using BlackboardSnapshot = AZStd::unordered_map<AZStd::string, BT::Any>;
+
+    /**
+     * @brief A function called when the value of an observed blackboard entry has changed.
+     */
+    using BlackboardObserver = AZStd::function<void(const AZStd::string& key, const BT::Any& value)>;
+
+    /**
+     * @brief The ID of an observer registered on a blackboard.
+     */
+    using BlackboardObserverId = AZ::u64;
+
     /**
      * @brief The behavior tree blackboard.
      * This struct contains all the data used by the behavior tree,
@@ -33,6 +58,14 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
          */
         AZStd::vector<BlackboardProperty*> mProperties;
 
+        /**
+         * @brief Whether the blackboard is only accessed by the behavior tree owning it.
+         *
+         * Single owner blackboards are read and written without locking, and nodes access their entries directly.
+         * Other threads must use EnqueueCommand() to write values, and RequestSnapshot() and GetSnapshot() to read them.
+         */
+        bool mSingleOwner = false;
+
         /**
          * @brief The native blackboard object.
          */
@@ -48,6 +81,70 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
          */
         void Clear();
 
+        /**
+         * @brief Queues a command to run on the blackboard. Can be called from any thread.
+         *
+         * @param command The command, run by the owner of the blackboard on the next ProcessCommands() call.
+         */
+        void EnqueueCommand(BlackboardCommand command);
+
+        /**
+         * @brief Runs the queued commands. Must be called from the thread owning the blackboard.
+         */
+        void ProcessCommands();
+
+        /**
+         * @brief Requests a new snapshot of the blackboard values. Can be called from any thread.
+         */
+        void RequestSnapshot();
+
+        /**
+         * @brief Publishes a new snapshot of the blackboard values, if one was requested.
+         * Must be called from the thread owning the blackboard.
+         */
+        void PublishSnapshot();
+
+        /**
+         * @brief Gets the last published snapshot of the blackboard values. Can be called from any thread.
+         *
+         * @return AZStd::shared_ptr<const BlackboardSnapshot> The snapshot, or nullptr if none was published yet.
+         */
+        [[nodiscard]] AZStd::shared_ptr<const BlackboardSnapshot> GetSnapshot() const;
+
+        /**
+         * @brief Gets the version of a blackboard entry. The version changes each time the entry is written, or when
+         * its value starts or stops being read from a shared blackboard.
+         *
+         * @param key The key of the entry.
+         *
+         * @return AZ::u64 The version of the entry, or 0 if it has no value.
+         */
+        [[nodiscard]] AZ::u64 GetVersion(const AZStd::string& key) const;
+
+        /**
+         * @brief Registers an observer called when the value of an entry has changed.
+         * Must be called from the thread owning the blackboard.
+         *
+         * @param key The key of the entry to observe.
+         * @param observer The function to call, from NotifyObservers().
+         *
+         * @return BlackboardObserverId The ID of the observer, to use with RemoveObserver().
+         */
+        BlackboardObserverId AddObserver(const AZStd::string& key, BlackboardObserver observer);
+
+        /**
+         * @brief Unregisters an observer. Must be called from the thread owning the blackboard.
+         *
+         * @param id The ID of the observer.
+         */
+        void RemoveObserver(BlackboardObserverId id);
+
+        /**
+         * @brief Calls the observers of the entries written since the last call, once per entry.
+         * Must be called from the thread owning the blackboard.
+         */
+        void NotifyObservers();
+
         Blackboard() = default;
         Blackboard(const Blackboard& rhs) = delete;
         Blackboard(Blackboard&& rhs) noexcept;
@@ -56,6 +153,26 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
 
         Blackboard& operator=(Blackboard&& rhs) noexcept;
         Blackboard& operator=(Blackboard&) = delete;
+
+    private:
+        AZStd::mutex _commandsMutex;
+        AZStd::vector<BlackboardCommand> _commands;
+        AZStd::atomic<bool> _hasCommands = false;
+
+        mutable AZStd::mutex _snapshotMutex;
+        AZStd::shared_ptr<const BlackboardSnapshot> _snapshot;
+        AZStd::atomic<bool> _snapshotRequested = false;
+
+        struct ObserverEntry
+        {
+            BlackboardObserverId mId;
+            AZStd::string mKey;
+            BlackboardObserver mObserver;
+            AZ::u64 mVersion;
+        };
+
+        AZStd::vector<ObserverEntry> _observers;
+        BlackboardObserverId _nextObserverId = 1;
     };
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
 
@@ -90,6 +207,37 @@ namespace BT
 
     // ====================================================================================================
 
+    // ====================================================================================================
+    // AZ::Vector3 conversion
+
+    template<>
+    inline std::string toStr<AZ::Vector3>(AZ::Vector3 value)
+    {
+        return (AZStd::to_string(value.GetX()) + "," + AZStd::to_string(value.GetY()) + "," + AZStd::to_string(value.GetZ())).c_str();
+    }
+
+    template<>
+    inline AZ::Vector3 convertFromString(StringView str)
+    {
+        // We expect real numbers separated by semicolons
+        if (const auto parts = splitString(str, ','); parts.size() != 3)
+        {
+            AZ_Warning(
+                "BehaveAI [BehaviorTree]", false, "Invalid AZ::Vector3 value given. Please format the value as \"float,float,float\"");
+            return AZ::Vector3::CreateZero();
+        }
+        else
+        {
+            AZ::Vector3 output(0.0f);
+            output.SetX(convertFromString<float>(parts[0]));
+            output.SetY(convertFromString<float>(parts[1]));
+            output.SetZ(convertFromString<float>(parts[2]));
+            return output;
+        }
+    }
+
+    // ====================================================================================================
+
     // ====================================================================================================
     // AZStd::string conversion
 
@@ -264,4 +412,29 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
     protected:
         void CloneDataFrom(const BlackboardProperty* scriptProperty) override;
     };
+
+    class BlackboardPropertyVector3 final : public BlackboardProperty
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BlackboardPropertyVector3, AZ::SystemAllocator, 0);
+        AZ_RTTI(BlackboardPropertyVector3, "{27C327A0-8764-4B70-81AF-709488030A1E}", BlackboardProperty);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        BlackboardPropertyVector3() = default;
+        explicit BlackboardPropertyVector3(const char* name);
+
+        [[nodiscard]] const void* GetDataAddress() const override;
+        [[nodiscard]] const AZ::Uuid& GetDataTypeUuid() const override;
+
+        BlackboardPropertyVector3* Clone(const char* name = nullptr) const override;
+
+        void AddBlackboardEntry(const Blackboard& blackboard) const override;
+        void SetValueFromString(const char* value) override;
+
+        AZ::Vector3 mValue = AZ::Vector3::CreateZero();
+
+    protected:
+        void CloneDataFrom(const BlackboardProperty* scriptProperty) override;
+    };
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
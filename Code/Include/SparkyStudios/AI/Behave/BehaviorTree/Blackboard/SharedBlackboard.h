@@ -0,0 +1,235 @@
+#pragma once
+
+#include <StdAfx.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
+{
+    /**
+     * @brief The scopes of the blackboards shared between behavior trees.
+     */
+    enum class SharedBlackboardScope : AZ::u8
+    {
+        /**
+         * @brief The blackboard shared by all the behavior trees.
+         */
+        Global,
+
+        /**
+         * @brief A blackboard shared by the behavior trees of a team.
+         */
+        Team,
+
+        /**
+         * @brief A blackboard shared by the behavior trees of a squad.
+         */
+        Squad,
+    };
+
+    /**
+     * @brief A blackboard shared between behavior trees, e.g. to hold the facts known by a squad.
+     *
+     * Writes can be made from any thread. They are queued, and applied once per frame by Commit(), which publishes
+     * a new immutable snapshot of the entries. Readers hold the snapshot they read from, so a replaced snapshot
+     * is freed once its last reader has released it.
+     *
+     * Copying the snapshot pointer takes a lock, so readers are expected to poll GetVersion(), which doesn't lock,
+     * and only get the snapshot again when it changed. SharedBlackboardLookup does this for behavior trees.
+     *
+     * Commit() applies the writes on a copy of all the entries of the current snapshot, so its cost grows with the
+     * number of entries, not with the number of writes. Shared blackboards are meant to hold a few facts.
+     */
+    class SharedBlackboard final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SharedBlackboard, AZ::SystemAllocator, 0);
+
+        /**
+         * @brief An immutable set of entries published by Commit().
+         */
+        class Snapshot final
+        {
+            friend class SharedBlackboard;
+
+        public:
+            AZ_CLASS_ALLOCATOR(Snapshot, AZ::SystemAllocator, 0);
+
+            /**
+             * @brief Finds an entry in the snapshot.
+             *
+             * @param key The key of the entry.
+             *
+             * @return const BT::Blackboard::Entry* The entry, valid while the snapshot is alive, or nullptr if not found.
+             */
+            [[nodiscard]] const BT::Blackboard::Entry* Find(const std::string& key) const;
+
+        private:
+            std::unordered_map<std::string, BT::Blackboard::Entry> _entries;
+        };
+
+        SharedBlackboard() = default;
+        SharedBlackboard(const SharedBlackboard&) = delete;
+        SharedBlackboard& operator=(const SharedBlackboard&) = delete;
+
+        /**
+         * @brief Queues a write of an entry, applied on the next Commit(). Can be called from any thread.
+         *
+         * @param key The key of the entry.
+         * @param value The new value of the entry. Its type can't change once the entry is committed.
+         */
+        void Write(const AZStd::string& key, BT::Any value);
+
+        /**
+         * @brief Queues a write of an entry, applied on the next Commit(). Can be called from any thread.
+         */
+        template<typename T>
+        void Set(const AZStd::string& key, const T& value)
+        {
+            Write(key, BT::Any(value));
+        }
+
+        /**
+         * @brief Gets the last published snapshot. Can be called from any thread, but takes a lock.
+         *
+         * @return AZStd::shared_ptr<const Snapshot> The snapshot, or nullptr if nothing was committed yet.
+         */
+        [[nodiscard]] AZStd::shared_ptr<const Snapshot> GetSnapshot() const;
+
+        /**
+         * @brief Gets the last published snapshot, and its version. Can be called from any thread, but takes a lock.
+         *
+         * @param version The version of the returned snapshot.
+         *
+         * @return AZStd::shared_ptr<const Snapshot> The snapshot, or nullptr if nothing was committed yet.
+         */
+        [[nodiscard]] AZStd::shared_ptr<const Snapshot> GetSnapshot(AZ::u64& version) const;
+
+        /**
+         * @brief Gets the version of the last published snapshot, without locking. It changes on each published snapshot,
+         * and is 0 until the first one.
+         */
+        [[nodiscard]] AZ::u64 GetVersion() const;
+
+        /**
+         * @brief Gets the value of an entry in the last published snapshot. Can be called from any thread.
+         *
+         * @return bool Whether the entry was found. This method may throw if the cast to T failed.
+         */
+        template<typename T>
+        bool Get(const AZStd::string& key, T& value) const
+        {
+            const AZStd::shared_ptr<const Snapshot> snapshot = GetSnapshot();
+            if (snapshot == nullptr)
+                return false;
+
+            const BT::Blackboard::Entry* entry = snapshot->Find(key.c_str());
+            if (entry == nullptr || entry->value.empty())
+                return false;
+
+            value = entry->value.cast<T>();
+            return true;
+        }
+
+        /**
+         * @brief Applies the queued writes, and publishes a new snapshot of the entries if there were any.
+         * Must be called from the game thread, once per frame.
+         *
+         * @return bool Whether a new snapshot was published.
+         */
+        bool Commit();
+
+    private:
+        AZStd::mutex _writesMutex;
+        AZStd::vector<AZStd::pair<std::string, BT::Any>> _writes;
+        AZStd::atomic<bool> _hasWrites = false;
+
+        // Held while copying or replacing the snapshot pointer, and while changing its version.
+        mutable AZStd::mutex _snapshotMutex;
+        AZStd::shared_ptr<const Snapshot> _snapshot;
+        AZStd::atomic<AZ::u64> _version = 0;
+    };
+
+    /**
+     * @brief Finds the shared entries of a behavior tree blackboard, in a list of shared blackboards.
+     *
+     * The snapshots of the shared blackboards are held from a call to Refresh() to the next one, so the entries
+     * found in between stay valid even if the shared blackboards are committed meanwhile. Refresh() is meant to be
+     * called from the thread owning the behavior tree blackboard, before each tick. It only locks the shared blackboards
+     * which published a new snapshot since the previous call.
+     */
+    class SharedBlackboardLookup final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SharedBlackboardLookup, AZ::SystemAllocator, 0);
+
+        /**
+         * @param blackboards The shared blackboards, from the one looked up first to the one looked up last.
+         */
+        explicit SharedBlackboardLookup(AZStd::vector<AZStd::shared_ptr<SharedBlackboard>> blackboards);
+
+        /**
+         * @brief Holds the last published snapshots of the shared blackboards, releasing the previous ones.
+         */
+        void Refresh();
+
+        /**
+         * @brief Finds the first entry with a value for the given key, in the held snapshots.
+         *
+         * @param key The key of the entry.
+         *
+         * @return const BT::Blackboard::Entry* The entry, valid until the next call to Refresh(), or nullptr if not found.
+         */
+        [[nodiscard]] const BT::Blackboard::Entry* Find(const std::string& key) const;
+
+    private:
+        AZStd::vector<AZStd::shared_ptr<SharedBlackboard>> _blackboards;
+        AZStd::vector<AZStd::shared_ptr<const SharedBlackboard::Snapshot>> _snapshots;
+        AZStd::vector<AZ::u64> _versions;
+    };
+
+    /**
+     * @brief The blackboards shared between behavior trees, per scope.
+     *
+     * Behavior tree components link their blackboard to the global blackboard, and to the blackboards of their team
+     * and squad. The keys which are not set in their own blackboard are read from the squad, then the team, and then
+     * the global blackboard. This way, gameplay code writes a shared fact once, instead of in every agent.
+     */
+    class SharedBlackboardRegistry final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SharedBlackboardRegistry, AZ::SystemAllocator, 0);
+
+        /**
+         * @brief Gets the shared blackboard of a scope, creating it if needed. Can be called from any thread.
+         *
+         * @param scope The scope of the blackboard.
+         * @param id The ID of the team or squad. Ignored for the global scope.
+         *
+         * @return AZStd::shared_ptr<SharedBlackboard> The shared blackboard.
+         */
+        AZStd::shared_ptr<SharedBlackboard> Get(SharedBlackboardScope scope, AZ::u32 id = 0);
+
+        /**
+         * @brief Commits the queued writes of all the shared blackboards. Must be called from the game thread, once per frame.
+         */
+        void Commit();
+
+        /**
+         * @brief Releases all the shared blackboards. The ones still linked to behavior trees are kept alive by them.
+         */
+        void Clear();
+
+    private:
+        static AZ::u64 GetKey(SharedBlackboardScope scope, AZ::u32 id);
+
+        AZStd::mutex _mutex;
+        AZStd::unordered_map<AZ::u64, AZStd::shared_ptr<SharedBlackboard>> _blackboards;
+    };
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
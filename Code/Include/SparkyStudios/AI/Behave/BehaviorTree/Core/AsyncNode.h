@@ -0,0 +1,68 @@
+#pragma once
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h>
+
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    /**
+     * @brief The base class for behavior tree nodes running their work in the job system.
+     *
+     * The work is created when the node starts and submitted as a job, and the node stays RUNNING until the job
+     * completes. The result is published back to the behavior tree on the next tick following the completion of the
+     * job, from the thread ticking the tree. Halting the node only requests the cancellation of the job, the work
+     * must check the flag it is given regularly and return early.
+     */
+    class AsyncNode : public Node
+    {
+    public:
+        AZ_RTTI(AsyncNode, "{3D5E7F90-1A2B-4C3D-8E9F-A0B1C2D3E4F5}", Node);
+
+        /**
+         * @brief The work of a node, run in a job. It receives the cancellation flag of the job, and returns
+         * SUCCESS or FAILURE.
+         *
+         * The job may outlive the node, so the work must own all the data it uses, and never access the node,
+         * the blackboard or the ports.
+         */
+        using Work = AZStd::function<BehaviorTreeNodeStatus(const AZStd::atomic<bool>& cancelRequested)>;
+
+        AsyncNode(const std::string& name, const BehaviorTreeNodeConfiguration& config);
+
+        ~AsyncNode() override;
+
+    protected:
+        /**
+         * @brief Run from the tree thread when the node starts, to read the inputs of the node and create the work.
+         *
+         * @return Work The work to run in a job, or an empty function to fail the node without submitting a job.
+         */
+        virtual Work CreateWork() = 0;
+
+        /**
+         * @brief Run from the tree thread once the job has completed, to publish the results of the node.
+         *
+         * @param status The status returned by the work.
+         *
+         * @return BehaviorTreeNodeStatus The status of the node.
+         */
+        virtual BehaviorTreeNodeStatus Complete(BehaviorTreeNodeStatus status);
+
+    private:
+        struct JobState;
+
+        void Start() final;
+
+        BehaviorTreeNodeStatus Tick() final;
+
+        void Finish() final;
+
+        void Cancel();
+
+        // Shared with the job, which keeps it alive until the work has returned.
+        AZStd::shared_ptr<JobState> _job;
+    };
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
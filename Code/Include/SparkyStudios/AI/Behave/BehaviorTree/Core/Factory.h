@@ -6,6 +6,7 @@
 
 #include <SparkyStudios/AI/Behave/BehaviorTree/Blackboard/Blackboard.h>
 #include <SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/NodeArena.h>
 #include <SparkyStudios/AI/Behave/BehaviorTree/Core/Registry.h>
 
 namespace SparkyStudios::AI::Behave::BehaviorTree::Core
@@ -61,9 +62,9 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
          * @param instanceName The instance name of the node.
          * @param config The configuration for the node.
          *
-         * @return AZStd::unique_ptr<Node>
+         * @return AZStd::unique_ptr<BT::TreeNode>
          */
-        [[nodiscard]] AZStd::unique_ptr<Node> CreateNode(
+        [[nodiscard]] AZStd::unique_ptr<BT::TreeNode> CreateNode(
             const AZStd::string& name, const AZStd::string& instanceName, const BehaviorTreeNodeConfiguration& config = {}) const;
 
         /**
@@ -76,6 +77,47 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
          */
         [[nodiscard]] BT::Tree CreateTreeFromText(const AZStd::string& text, const BehaviorTree::Blackboard::Blackboard& blackboard = {}) const;
 
+        /**
+         * @brief Create a behavior tree from the given XML text, placing its nodes in the given arena.
+         * The arena is reset and a block large enough for all the registered nodes of the tree is reserved.
+         *
+         * @param text The XML text to parse into a behavior tree.
+         * @param blackboard The blackboard instance which this behavior tree will use.
+         * @param arena The arena in which place the nodes of the tree.
+         *
+         * @return BT::Tree
+         */
+        [[nodiscard]] BT::Tree CreateTreeFromText(
+            const AZStd::string& text, const BehaviorTree::Blackboard::Blackboard& blackboard, NodeArena& arena) const;
+
+        /**
+         * @brief Create a behavior tree from the given XML text, placing its nodes in the given arena.
+         * The arena is reset and a block of the given size is reserved.
+         *
+         * @param text The XML text to parse into a behavior tree.
+         * @param blackboard The blackboard instance which this behavior tree will use.
+         * @param arena The arena in which place the nodes of the tree.
+         * @param footprint The footprint of the tree, as returned by GetTreeFootprint().
+         *
+         * @return BT::Tree
+         */
+        [[nodiscard]] BT::Tree CreateTreeFromText(
+            const AZStd::string& text,
+            const BehaviorTree::Blackboard::Blackboard& blackboard,
+            NodeArena& arena,
+            AZStd::size_t footprint) const;
+
+        /**
+         * @brief Computes the memory footprint in a node arena of the registered nodes of a behavior tree.
+         * Subtrees are counted once per reference. The text is parsed, so the result should be kept for the next trees
+         * of the same asset.
+         *
+         * @param text The XML text of the behavior tree.
+         *
+         * @return AZStd::size_t The size to reserve in the arena, in bytes.
+         */
+        [[nodiscard]] AZStd::size_t GetTreeFootprint(const AZStd::string& text) const;
+
     private:
         AZStd::shared_ptr<Registry> _registry;
     };
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h>
+
+#include <AzCore/std/containers/vector.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    /**
+     * @brief An executor running a behavior tree from a flat, pre-order array of its nodes.
+     *
+     * The builtin control and decorator nodes of BehaviorTree.CPP (Sequence, SequenceStar, Fallback, ReactiveSequence,
+     * ReactiveFallback, Inverter, ForceSuccess, ForceFailure, Repeat, RetryUntilSuccessful and SubTree) are interpreted
+     * from their opcode, with their state stored contiguously. Each node stores the index following its subtree, so the
+     * children of a node are iterated without reading the node objects. Only the other nodes, mainly the actions and the
+     * custom decorators, are ticked through their BT::TreeNode, and their own children are not flattened.
+     *
+     * The status of the interpreted nodes is not reported to their BT::TreeNode, so loggers only see the ticked nodes.
+     */
+    class FlatTree final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FlatTree, AZ::SystemAllocator, 0);
+
+        /**
+         * @brief Compiles the tree starting at the given root node.
+         * The nodes must outlive the compiled tree.
+         *
+         * @param root The root node of the tree.
+         *
+         * @return bool Whether the tree was compiled.
+         */
+        bool Compile(BT::TreeNode* root);
+
+        /**
+         * @brief Clears the compiled tree.
+         */
+        void Clear();
+
+        /**
+         * @brief Checks whether a tree is compiled.
+         */
+        [[nodiscard]] bool IsCompiled() const;
+
+        /**
+         * @brief Ticks the compiled tree once. The tree starts again on the next tick once it has completed.
+         *
+         * @return BehaviorTreeNodeStatus The status of the root node.
+         */
+        BehaviorTreeNodeStatus Tick();
+
+        /**
+         * @brief Halts all the running nodes of the compiled tree.
+         */
+        void Halt();
+
+        /**
+         * @brief Gets the number of nodes of the compiled tree.
+         */
+        [[nodiscard]] AZ::u32 GetNodesCount() const;
+
+    private:
+        enum class Opcode : AZ::u8
+        {
+            Leaf,
+            Sequence,
+            SequenceStar,
+            Fallback,
+            ReactiveSequence,
+            ReactiveFallback,
+            Inverter,
+            ForceSuccess,
+            ForceFailure,
+            Repeat,
+            Retry,
+            Passthrough,
+        };
+
+        struct FlatNode
+        {
+            BT::TreeNode* mNode = nullptr;
+
+            /**
+             * @brief The index following the subtree of this node, which is the index of its next sibling.
+             */
+            AZ::u32 mEnd = 0;
+
+            /**
+             * @brief The number of cycles of Repeat nodes, or attempts of Retry nodes. -1 is infinite.
+             */
+            AZ::s32 mParameter = 0;
+
+            Opcode mOpcode = Opcode::Leaf;
+        };
+
+        struct FlatNodeState
+        {
+            /**
+             * @brief The index of the current child of sequences and fallbacks, or the current cycle of Repeat and Retry nodes.
+             */
+            AZ::u32 mCursor = 0;
+
+            BehaviorTreeNodeStatus mStatus = BehaviorTreeNodeStatus::IDLE;
+        };
+
+        void Append(BT::TreeNode* node);
+
+        BehaviorTreeNodeStatus Execute(AZ::u32 index);
+        BehaviorTreeNodeStatus Run(AZ::u32 index);
+
+        void HaltNode(AZ::u32 index);
+        void HaltChildren(AZ::u32 index, AZ::u32 first);
+        void ResetCursor(AZ::u32 index);
+
+        AZStd::vector<FlatNode> _nodes;
+        AZStd::vector<FlatNodeState> _states;
+    };
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
@@ -3,8 +3,12 @@
 #include <StdAfx.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/NodeArena.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/TimerWheel.h>
+
 namespace SparkyStudios::AI::Behave::BehaviorTree::Core
 {
     using BehaviorTreeNodeConfiguration = BT::NodeConfiguration;
@@ -16,56 +20,183 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
     using Result = BT::Result;
 
     /**
-     * @brief The base class for all behavior tree nodes.
+     * @brief The values of the input ports of a node instance which are not read from the blackboard.
+     *
+     * Literal port values are parsed once when the node is instantiated, with the converter of the port type,
+     * instead of on each read. Ports mapped to a blackboard entry are not cached, and are always read live.
      */
-    class Node : public BT::StatefulActionNode
+    class ConstantPortValues final
     {
-        friend class Factory;
-
     public:
-        AZ_CLASS_ALLOCATOR(Node, AZ::SystemAllocator, 0);
-        AZ_RTTI(Node, "{BDC7EF90-5955-4EE7-9118-46F0D069194F}");
+        AZ_CLASS_ALLOCATOR(ConstantPortValues, AZ::SystemAllocator, 0);
 
-        Node(const std::string& name, const BehaviorTreeNodeConfiguration& config);
+        /**
+         * @brief Parses the literal values of the given input ports.
+         *
+         * @param ports The ports provided by the node.
+         * @param config The configuration of the node instance.
+         */
+        void Build(const BehaviorTreePortsList& ports, const BehaviorTreeNodeConfiguration& config);
 
-        ~Node() override = default;
+        /**
+         * @brief Finds the parsed value of an input port.
+         *
+         * @param id The input port id.
+         *
+         * @return const BT::Any* The parsed value, or nullptr if the port is not a constant.
+         */
+        [[nodiscard]] const BT::Any* Find(const AZStd::string& id) const;
+
+    private:
+        struct ConstantPort
+        {
+            std::string mName;
+            BT::Any mValue;
+        };
+
+        // Nodes have a few constant ports, comparing their names in a linear search is cheaper than hashing the name.
+        AZStd::vector<ConstantPort> _ports;
+    };
+
+    /**
+     * @brief The blackboard entries mapped to the ports of a node instance, when its blackboard has a single owner.
+     *
+     * Entries are resolved on their first access, and then read and written directly, without building
+     * the remapped key nor locking the blackboard. Entries of shared blackboards are never cached.
+     */
+    class BlackboardPortEntries final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BlackboardPortEntries, AZ::SystemAllocator, 0);
 
         /**
-         * @brief The name of the node in the behavior tree file.
+         * @brief Finds the blackboard entry mapped to an input port.
+         *
+         * @param id The input port id.
+         * @param config The configuration of the node instance.
+         *
+         * @return BT::Blackboard::Entry* The blackboard entry, or nullptr if the port is not mapped to an existing entry
+         * of a single owner blackboard.
          */
-        static constexpr const char* NODE_NAME = "Node";
+        BT::Blackboard::Entry* FindInput(const AZStd::string& id, const BehaviorTreeNodeConfiguration& config) const;
 
         /**
-         * @brief Returns the list of ports provided by this node.
-         * This method must be implemented in the derived class.
+         * @brief Finds the blackboard entry mapped to an output port.
          *
-         * @return SSBehaviorTreePortsList
+         * @param id The output port id.
+         * @param config The configuration of the node instance.
+         *
+         * @return BT::Blackboard::Entry* The blackboard entry, or nullptr if the port is not mapped to an existing entry
+         * of a single owner blackboard.
          */
-        static BehaviorTreePortsList providedPorts();
+        BT::Blackboard::Entry* FindOutput(const AZStd::string& id, const BehaviorTreeNodeConfiguration& config) const;
 
         /**
-         * @brief Gets the category in which this node will be represented in the editor.
+         * @brief Reads the value of a blackboard entry, the same way BT::TreeNode::getInput() does.
          *
-         * @return const std::string A string value representing the category of this node.
+         * @tparam T The type of the value to return.
+         * @param entry The blackboard entry.
+         *
+         * @return Optional<T>
          */
-        virtual std::string NodeCategory() const;
+        template<typename T>
+        static Optional<T> Read(const BT::Any& entry)
+        {
+            if (entry.empty())
+                return nonstd::make_unexpected("The blackboard entry is empty.");
+
+            try
+            {
+                if constexpr (!AZStd::is_same_v<T, std::string>)
+                {
+                    if (entry.type() == typeid(std::string))
+                        return BT::convertFromString<T>(entry.cast<std::string>());
+                }
+
+                return entry.cast<T>();
+            }
+            catch (const std::exception& e)
+            {
+                return nonstd::make_unexpected(e.what());
+            }
+        }
 
-    protected:
         /**
-         * @brief Run before the first tick, to initialize the node.
+         * @brief Writes a value in a blackboard entry. Only values of the same type than the current one
+         * are written, since BT::Blackboard::set() must check the others.
+         *
+         * @tparam T The type of the value.
+         * @param entry The blackboard entry.
+         * @param value The value to write.
+         *
+         * @return bool Whether the value was written.
          */
-        virtual void Start();
+        template<typename T>
+        static bool Write(BT::Blackboard::Entry& entry, const T& value)
+        {
+            if (entry.value.empty() || entry.value.type() != typeid(T))
+                return false;
+
+            entry.value = BT::Any(value);
+            entry.sequence_id++;
+            return true;
+        }
+
+    private:
+        struct PortEntry
+        {
+            std::string mName;
+            BT::Blackboard::Entry* mEntry;
+        };
+
+        static BT::Blackboard::Entry* Find(
+            const AZStd::string& id,
+            const BehaviorTreeNodeConfiguration& config,
+            const BT::PortsRemapping& remapping,
+            AZStd::vector<PortEntry>& entries);
+
+        mutable AZStd::vector<PortEntry> _inputs;
+        mutable AZStd::vector<PortEntry> _outputs;
+    };
+
+    /**
+     * @brief Implemented by the nodes keeping a state across halts, like a pending timer, so the pooled trees can
+     * be given to a new owner in the state of a new tree.
+     */
+    class ResettableNode
+    {
+    public:
+        virtual ~ResettableNode() = default;
 
         /**
-         * @brief Run on each node tick.
+         * @brief Resets the node to the state it had when it was instantiated. Only called on halted nodes.
          */
-        virtual BehaviorTreeNodeStatus Tick();
+        virtual void ResetNode() = 0;
+    };
 
+    /**
+     * @brief Gives the base classes of the behavior tree nodes a typed access to their ports. Inputs are read from
+     * the parsed constant values, then from the cached blackboard entries, and outputs are written to the cached
+     * blackboard entries. BT::TreeNode::getInput() and setOutput() are used for the other ports.
+     *
+     * @tparam TNode The node class, derived from BT::TreeNode and from this class.
+     */
+    template<typename TNode>
+    class NodePorts
+    {
+    public:
         /**
-         * @brief Run just before to leave the node after the last tick, to deinitialize the node.
+         * @brief Parses and caches the literal values of the input ports of this node.
+         * Called by the registry when the node is instantiated.
+         *
+         * @param ports The ports provided by the node.
          */
-        virtual void Finish();
+        void CacheConstantPorts(const BehaviorTreePortsList& ports)
+        {
+            _constantPorts.Build(ports, AsTreeNode().config());
+        }
 
+    protected:
         /**
          * @brief Returns the current value of an input port with the given id.
          *
@@ -77,13 +208,24 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
         template<typename T>
         Optional<T> GetInputValue(const AZStd::string& id) const
         {
-            Optional<T> value = getInput<T>(id.c_str());
+            const BT::TreeNode& node = AsTreeNode();
+
+            if (const BT::Any* constant = _constantPorts.Find(id); constant != nullptr && constant->type() == typeid(T))
+                return constant->cast<T>();
+
+            if (const BT::Blackboard::Entry* entry = _blackboardPorts.FindInput(id, node.config()); entry != nullptr)
+            {
+                if (Optional<T> value = BlackboardPortEntries::Read<T>(entry->value))
+                    return value;
+            }
+
+            Optional<T> value = node.getInput<T>(id.c_str());
 
             if (!value)
             {
                 AZ_Error(
-                    "BehaveAI [BehaviorTree]", false, "[%s:%s] Missing required input {%s}: %s", registrationName().c_str(), name().c_str(),
-                    id.c_str(), value.error().c_str());
+                    "BehaveAI [BehaviorTree]", false, "[%s:%s] Missing required input {%s}: %s", node.registrationName().c_str(),
+                    node.name().c_str(), id.c_str(), value.error().c_str());
             }
 
             return value;
@@ -101,9 +243,83 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
         template<typename T>
         Result SetOutputValue(const AZStd::string& id, const T& value)
         {
-            return setOutput<T>(id.c_str(), value);
+            BT::TreeNode& node = AsTreeNode();
+
+            if (BT::Blackboard::Entry* entry = _blackboardPorts.FindOutput(id, node.config());
+                entry != nullptr && BlackboardPortEntries::Write(*entry, value))
+                return {};
+
+            return node.setOutput<T>(id.c_str(), value);
+        }
+
+    private:
+        const BT::TreeNode& AsTreeNode() const
+        {
+            return static_cast<const TNode&>(*this);
         }
 
+        BT::TreeNode& AsTreeNode()
+        {
+            return static_cast<TNode&>(*this);
+        }
+
+        ConstantPortValues _constantPorts;
+        BlackboardPortEntries _blackboardPorts;
+    };
+
+    /**
+     * @brief The base class for all behavior tree nodes.
+     */
+    class Node
+        : public BT::StatefulActionNode
+        , public NodeArenaAllocated
+        , public NodePorts<Node>
+    {
+        friend class Factory;
+
+    public:
+        AZ_RTTI(Node, "{BDC7EF90-5955-4EE7-9118-46F0D069194F}");
+
+        Node(const std::string& name, const BehaviorTreeNodeConfiguration& config);
+
+        ~Node() override = default;
+
+        /**
+         * @brief The name of the node in the behavior tree file.
+         */
+        static constexpr const char* NODE_NAME = "Node";
+
+        /**
+         * @brief Returns the list of ports provided by this node.
+         * This method must be implemented in the derived class.
+         *
+         * @return SSBehaviorTreePortsList
+         */
+        static BehaviorTreePortsList providedPorts();
+
+        /**
+         * @brief Gets the category in which this node will be represented in the editor.
+         *
+         * @return const std::string A string value representing the category of this node.
+         */
+        virtual std::string NodeCategory() const;
+
+    protected:
+        /**
+         * @brief Run before the first tick, to initialize the node.
+         */
+        virtual void Start();
+
+        /**
+         * @brief Run on each node tick.
+         */
+        virtual BehaviorTreeNodeStatus Tick();
+
+        /**
+         * @brief Run just before to leave the node after the last tick, to deinitialize the node.
+         */
+        virtual void Finish();
+
         /**
          * @brief Gets the ID of the entity to which this node's behavior tree
          * is attached to.
@@ -151,14 +367,33 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
     /**
      * @brief Special node that returns success or failure based on the condition.
      */
-    class BehaviorTreeConditionNode : public BT::ConditionNode
+    class BehaviorTreeConditionNode
+        : public BT::ConditionNode
+        , public NodeArenaAllocated
+        , public NodePorts<BehaviorTreeConditionNode>
     {
     public:
-        AZ_CLASS_ALLOCATOR(BehaviorTreeConditionNode, AZ::SystemAllocator, 0);
         AZ_RTTI(BehaviorTreeConditionNode, "{B951E9D3-6908-4693-8FBF-9B876F74FC89}");
 
         BehaviorTreeConditionNode(const std::string& name, const BehaviorTreeNodeConfiguration& config);
 
+        ~BehaviorTreeConditionNode() override = default;
+
+        /**
+         * @brief Returns the list of ports provided by this node.
+         * This method must be implemented in the derived class.
+         *
+         * @return BehaviorTreePortsList
+         */
+        static BehaviorTreePortsList providedPorts();
+
+        /**
+         * @brief Gets the category in which this node will be represented in the editor.
+         *
+         * @return const std::string A string value representing the category of this node.
+         */
+        virtual std::string NodeCategory() const;
+
     protected:
         /**
          * @brief The condition to execute.
@@ -167,11 +402,88 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
          */
         virtual bool Condition() = 0;
 
+        /**
+         * @brief Gets the ID of the entity to which this node's behavior tree is attached to.
+         *
+         * @return AZ::EntityId
+         */
+        AZ::EntityId GetEntityId() const;
+
+        /**
+         * @brief Declares a blackboard entry read by the condition.
+         *
+         * A condition declaring its dependencies must not depend on anything else. Its result is kept, and Condition()
+         * only runs again once one of the entries has been written, so reactive nodes ticking it on every frame only
+         * pay for a version check. Conditions without dependencies run on every tick.
+         *
+         * @param key The blackboard key, or the name of an input port remapped to a blackboard entry.
+         */
+        void AddBlackboardDependency(const AZStd::string& key);
+
     private:
+        struct BlackboardDependency
+        {
+            std::string mKey;
+            BT::Blackboard::Entry* mEntry;
+            AZ::u64 mSequenceId;
+        };
+
+        bool HaveDependenciesChanged();
+
 #pragma region BT::ConditionNode
 
         BehaviorTreeNodeStatus tick() final;
 
 #pragma endregion
+
+        AZStd::vector<BlackboardDependency> _dependencies;
+        bool _hasResult = false;
+        bool _result = false;
+    };
+
+    /**
+     * @brief The base class for decorator nodes, which control the execution of a single child.
+     */
+    class BehaviorTreeDecoratorNode
+        : public BT::DecoratorNode
+        , public NodeArenaAllocated
+        , public NodePorts<BehaviorTreeDecoratorNode>
+    {
+    public:
+        AZ_RTTI(BehaviorTreeDecoratorNode, "{6F0C2B8E-5A1D-4E7B-9C3F-2D8A4B6E1F07}");
+
+        BehaviorTreeDecoratorNode(const std::string& name, const BehaviorTreeNodeConfiguration& config);
+
+        ~BehaviorTreeDecoratorNode() override = default;
+
+        /**
+         * @brief Returns the list of ports provided by this node.
+         * This method must be implemented in the derived class.
+         *
+         * @return BehaviorTreePortsList
+         */
+        static BehaviorTreePortsList providedPorts();
+
+        /**
+         * @brief Gets the category in which this node will be represented in the editor.
+         *
+         * @return const std::string A string value representing the category of this node.
+         */
+        virtual std::string NodeCategory() const;
+
+    protected:
+        /**
+         * @brief Gets the game time timer wheel shared by all the behavior trees.
+         *
+         * @return TimerWheel* The timer wheel, or nullptr when the behavior tree system is not available.
+         */
+        static TimerWheel* GetTimerWheel();
+
+        /**
+         * @brief Cancels a timer of the shared timer wheel, and resets the given ID.
+         *
+         * @param id The ID of the timer to cancel.
+         */
+        static void CancelTimer(TimerWheel::TimerId& id);
     };
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
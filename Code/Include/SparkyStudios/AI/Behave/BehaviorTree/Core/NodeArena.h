@@ -0,0 +1,139 @@
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    /**
+     * @brief A memory arena holding the nodes of a behavior tree instance in a single block.
+     *
+     * The block is reserved before the tree is created, and the nodes created while a Scope of the arena
+     * is active on the thread are placed in it. Destroying a node doesn't free its memory, the whole block
+     * is freed at once when the arena has been reset and its last node has been destroyed. Nodes which don't
+     * fit in the block, or created without an active arena, are allocated from the system allocator.
+     */
+    class NodeArena final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(NodeArena, AZ::SystemAllocator, 0);
+
+        /**
+         * @brief Makes an arena the one used by the nodes created on the current thread, until the scope is destroyed.
+         */
+        class Scope final
+        {
+        public:
+            explicit Scope(NodeArena& arena);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            NodeArena* _previous;
+        };
+
+        /**
+         * @brief The alignment of the nodes placed in the arena.
+         */
+        static constexpr AZStd::size_t Alignment = 16;
+
+        NodeArena() = default;
+        ~NodeArena();
+
+        NodeArena(const NodeArena&) = delete;
+        NodeArena& operator=(const NodeArena&) = delete;
+
+        /**
+         * @brief Gets the size taken by a node of the given size in the arena.
+         */
+        static constexpr AZStd::size_t GetNodeFootprint(const AZStd::size_t size)
+        {
+            return kHeaderSize + ((size + Alignment - 1) & ~(Alignment - 1));
+        }
+
+        /**
+         * @brief Releases the current block, and reserves a new one.
+         * The nodes placed in the previous block stay valid until they are destroyed.
+         *
+         * @param size The size of the block in bytes, usually the sum of the footprints of the nodes of the tree.
+         */
+        void Reserve(AZStd::size_t size);
+
+        /**
+         * @brief Releases the current block. It is freed once its last node has been destroyed.
+         */
+        void Reset();
+
+        /**
+         * @brief Gets the size of the current block, in bytes.
+         */
+        [[nodiscard]] AZStd::size_t GetCapacity() const;
+
+        /**
+         * @brief Gets the size used in the current block, in bytes.
+         */
+        [[nodiscard]] AZStd::size_t GetUsedSize() const;
+
+        /**
+         * @brief Allocates the memory of a node, in the active arena of the thread if possible.
+         * Used by the operator new of the behavior tree nodes.
+         */
+        static void* AllocateNode(AZStd::size_t size);
+
+        /**
+         * @brief Frees the memory of a node allocated with AllocateNode().
+         * Used by the operator delete of the behavior tree nodes.
+         */
+        static void DeallocateNode(void* pointer);
+
+    private:
+        struct Block
+        {
+            char* mMemory = nullptr;
+            AZStd::size_t mCapacity = 0;
+            AZStd::size_t mUsed = 0;
+            // One reference per node placed in the block, plus one held by the arena until it is reset.
+            AZStd::atomic<AZ::u32> mReferences = 1;
+        };
+
+        // Stored before each node, to find the block it was placed in when it is destroyed.
+        struct NodeHeader
+        {
+            Block* mBlock;
+        };
+
+        static constexpr AZStd::size_t kHeaderSize = (sizeof(NodeHeader) + Alignment - 1) & ~(Alignment - 1);
+
+        static void Release(Block* block);
+
+        Block* _block = nullptr;
+    };
+
+    /**
+     * @brief The base class of the behavior tree nodes placed in node arenas.
+     */
+    class NodeArenaAllocated
+    {
+    public:
+        static void* operator new(AZStd::size_t size)
+        {
+            return NodeArena::AllocateNode(size);
+        }
+
+        static void operator delete(void* pointer)
+        {
+            NodeArena::DeallocateNode(pointer);
+        }
+
+        static void* operator new(AZStd::size_t, void* place)
+        {
+            return place;
+        }
+
+        static void operator delete(void*, void*)
+        {
+        }
+    };
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
@@ -15,7 +15,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
     /**
      * @brief The function used to build behavior tree nodes.
      */
-    using NodeBuilder = AZStd::function<AZStd::unique_ptr<Node>(const std::string&, const BehaviorTreeNodeConfiguration&)>;
+    using NodeBuilder = AZStd::function<AZStd::unique_ptr<BT::TreeNode>(const std::string&, const BehaviorTreeNodeConfiguration&)>;
 
     /**
      * @brief Register the blackboard properties and nodes used in behavior tree files.
@@ -105,23 +105,30 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
         template<typename T>
         void DelayNodeRegistration(const AZStd::string& name)
         {
-            static_assert(AZStd::is_base_of_v<Node, T>, "T must be derived from Node");
+            static_assert(
+                AZStd::is_base_of_v<Node, T> || AZStd::is_base_of_v<BehaviorTreeDecoratorNode, T> ||
+                    AZStd::is_base_of_v<BehaviorTreeConditionNode, T>,
+                "T must be derived from Node, BehaviorTreeDecoratorNode or BehaviorTreeConditionNode");
             static_assert(!AZStd::is_abstract_v<T>, "T must not be abstract");
             static_assert(
                 AZStd::is_same_v<decltype(T::Reflect), void(AZ::ReflectContext*)>,
                 "T must implement the 'static void Reflect(AZ::ReflectContext*)' method.");
 
-            NodeBuilder builder = [](const std::string& nodeName, const BehaviorTreeNodeConfiguration& config)
+            BT::TreeNodeManifest manifest{ BT::getType<T>(), name.c_str(), BT::getProvidedPorts<T>() };
+
+            NodeBuilder builder = [ports = manifest.ports](const std::string& nodeName, const BehaviorTreeNodeConfiguration& config)
             {
-                return AZStd::make_unique<T>(nodeName, config);
-            };
+                auto node = AZStd::make_unique<T>(nodeName, config);
+                node->CacheConstantPorts(ports);
 
-            BT::TreeNodeManifest manifest{ BT::getType<T>(), name.c_str(), BT::getProvidedPorts<T>() };
+                return node;
+            };
 
             _delayedRegisterers.insert(AZStd::make_pair(name, AZStd::make_pair(manifest, builder)));
             _delayedReflectors.insert(AZStd::make_pair(name, T::Reflect));
 
             _registeredNodeUuid.insert(AZStd::make_pair(name, azrtti_typeid<T>()));
+            _registeredNodeSize.insert(AZStd::make_pair(name, sizeof(T)));
         }
 
         /**
@@ -133,6 +140,15 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
          */
         [[nodiscard]] const AZ::Uuid& GetNodeUuid(const AZStd::string& type) const;
 
+        /**
+         * @brief Get the size in memory of an instance of the specified node.
+         *
+         * @param type The type of the node to get the size.
+         *
+         * @return AZStd::size_t The size of the node, or 0 if the node is not registered.
+         */
+        [[nodiscard]] AZStd::size_t GetNodeSize(const AZStd::string& type) const;
+
         /**
          * @brief Perform the node registration process.
          *
@@ -182,6 +198,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
 
         AZStd::unordered_map<AZStd::string, NodeBuilder> _registeredNodeBuilders;
         AZStd::unordered_map<AZStd::string, AZ::Uuid> _registeredNodeUuid;
+        AZStd::unordered_map<AZStd::string, AZStd::size_t> _registeredNodeSize;
 
         AZStd::unordered_map<AZStd::string, AZStd::pair<BT::TreeNodeManifest, NodeBuilder>> _delayedRegisterers;
         AZStd::unordered_map<AZStd::string, AZ::ReflectionFunction> _delayedReflectors;
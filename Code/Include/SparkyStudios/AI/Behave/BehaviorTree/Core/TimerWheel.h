@@ -0,0 +1,110 @@
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    /**
+     * @brief A hierarchical timer wheel driven by game time.
+     *
+     * Timers are stored in the slots of several wheels of increasing span, and move down to the finer wheel when
+     * the coarser one turns. Scheduling and cancelling a timer is O(1), and advancing the time only visits the slots
+     * which expire. Callbacks are run from Advance(), on the thread advancing the wheel.
+     *
+     * The wheel is not thread safe, it is meant to be used from the game thread only.
+     */
+    class TimerWheel final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TimerWheel, AZ::SystemAllocator, 0);
+
+        using TimerId = AZ::u64;
+        using Callback = AZStd::function<void()>;
+
+        /**
+         * @brief The ID of no timer. Cancelling it does nothing.
+         */
+        static constexpr TimerId InvalidTimerId = 0;
+
+        /**
+         * @brief The resolution of the wheel, in seconds. Timers expire on the first tick at or after their deadline.
+         */
+        static constexpr double TickDuration = 0.001;
+
+        TimerWheel();
+
+        /**
+         * @brief Schedules a callback to run once the given game time has elapsed.
+         *
+         * @param delay The delay in seconds. Timers with no delay expire on the next call to Advance().
+         * @param callback The callback to run. It may schedule or cancel timers.
+         *
+         * @return The ID of the timer, to use with Cancel().
+         */
+        TimerId Schedule(float delay, Callback callback);
+
+        /**
+         * @brief Cancels a pending timer.
+         *
+         * @param id The ID of the timer.
+         *
+         * @return false if the timer has already expired or was cancelled.
+         */
+        bool Cancel(TimerId id);
+
+        /**
+         * @brief Advances the game time, and runs the callbacks of the expired timers in deadline order.
+         *
+         * @param deltaTime The elapsed game time, in seconds.
+         */
+        void Advance(float deltaTime);
+
+        /**
+         * @brief Cancels all the pending timers, without running their callbacks.
+         */
+        void Clear();
+
+        /**
+         * @brief Gets the game time elapsed since the creation of the wheel, in seconds.
+         */
+        [[nodiscard]] double GetTime() const;
+
+        /**
+         * @brief Gets the number of pending timers.
+         */
+        [[nodiscard]] AZ::u32 GetPendingCount() const;
+
+    private:
+        static constexpr AZ::u32 kSlotBits = 6;
+        static constexpr AZ::u32 kSlotsCount = 1 << kSlotBits;
+        static constexpr AZ::u32 kSlotMask = kSlotsCount - 1;
+        static constexpr AZ::u32 kLevelsCount = 4;
+        static constexpr AZ::u32 kInvalidIndex = ~0u;
+
+        struct Timer
+        {
+            AZ::u64 mDeadline = 0;
+            Callback mCallback;
+            AZ::u32 mPrevious = kInvalidIndex;
+            AZ::u32 mNext = kInvalidIndex;
+            AZ::u32 mSlot = kInvalidIndex;
+            AZ::u32 mGeneration = 1;
+        };
+
+        void Insert(AZ::u32 index);
+        void Unlink(AZ::u32 index);
+        void Release(AZ::u32 index);
+        void Cascade(AZ::u32 level);
+
+        AZStd::vector<Timer> _timers;
+        AZStd::vector<AZ::u32> _freeTimers;
+        AZStd::array<AZ::u32, kLevelsCount * kSlotsCount> _slots{};
+
+        AZ::u64 _currentTick = 0;
+        double _remainder = 0.0;
+        AZ::u32 _pendingCount = 0;
+    };
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
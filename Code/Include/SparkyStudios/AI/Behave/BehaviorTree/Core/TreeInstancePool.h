@@ -0,0 +1,120 @@
+#pragma once
+
+#include <StdAfx.h>
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    /**
+     * @brief A pool of behavior tree instances, per behavior tree asset.
+     *
+     * Behavior tree components release their tree in the pool when they are deactivated, and take one back
+     * from it when they are activated, instead of building a new tree from the asset. Released trees are halted,
+     * and the values of their blackboards are reset to the ones they had when the tree was built, like the constants
+     * given to the ports of SubTreePlus nodes. Nodes keeping a state across halts implement ResettableNode, and are
+     * reset as well. Trees behave like newly built ones once the blackboard properties of the component are added back.
+     *
+     * Trees are pooled per asset and per blackboard mode, since the blackboards of the subtrees inherit the
+     * single owner mode of the root blackboard when the tree is built, and don't follow later changes.
+     *
+     * The pool is not thread safe, it is meant to be used from the game thread only.
+     */
+    class TreeInstancePool final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TreeInstancePool, AZ::SystemAllocator, 0);
+
+        /**
+         * @brief The function used to build a new behavior tree when pre-warming the pool.
+         */
+        using TreeBuilder = AZStd::function<BT::Tree()>;
+
+        /**
+         * @brief The default maximum number of trees kept per asset.
+         */
+        static constexpr AZ::u32 DefaultCapacity = 16;
+
+        /**
+         * @brief Sets the maximum number of trees kept per asset. Trees above the new capacity are destroyed.
+         */
+        void SetCapacity(AZ::u32 capacity);
+
+        /**
+         * @brief Gets the maximum number of trees kept per asset.
+         */
+        [[nodiscard]] AZ::u32 GetCapacity() const;
+
+        /**
+         * @brief Takes a tree of the given asset from the pool.
+         *
+         * @param assetId The ID of the behavior tree asset.
+         * @param singleOwner Whether the blackboards of the tree must have a single owner.
+         * @param tree The tree in which move the pooled tree.
+         *
+         * @return bool Whether a tree was available.
+         */
+        bool Acquire(const AZ::Data::AssetId& assetId, bool singleOwner, BT::Tree& tree);
+
+        /**
+         * @brief Gives back a tree of the given asset to the pool. The tree is halted and its blackboards are reset.
+         * Trees whose blackboards don't all have the same single owner mode are not pooled.
+         *
+         * @param assetId The ID of the behavior tree asset.
+         * @param tree The tree to release. It is left empty.
+         *
+         * @return bool Whether the tree was kept in the pool. It is destroyed otherwise.
+         */
+        bool Release(const AZ::Data::AssetId& assetId, BT::Tree&& tree);
+
+        /**
+         * @brief Fills the pool with trees of the given asset. Only the first call for an asset and a mode builds
+         * trees, so the components sharing an asset can all request it when they are loaded.
+         *
+         * @param assetId The ID of the behavior tree asset.
+         * @param singleOwner Whether the blackboards of the built trees have a single owner.
+         * @param count The number of trees to build, limited by the capacity of the pool.
+         * @param builder The function building a new tree of the asset.
+         */
+        void Prewarm(const AZ::Data::AssetId& assetId, bool singleOwner, AZ::u32 count, const TreeBuilder& builder);
+
+        /**
+         * @brief Gets the number of trees of the given asset and mode available in the pool.
+         */
+        [[nodiscard]] AZ::u32 GetPooledCount(const AZ::Data::AssetId& assetId, bool singleOwner) const;
+
+        /**
+         * @brief Destroys the pooled trees of the given asset, e.g. when the asset is reloaded.
+         */
+        void Clear(const AZ::Data::AssetId& assetId);
+
+        /**
+         * @brief Destroys all the pooled trees.
+         */
+        void Clear();
+
+    private:
+        struct ModePool
+        {
+            AZStd::vector<AZStd::unique_ptr<BT::Tree>> mTrees;
+            bool mPrewarmed = false;
+        };
+
+        struct AssetPool
+        {
+            // Indexed by the single owner mode of the trees blackboards.
+            ModePool mModes[2];
+        };
+
+        static void Reset(BT::Tree& tree);
+        static bool GetSingleOwner(const BT::Tree& tree, bool& singleOwner);
+
+        AZStd::unordered_map<AZ::Data::AssetId, AssetPool> _pools;
+        AZ::u32 _capacity = DefaultCapacity;
+    };
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
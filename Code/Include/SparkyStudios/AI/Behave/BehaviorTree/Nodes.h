@@ -51,11 +51,15 @@
 #include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Animation/SimpleMotionSetReverseMotionNode.h>
 
 // Common
+#include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/CooldownNode.h>
 #include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/DebugMessageNode.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/GameDelayNode.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/GameTimeoutNode.h>
 #include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/WaitNode.h>
 
 // Navigation
 #include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Navigation/NavigationFindPathToEntityNode.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Navigation/NavigationRaycastNode.h>
 
 #ifndef __SS_BEHAVEAI_BEHAVIORTREE_NODES_REGISTERER__
 #define __SS_BEHAVEAI_BEHAVIORTREE_NODES_REGISTERER__
@@ -66,6 +70,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes
     {
         // Navigation
         Navigation::NavigationFindPathToEntityNode::RegisterNode(registry);
+        Navigation::NavigationRaycastNode::RegisterNode(registry);
 
         // Animation
         Animation::AnimGraphGetNamedParameterBoolNode::RegisterNode(registry);
@@ -100,7 +105,10 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes
         Animation::SimpleMotionSetReverseMotionNode::RegisterNode(registry);
 
         // Common
+        Common::CooldownNode::RegisterNode(registry);
         Common::DebugMessageNode::RegisterNode(registry);
+        Common::GameDelayNode::RegisterNode(registry);
+        Common::GameTimeoutNode::RegisterNode(registry);
         Common::WaitNode::RegisterNode(registry);
     }
 
@@ -117,6 +125,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes
         registry->RegisterProperty<BlackboardPropertyString>("AZStd::string");
         registry->RegisterProperty<BlackboardPropertyEntityRef>("AZ::EntityId");
         registry->RegisterProperty<BlackboardPropertyVector2>("AZ::Vector2");
+        registry->RegisterProperty<BlackboardPropertyVector3>("AZ::Vector3");
     }
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes
 #endif
@@ -21,7 +21,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class AnimGraphGetNamedParameterFloatNode : public AnimGraphGetNamedParameterNode<float>
     {
     public:
-        AZ_CLASS_ALLOCATOR(AnimGraphGetNamedParameterFloatNode, AZ::SystemAllocator, 0);
         AZ_RTTI(AnimGraphGetNamedParameterFloatNode, "{b4bd8edd-6793-4943-981c-1d150d02efef}", AnimGraphGetNamedParameterNode<float>);
 
         static constexpr const char* NODE_NAME = "AnimGraphGetNamedParameterFloat";
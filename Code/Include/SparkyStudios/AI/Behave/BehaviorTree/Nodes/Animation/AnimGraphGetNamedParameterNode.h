@@ -30,7 +30,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class AnimGraphGetNamedParameterNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(AnimGraphGetNamedParameterNode, AZ::SystemAllocator, 0);
         AZ_RTTI(((AnimGraphGetNamedParameterNode<T>), "{493e6e39-d275-4209-924f-7a62ca0aaf7e}", T), Core::Node);
 
         AnimGraphGetNamedParameterNode(const std::string& name, const Core::BehaviorTreeNodeConfiguration& config)
@@ -21,7 +21,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class AnimGraphSetNamedParameterBoolNode : public AnimGraphSetNamedParameterNode<bool>
     {
     public:
-        AZ_CLASS_ALLOCATOR(AnimGraphSetNamedParameterBoolNode, AZ::SystemAllocator, 0);
         AZ_RTTI(AnimGraphSetNamedParameterBoolNode, "{c051a77f-487f-4977-8c3c-81f9ec45f55d}", AnimGraphSetNamedParameterNode<bool>);
 
         static constexpr const char* NODE_NAME = "AnimGraphSetNamedParameterBool";
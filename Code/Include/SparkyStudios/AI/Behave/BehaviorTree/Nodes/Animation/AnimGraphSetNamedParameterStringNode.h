@@ -21,7 +21,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class AnimGraphSetNamedParameterStringNode : public AnimGraphSetNamedParameterNode<AZStd::string>
     {
     public:
-        AZ_CLASS_ALLOCATOR(AnimGraphSetNamedParameterStringNode, AZ::SystemAllocator, 0);
         AZ_RTTI(AnimGraphSetNamedParameterStringNode, "{397cec57-b565-4cb4-a4be-0a725c9ea6c1}", AnimGraphSetNamedParameterNode<AZStd::string>);
 
         static constexpr const char* NODE_NAME = "AnimGraphSetNamedParameterString";
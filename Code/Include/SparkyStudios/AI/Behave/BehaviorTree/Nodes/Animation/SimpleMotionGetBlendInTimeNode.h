@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionGetBlendInTimeNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionGetBlendInTimeNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionGetBlendInTimeNode, "{9df18a09-5b84-4f63-9cbf-a3350ae17773}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionGetBlendInTime";
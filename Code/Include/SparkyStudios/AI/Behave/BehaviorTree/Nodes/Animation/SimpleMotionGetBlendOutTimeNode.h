@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionGetBlendOutTimeNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionGetBlendOutTimeNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionGetBlendOutTimeNode, "{89d5a1e3-8c16-4e0a-988d-2d3ab839bb8c}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionGetBlendOutTime";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionGetLoopMotionNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionGetLoopMotionNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionGetLoopMotionNode, "{063fa57b-bdba-48c8-9d4f-ae28cf97e446}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionGetLoopMotion";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionGetMotionNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionGetMotionNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionGetMotionNode, "{419fbbd4-145b-4db6-8e08-46288404c17c}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionGetMotion";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionGetPlaySpeedNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionGetPlaySpeedNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionGetPlaySpeedNode, "{8a0bcf03-337b-4d9a-b3a6-9b32d5d0304f}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionGetPlaySpeed";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionGetPlayTimeNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionGetPlayTimeNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionGetPlayTimeNode, "{f07a3ede-05a4-42e0-8f6f-b7aa28be3dd4}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionGetPlayTime";
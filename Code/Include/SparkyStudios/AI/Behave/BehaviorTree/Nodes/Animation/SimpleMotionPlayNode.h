@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionPlayNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionPlayNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionPlayNode, "{50dd73d3-1733-44cb-9b96-ea4a2ddab59b}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionPlay";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionSetBlendInTimeNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionSetBlendInTimeNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionSetBlendInTimeNode, "{a4dc8b71-70cb-4b68-b6c2-88fdd1f9f6e6}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionSetBlendInTime";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionSetBlendOutTimeNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionSetBlendOutTimeNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionSetBlendOutTimeNode, "{e2aae638-5d2f-42b3-9bcc-14d02cb1eda5}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionSetBlendOutTime";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionSetLoopMotionNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionSetLoopMotionNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionSetLoopMotionNode, "{5d158fa0-079d-4b96-adbb-1c346e22cabb}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionSetLoopMotion";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionSetMirrorMotionNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionSetMirrorMotionNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionSetMirrorMotionNode, "{d1f12337-cd86-40f3-bd28-5dd51482aa85}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionSetMirrorMotion";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionSetMotionNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionSetMotionNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionSetMotionNode, "{5283f1d7-05f1-4e1a-ac8a-4819919fed80}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionSetMotion";
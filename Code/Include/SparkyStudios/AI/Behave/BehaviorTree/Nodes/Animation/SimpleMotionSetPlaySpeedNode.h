@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionSetPlaySpeedNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionSetPlaySpeedNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionSetPlaySpeedNode, "{10c22740-f97f-413a-bb8f-1b96fdf1f745}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionSetPlaySpeed";
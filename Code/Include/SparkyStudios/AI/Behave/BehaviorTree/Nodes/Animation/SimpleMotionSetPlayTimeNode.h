@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionSetPlayTimeNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionSetPlayTimeNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionSetPlayTimeNode, "{e8340342-3d66-4b2e-b7c7-a72e0c201d53}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionSetPlayTime";
@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionSetRetargetMotionNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionSetRetargetMotionNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionSetRetargetMotionNode, "{f993c547-697e-42aa-9baf-a54776fb3b52}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionSetRetargetMotion";
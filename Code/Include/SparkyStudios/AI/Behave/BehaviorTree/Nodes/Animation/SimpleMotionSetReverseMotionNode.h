@@ -22,7 +22,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Animation
     class SimpleMotionSetReverseMotionNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(SimpleMotionSetReverseMotionNode, AZ::SystemAllocator, 0);
         AZ_RTTI(SimpleMotionSetReverseMotionNode, "{1b03295f-298b-4bb3-885b-46ffc8aa7e4a}", Core::Node);
 
         static constexpr const char* NODE_NAME = "SimpleMotionSetReverseMotion";
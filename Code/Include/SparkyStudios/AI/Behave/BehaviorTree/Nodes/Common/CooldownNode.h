@@ -0,0 +1,86 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Factory.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
+{
+    /**
+     * @brief Prevents its child from running again during a given number of seconds of game time after it completed.
+     * Returns FAILURE without ticking the child while cooling down, and the status of the child otherwise.
+     *
+     * Halting the node does not reset the cooldown, only giving its tree back to the instance pool does.
+     *
+     * @par Node Ports
+     * - seconds: The number of seconds during which the child can't run after it completed.
+     */
+    class CooldownNode
+        : public Core::BehaviorTreeDecoratorNode
+        , public Core::ResettableNode
+    {
+    public:
+        AZ_RTTI(CooldownNode, "{C4B2E8D6-5F1A-4A3C-9E7D-0F1A2B3C4D83}", Core::BehaviorTreeDecoratorNode);
+
+        CooldownNode(const std::string& name, const Core::BehaviorTreeNodeConfiguration& config);
+
+        ~CooldownNode() override;
+
+        /**
+         * @brief The name of the node in the behavior tree file.
+         */
+        static constexpr const char* NODE_NAME = "Cooldown";
+
+        static constexpr const char* NODE_PORT_SECONDS_NAME = "seconds";
+        static constexpr const char* NODE_PORT_SECONDS_DESCRIPTION =
+            "The number of seconds during which the child can't run after it completed.";
+
+        /**
+         * @brief Reflect this class in the given ReflectContext.
+         *
+         * @param rc The ReflectContext.
+         */
+        static void Reflect(AZ::ReflectContext* rc);
+
+        /**
+         * @brief Register this node in the nodes registry.
+         *
+         * @param registry The registry to register this node in.
+         */
+        static void RegisterNode(const AZStd::shared_ptr<Core::Registry>& registry);
+
+        /**
+         * @brief Returns the list of ports returned by this node.
+         *
+         * @return Core::BehaviorTreePortsList
+         */
+        static Core::BehaviorTreePortsList providedPorts();
+
+        std::string NodeCategory() const override
+        {
+            return "Common";
+        }
+
+        // Core::ResettableNode
+        void ResetNode() override;
+
+    protected:
+        Core::BehaviorTreeNodeStatus tick() override;
+
+    private:
+        Core::TimerWheel::TimerId _timerId = Core::TimerWheel::InvalidTimerId;
+    };
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
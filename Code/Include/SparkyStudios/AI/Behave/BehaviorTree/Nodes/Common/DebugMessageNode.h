@@ -33,7 +33,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
     class DebugMessageNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(DebugMessageNode, AZ::SystemAllocator, 0);
         AZ_RTTI(DebugMessageNode, "{A0059957-67F9-43CB-AE02-1576835B0C73}", Core::Node);
 
         static constexpr const char* NODE_NAME = "DebugMessage";
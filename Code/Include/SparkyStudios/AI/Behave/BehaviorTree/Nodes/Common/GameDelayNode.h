@@ -0,0 +1,84 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Factory.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
+{
+    /**
+     * @brief Waits for a given number of seconds of game time, and then ticks its child.
+     * Returns RUNNING while waiting, and the status of the child after.
+     *
+     * The timer is shared with all the behavior trees, so pausing or scaling the game time also affects it.
+     *
+     * @par Node Ports
+     * - seconds: The number of seconds to wait before to tick the child.
+     */
+    class GameDelayNode : public Core::BehaviorTreeDecoratorNode
+    {
+    public:
+        AZ_RTTI(GameDelayNode, "{7A3D5C1E-2B4F-4F60-8D9A-B1C2D3E4F572}", Core::BehaviorTreeDecoratorNode);
+
+        GameDelayNode(const std::string& name, const Core::BehaviorTreeNodeConfiguration& config);
+
+        ~GameDelayNode() override;
+
+        /**
+         * @brief The name of the node in the behavior tree file.
+         */
+        static constexpr const char* NODE_NAME = "GameDelay";
+
+        static constexpr const char* NODE_PORT_SECONDS_NAME = "seconds";
+        static constexpr const char* NODE_PORT_SECONDS_DESCRIPTION = "The number of seconds to wait before to tick the child.";
+
+        /**
+         * @brief Reflect this class in the given ReflectContext.
+         *
+         * @param rc The ReflectContext.
+         */
+        static void Reflect(AZ::ReflectContext* rc);
+
+        /**
+         * @brief Register this node in the nodes registry.
+         *
+         * @param registry The registry to register this node in.
+         */
+        static void RegisterNode(const AZStd::shared_ptr<Core::Registry>& registry);
+
+        /**
+         * @brief Returns the list of ports returned by this node.
+         *
+         * @return Core::BehaviorTreePortsList
+         */
+        static Core::BehaviorTreePortsList providedPorts();
+
+        std::string NodeCategory() const override
+        {
+            return "Common";
+        }
+
+        void halt() override;
+
+    protected:
+        Core::BehaviorTreeNodeStatus tick() override;
+
+    private:
+        Core::TimerWheel::TimerId _timerId = Core::TimerWheel::InvalidTimerId;
+        bool _started = false;
+        bool _delayCompleted = false;
+    };
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
@@ -29,7 +29,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
     class WaitNode : public Core::Node
     {
     public:
-        AZ_CLASS_ALLOCATOR(WaitNode, AZ::SystemAllocator, 0);
         AZ_RTTI(WaitNode, "{E7F66E3A-7B08-4DA9-8FA2-A5F95355590A}", Core::Node);
 
         WaitNode(const std::string& name, const Core::BehaviorTreeNodeConfiguration& config);
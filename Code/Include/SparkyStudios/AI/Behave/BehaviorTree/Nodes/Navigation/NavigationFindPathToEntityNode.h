@@ -18,6 +18,7 @@
 #include <SparkyStudios/AI/Behave/BehaviorTree/Blackboard/BlackboardProperty.h>
 #include <SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h>
 #include <SparkyStudios/AI/Behave/BehaviorTree/Core/Registry.h>
+#include <SparkyStudios/AI/Behave/Navigation/NavigationMeshBus.h>
 
 #include <LmbrCentral/Ai/NavigationComponentBus.h>
 
@@ -31,16 +32,25 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
      * Even if this class can be used itself, it should be inherited to be
      * really useful.
      *
+     * When a navigation mesh is given, the path toward the target is kept in a persistent path corridor,
+     * adjusted incrementally as the entity and its target move, and the next position to reach is written
+     * in the blackboard for the movement to be driven by the behavior tree. Otherwise, the navigation is
+     * delegated to the entity navigation component. The path corridor is released when the node is destroyed,
+     * when its tree is given back to the instance pool, or when the entity running the tree changes.
+     *
      * @par Node Ports
      * - target: The target entity.
      * - state: The blackboard entry in which store the current navigation state.
+     * - navigation_mesh: Optional. The navigation mesh entity in which follow the target with a path corridor.
+     * - arrival_distance: The distance to the target under which it is reached, when following a path corridor.
+     * - next_position: The blackboard entry in which store the next position to reach, when following a path corridor.
      */
     class NavigationFindPathToEntityNode
         : public Core::Node
+        , public Core::ResettableNode
         , public LmbrCentral::NavigationComponentNotificationBus::Handler
     {
     public:
-        AZ_CLASS_ALLOCATOR(NavigationFindPathToEntityNode, AZ::SystemAllocator, 0);
         AZ_RTTI(NavigationFindPathToEntityNode, "{C8032D5E-DC02-42A8-868A-E1668C6A8EB1}", Core::Node);
 
         static constexpr const char* NODE_NAME = "NavigationFindPathToEntity";
@@ -51,6 +61,18 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
         static constexpr const char* NODE_PORT_STATE_NAME = "state";
         static constexpr const char* NODE_PORT_STATE_DESCRIPTION = "The blackboard entry in which store the current navigation state.";
 
+        static constexpr const char* NODE_PORT_NAVIGATION_MESH_NAME = "navigation_mesh";
+        static constexpr const char* NODE_PORT_NAVIGATION_MESH_DESCRIPTION =
+            "Optional. The navigation mesh entity in which follow the target with a path corridor.";
+
+        static constexpr const char* NODE_PORT_ARRIVAL_DISTANCE_NAME = "arrival_distance";
+        static constexpr const char* NODE_PORT_ARRIVAL_DISTANCE_DESCRIPTION =
+            "The distance to the target under which it is reached, when following a path corridor.";
+
+        static constexpr const char* NODE_PORT_NEXT_POSITION_NAME = "next_position";
+        static constexpr const char* NODE_PORT_NEXT_POSITION_DESCRIPTION =
+            "The blackboard entry in which store the next position to reach, when following a path corridor.";
+
         static void Reflect(AZ::ReflectContext* rc);
 
         static void RegisterNode(const AZStd::shared_ptr<Core::Registry>& registry);
@@ -70,6 +92,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
         };
 
         NavigationFindPathToEntityNode(const std::string& name, const Core::BehaviorTreeNodeConfiguration& config);
+        ~NavigationFindPathToEntityNode() override;
 
         static Core::BehaviorTreePortsList providedPorts();
 
@@ -91,6 +114,9 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
 
         void OnTraversalCancelled(LmbrCentral::PathfindRequest::NavigationRequestId requestId) override;
 
+        // Core::ResettableNode
+        void ResetNode() override;
+
     protected:
         void Start() override;
 
@@ -110,6 +136,11 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
 
         const AZ::EntityId& GetTarget() const;
 
+        /**
+         * @brief Gets the navigation mesh entity in which follow the target with a path corridor, if any.
+         */
+        AZ::EntityId GetNavigationMesh() const;
+
     private:
         void ConnectBus();
 
@@ -123,9 +154,20 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
 
         void RestartNavigation();
 
+        Core::BehaviorTreeNodeStatus TickPathCorridor();
+
+        void ReleasePathCorridor();
+
         NavigationState _navigationState;
         LmbrCentral::PathfindRequest::NavigationRequestId _requestId;
         AZ::EntityId _lastTarget;
+
+        // Only the next corners are needed to steer the entity, the corridor itself keeps the full path.
+        Behave::Navigation::NavigationPathStorage<4> _corridorPath;
+        AZ::EntityId _corridorNavigationMesh;
+
+        // The entity for which the corridor is kept. Corridors are keyed by agent, and pooled trees change of entity.
+        AZ::EntityId _corridorAgent;
     };
 
 #pragma endregion
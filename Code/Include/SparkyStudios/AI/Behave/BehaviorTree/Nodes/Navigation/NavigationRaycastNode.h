@@ -0,0 +1,64 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Registry.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
+{
+    /**
+     * @brief Checks if the entity can walk in a straight line to the target, by casting a ray along
+     * the navigation mesh surface. Succeeds when no wall is hit, fails otherwise.
+     *
+     * @par Node Ports
+     * - navigation_mesh: The navigation mesh entity in which cast the ray.
+     * - target: The target entity.
+     * - hit_position: The blackboard entry in which store the position where the ray hit a wall.
+     */
+    class NavigationRaycastNode : public Core::BehaviorTreeConditionNode
+    {
+    public:
+        AZ_RTTI(NavigationRaycastNode, "{56957ADA-8B2F-406E-8E1F-849066C21809}", Core::BehaviorTreeConditionNode);
+
+        static constexpr const char* NODE_NAME = "NavigationRaycast";
+
+        static constexpr const char* NODE_PORT_NAVIGATION_MESH_NAME = "navigation_mesh";
+        static constexpr const char* NODE_PORT_NAVIGATION_MESH_DESCRIPTION = "The navigation mesh entity in which cast the ray.";
+
+        static constexpr const char* NODE_PORT_TARGET_NAME = "target";
+        static constexpr const char* NODE_PORT_TARGET_DESCRIPTION = "The target entity.";
+
+        static constexpr const char* NODE_PORT_HIT_POSITION_NAME = "hit_position";
+        static constexpr const char* NODE_PORT_HIT_POSITION_DESCRIPTION =
+            "The blackboard entry in which store the position where the ray hit a wall.";
+
+        NavigationRaycastNode(const std::string& name, const Core::BehaviorTreeNodeConfiguration& config);
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        static void RegisterNode(const AZStd::shared_ptr<Core::Registry>& registry);
+
+        static Core::BehaviorTreePortsList providedPorts();
+
+        std::string NodeCategory() const override
+        {
+            return "Navigation";
+        }
+
+    protected:
+        bool Condition() override;
+    };
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
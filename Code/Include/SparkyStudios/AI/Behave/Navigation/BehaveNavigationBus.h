@@ -14,8 +14,13 @@
 
 #pragma once
 
+#include <SparkyStudios/AI/Behave/Navigation/NavigationMeshBus.h>
+#include <SparkyStudios/AI/Behave/Navigation/OffMeshConnection.h>
+
+#include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Aabb.h>
 
 namespace SparkyStudios::AI::Behave::Navigation
 {
@@ -24,6 +29,69 @@ namespace SparkyStudios::AI::Behave::Navigation
     public:
         AZ_RTTI(BehaveNavigationRequests, "{94C72F86-11DA-4A62-87CB-76D62EA3149F}");
         virtual ~BehaveNavigationRequests() = default;
+
+        /**
+         * @brief Registers an active navigation mesh, so position based queries can be routed to it.
+         *
+         * Off-mesh connections starting in the navigation mesh and ending in another one are used
+         * to stitch paths across navigation meshes.
+         *
+         * @param navigationMesh The entity of the navigation mesh, answering NavigationMeshRequestBus requests.
+         * @param bounds The world bounds of the navigation mesh.
+         * @param offMeshConnections The off-mesh connections of the navigation mesh.
+         */
+        virtual void RegisterNavigationMesh(
+            const AZ::EntityId& navigationMesh, const AZ::Aabb& bounds, const OffMeshConnections& offMeshConnections) = 0;
+
+        /**
+         * @brief Unregisters a navigation mesh previously registered with RegisterNavigationMesh.
+         *
+         * @param navigationMesh The entity of the navigation mesh.
+         */
+        virtual void UnregisterNavigationMesh(const AZ::EntityId& navigationMesh) = 0;
+
+        /**
+         * @brief Finds the navigation mesh covering the given position. When navigation meshes overlap,
+         * the smallest one is returned.
+         *
+         * @param position The position, in world space.
+         *
+         * @return The entity of the navigation mesh, or an invalid entity if no navigation mesh covers the position.
+         */
+        [[nodiscard]] virtual AZ::EntityId FindNavigationMesh(const AZ::Vector3& position) const = 0;
+
+        /**
+         * @brief Finds the navigation meshes overlapping the given bounds.
+         *
+         * @param bounds The bounds, in world space.
+         * @param[out] navigationMeshes The entities of the overlapping navigation meshes.
+         */
+        virtual void FindNavigationMeshes(const AZ::Aabb& bounds, AZStd::vector<AZ::EntityId>& navigationMeshes) const = 0;
+
+        /**
+         * @brief Finds the nearest position on the navigation meshes overlapping the search box around a position.
+         *
+         * @param position The position, in world space.
+         * @param extents The half size of the search box on each axis.
+         * @param[out] nearest The nearest position found on a navigation mesh.
+         *
+         * @return true if a position was found, false otherwise.
+         */
+        virtual bool FindNearestPoint(const AZ::Vector3& position, const AZ::Vector3& extents, AZ::Vector3& nearest) = 0;
+
+        /**
+         * @brief Finds a path between two positions, possibly covered by different navigation meshes.
+         *
+         * Paths crossing navigation meshes go through the off-mesh connections linking them. The corner
+         * leaving a navigation mesh is flagged as an off-mesh connection.
+         *
+         * @param from The start position.
+         * @param target The target position.
+         * @param path The buffers receiving the path corners.
+         *
+         * @return The number of corners written, and whether the path is partial or truncated.
+         */
+        virtual NavigationPathResult FindPath(const AZ::Vector3& from, const AZ::Vector3& target, NavigationPathBuffer& path) = 0;
     };
 
     class BehaveNavigationBusTraits : public AZ::EBusTraits
@@ -17,6 +17,7 @@
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/Math/PolygonPrism.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
 
 #include <SparkyStudios/AI/Behave/Navigation/NavigationArea.h>
 
@@ -25,6 +26,168 @@ class dtNavMesh;
 
 namespace SparkyStudios::AI::Behave::Navigation
 {
+    /**
+     * @brief Usage statistics of the store keeping the navigation mesh tiles which are not resident.
+     */
+    struct NavigationMeshTileStoreStatistics
+    {
+        /**
+         * @brief The number of tiles kept compressed in the store.
+         */
+        AZ::u32 mTilesCount = 0;
+
+        /**
+         * @brief The number of tiles currently decompressed in the hot set.
+         */
+        AZ::u32 mHotTilesCount = 0;
+
+        /**
+         * @brief The total size of the compressed tiles data, in bytes.
+         */
+        AZ::u64 mCompressedSize = 0;
+
+        /**
+         * @brief The total size of the stored tiles data once decompressed, in bytes.
+         */
+        AZ::u64 mUncompressedSize = 0;
+
+        /**
+         * @brief The memory used by the decompressed tiles in the hot set, in bytes.
+         */
+        AZ::u64 mHotSetSize = 0;
+
+        /**
+         * @brief The number of tile accesses served from the hot set.
+         */
+        AZ::u64 mHits = 0;
+
+        /**
+         * @brief The number of tile accesses which needed a decompression.
+         */
+        AZ::u64 mMisses = 0;
+
+        /**
+         * @brief The number of tiles dropped from the store to stay within the memory budget.
+         */
+        AZ::u64 mEvictions = 0;
+    };
+
+    /**
+     * @brief Caller owned buffers receiving the corners of a path.
+     *
+     * Path queries writing into these buffers don't allocate memory, the capacity of the buffers
+     * being the maximum number of corners of the path.
+     */
+    struct NavigationPathBuffer
+    {
+        /**
+         * @brief The path corners, in world space. Must hold at least mCapacity elements.
+         */
+        AZ::Vector3* mCorners = nullptr;
+
+        /**
+         * @brief Optional. The Detour straight path flags of each corner (start, end, off-mesh connection).
+         */
+        AZ::u8* mFlags = nullptr;
+
+        /**
+         * @brief Optional. The reference of the polygon entered at each corner.
+         */
+        AZ::u64* mPolygons = nullptr;
+
+        /**
+         * @brief The number of elements each buffer can hold.
+         */
+        AZ::u32 mCapacity = 0;
+    };
+
+    /**
+     * @brief Fixed capacity storage for path queries, meant to be kept by the caller and reused between queries.
+     *
+     * @tparam Capacity The maximum number of corners of the path.
+     */
+    template<AZ::u32 Capacity>
+    struct NavigationPathStorage
+    {
+        AZStd::array<AZ::Vector3, Capacity> mCorners;
+        AZStd::array<AZ::u8, Capacity> mFlags;
+        AZStd::array<AZ::u64, Capacity> mPolygons;
+
+        NavigationPathBuffer GetBuffer()
+        {
+            return NavigationPathBuffer{ mCorners.data(), mFlags.data(), mPolygons.data(), Capacity };
+        }
+    };
+
+    /**
+     * @brief The result of a path query writing into a NavigationPathBuffer.
+     */
+    struct NavigationPathResult
+    {
+        /**
+         * @brief The number of corners written in the path buffer.
+         */
+        AZ::u32 mCornersCount = 0;
+
+        /**
+         * @brief Whether a path was found.
+         */
+        bool mFound = false;
+
+        /**
+         * @brief Whether the target can't be reached. The path then leads to the closest reachable position.
+         */
+        bool mPartial = false;
+
+        /**
+         * @brief Whether the path was cut because the path buffer, or the maximum path length, was too small.
+         */
+        bool mTruncated = false;
+    };
+
+    /**
+     * @brief A batch of navigation mesh raycasts, with caller owned input and output arrays.
+     *
+     * Raycasts walk along the navigation mesh surface from the start of a segment toward its end, and stop
+     * at the first wall, making them a cheap "can I walk straight there" check.
+     */
+    struct NavigationRaycastBatch
+    {
+        /**
+         * @brief The segments start positions, in world space. Must hold at least mCount elements.
+         */
+        const AZ::Vector3* mStarts = nullptr;
+
+        /**
+         * @brief The segments end positions, in world space. Must hold at least mCount elements.
+         */
+        const AZ::Vector3* mEnds = nullptr;
+
+        /**
+         * @brief Receives the hit parameter of each segment, the fraction of the segment at which a wall was hit.
+         * The segment starts at its start position projected on the navigation mesh, use mHitPoints to get world positions.
+         * Segments reaching their end without hitting a wall receive FLT_MAX, and segments starting outside
+         * of the navigation mesh receive 0. Must hold at least mCount elements.
+         */
+        float* mHitParameters = nullptr;
+
+        /**
+         * @brief Optional. Receives the position at which each segment hit a wall. Segments reaching their end receive
+         * their end position, and segments starting outside of the navigation mesh receive their start position.
+         */
+        AZ::Vector3* mHitPoints = nullptr;
+
+        /**
+         * @brief Optional. Receives the normal of the hit wall of each segment, or a zero vector when nothing was hit.
+         */
+        AZ::Vector3* mHitNormals = nullptr;
+
+        /**
+         * @brief The number of segments in the batch.
+         */
+        AZ::u32 mCount = 0;
+    };
+
     class NavigationMeshRequests : public AZ::ComponentBus
     {
     public:
@@ -34,6 +197,90 @@ namespace SparkyStudios::AI::Behave::Navigation
 
         virtual AZStd::vector<AZ::Vector3> FindPathToEntity(const AZ::EntityId& from, const AZ::EntityId& to) = 0;
         virtual AZStd::vector<AZ::Vector3> FindPathToPosition(const AZ::Vector3& from, const AZ::Vector3& target) = 0;
+
+        /**
+         * @brief Finds a path between two positions, writing its corners into caller owned buffers.
+         *
+         * This method does not allocate memory, and is meant to be used on hot paths.
+         *
+         * @param from The start position.
+         * @param target The target position.
+         * @param path The buffers receiving the path corners.
+         *
+         * @return The number of corners written, and whether the path is partial or truncated.
+         */
+        virtual NavigationPathResult FindPath(const AZ::Vector3& from, const AZ::Vector3& target, NavigationPathBuffer& path) = 0;
+
+        /**
+         * @brief Finds the nearest position on the navigation mesh, within a search box around a position.
+         *
+         * @param position The position, in world space.
+         * @param extents The half size of the search box on each axis.
+         * @param[out] nearest The nearest position on the navigation mesh.
+         *
+         * @return true if a position was found, false otherwise.
+         */
+        virtual bool FindNearestPoint(const AZ::Vector3& position, const AZ::Vector3& extents, AZ::Vector3& nearest) = 0;
+
+        /**
+         * @brief Updates the persistent path corridor of an agent toward a possibly moving target, writing the
+         * corners ahead of the agent into caller owned buffers.
+         *
+         * The corridor is adjusted incrementally as the agent and its target move, a full path search being only
+         * done when the corridor becomes invalid. This is the preferred way to follow moving targets.
+         *
+         * @param agent The agent owning the corridor. The corridor is created on the first update.
+         * @param from The current agent position.
+         * @param target The current target position.
+         * @param path The buffers receiving the path corners. An empty found path means the agent has arrived.
+         *
+         * @return The number of corners written, and whether the path is partial or truncated.
+         */
+        virtual NavigationPathResult UpdatePathCorridor(
+            const AZ::EntityId& agent, const AZ::Vector3& from, const AZ::Vector3& target, NavigationPathBuffer& path) = 0;
+
+        /**
+         * @brief Releases the path corridor of an agent, once it stops following its target.
+         *
+         * @param agent The agent owning the corridor.
+         */
+        virtual void ReleasePathCorridor(const AZ::EntityId& agent) = 0;
+
+        /**
+         * @brief Casts a batch of rays along the navigation mesh surface, spread over worker threads for large batches.
+         *
+         * This method does not allocate memory, and blocks until every raycast of the batch is done.
+         *
+         * @param batch The segments to cast, and the arrays receiving the results.
+         *
+         * @return The number of segments reaching their end without hitting a wall.
+         */
+        virtual AZ::u32 Raycast(const NavigationRaycastBatch& batch) = 0;
+
+        /**
+         * @brief Registers an entity around which navigation mesh tiles are kept resident when streaming is enabled.
+         *
+         * @param anchor The entity to follow, usually a player or an active group of agents.
+         */
+        virtual void AddStreamingAnchor(const AZ::EntityId& anchor) = 0;
+
+        /**
+         * @brief Unregisters a streaming anchor previously added with AddStreamingAnchor.
+         *
+         * @param anchor The entity to stop following.
+         */
+        virtual void RemoveStreamingAnchor(const AZ::EntityId& anchor) = 0;
+
+        /**
+         * @brief Gets the usage statistics of the compressed store holding the tiles evicted by streaming.
+         */
+        virtual NavigationMeshTileStoreStatistics GetTileStoreStatistics() = 0;
+
+        /**
+         * @brief Cancels the running navigation mesh build, and drops the queued build request if any.
+         * The current navigation mesh is kept.
+         */
+        virtual void CancelNavigationMeshBuild() = 0;
     };
 
     using NavigationMeshRequestBus = AZ::EBus<NavigationMeshRequests>;
@@ -41,7 +288,28 @@ namespace SparkyStudios::AI::Behave::Navigation
     class NavigationMeshNotifications : public AZ::ComponentBus
     {
     public:
+        /**
+         * @brief Called on the main thread when a new navigation mesh has been built and swapped in.
+         */
         virtual void OnNavigationMeshUpdated() = 0;
+
+        /**
+         * @brief Called on the main thread while the navigation mesh is built in the background.
+         *
+         * @param progress The build progress, between 0 and 1.
+         * @param remainingTime The estimated remaining build time in seconds, or a negative value when unknown.
+         */
+        virtual void OnNavigationMeshBuildProgress([[maybe_unused]] float progress, [[maybe_unused]] float remainingTime)
+        {
+        }
+
+        /**
+         * @brief Called on the main thread when a navigation mesh build was cancelled or has failed.
+         * The current navigation mesh is kept.
+         */
+        virtual void OnNavigationMeshBuildCancelled()
+        {
+        }
     };
 
     using NavigationMeshNotificationBus = AZ::EBus<NavigationMeshNotifications>;
@@ -96,4 +364,53 @@ namespace SparkyStudios::AI::Behave::Navigation
 
     // Use to mark navigation areas.
     using NavigationAreaRequestBus = AZ::EBus<NavigationAreaInterface>;
+
+    /**
+     * @brief Broadcasts sent by the objects taking part in navigation meshes generation (walkables and navigation areas)
+     * when they appear or disappear, so navigation meshes can be updated.
+     */
+    class NavigationMeshObjectNotifications : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        virtual ~NavigationMeshObjectNotifications() = default;
+
+        /**
+         * @brief Called when a navigation mesh object is activated.
+         *
+         * @param entityId The entity of the navigation mesh object.
+         */
+        virtual void OnNavigationMeshObjectActivated(const AZ::EntityId& entityId) = 0;
+
+        /**
+         * @brief Called when a navigation mesh object is deactivated.
+         *
+         * @param entityId The entity of the navigation mesh object.
+         */
+        virtual void OnNavigationMeshObjectDeactivated(const AZ::EntityId& entityId) = 0;
+    };
+
+    using NavigationMeshObjectNotificationBus = AZ::EBus<NavigationMeshObjectNotifications>;
+
+    /**
+     * @brief Requests answered by all the active navigation mesh objects (walkables and navigation areas).
+     */
+    class NavigationMeshObjectRequests : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        virtual ~NavigationMeshObjectRequests() = default;
+
+        /**
+         * @brief Gets the entity of the navigation mesh object. Use with an AZ::EBusAggregateResults
+         * to collect all the active navigation mesh objects.
+         */
+        virtual AZ::EntityId GetNavigationMeshObject() = 0;
+    };
+
+    using NavigationMeshObjectRequestBus = AZ::EBus<NavigationMeshObjectRequests>;
 } // namespace SparkyStudios::AI::Behave::Navigation
@@ -0,0 +1,165 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    /**
+     * @brief Timings and counters gathered while building a navigation mesh tile.
+     *
+     * Timings are in milliseconds. When aggregated over a build, timings and counters are summed,
+     * and the peak memory is the highest peak memory of the tiles.
+     */
+    struct NavigationMeshTileBuildStatistics
+    {
+        int mTileX = 0;
+        int mTileY = 0;
+
+        /**
+         * @brief Time spent rasterizing the input triangles into the height field.
+         */
+        float mRasterizeTime = 0.0f;
+
+        /**
+         * @brief Time spent filtering the walkable spans of the height field.
+         */
+        float mFilterTime = 0.0f;
+
+        /**
+         * @brief Time spent building the compact height field.
+         */
+        float mCompactTime = 0.0f;
+
+        /**
+         * @brief Time spent eroding the walkable area by the agent radius, and marking the navigation areas.
+         */
+        float mErodeTime = 0.0f;
+
+        /**
+         * @brief Time spent partitioning the walkable area into regions, including the distance field.
+         */
+        float mRegionsTime = 0.0f;
+
+        /**
+         * @brief Time spent tracing and simplifying the regions contours.
+         */
+        float mContoursTime = 0.0f;
+
+        /**
+         * @brief Time spent building the polygon mesh from the contours.
+         */
+        float mPolyMeshTime = 0.0f;
+
+        /**
+         * @brief Time spent building the detail mesh.
+         */
+        float mDetailMeshTime = 0.0f;
+
+        /**
+         * @brief Total time spent building the tile.
+         */
+        float mTotalTime = 0.0f;
+
+        /**
+         * @brief The number of input triangles rasterized in the tile.
+         */
+        AZ::u32 mTrianglesCount = 0;
+
+        /**
+         * @brief The number of spans in the height field after filtering.
+         */
+        AZ::u32 mSpansCount = 0;
+
+        /**
+         * @brief The number of polygons of the tile.
+         */
+        AZ::u32 mPolygonsCount = 0;
+
+        /**
+         * @brief The peak memory allocated by Recast while building the tile, in bytes.
+         */
+        AZ::u64 mPeakMemory = 0;
+    };
+
+    /**
+     * @brief Timings and counters gathered while building a navigation mesh.
+     */
+    struct NavigationMeshBuildStatistics
+    {
+        /**
+         * @brief The wall clock time of the build, in milliseconds.
+         */
+        float mBuildTime = 0.0f;
+
+        /**
+         * @brief The number of tiles which failed to build or were empty.
+         */
+        AZ::u32 mSkippedTilesCount = 0;
+
+        /**
+         * @brief The statistics of all the built tiles, aggregated.
+         */
+        NavigationMeshTileBuildStatistics mTotal;
+
+        /**
+         * @brief The statistics of each tile built by the build.
+         */
+        AZStd::vector<NavigationMeshTileBuildStatistics> mTiles;
+
+        /**
+         * @brief The number of tiles built by streaming since the build.
+         */
+        AZ::u32 mStreamedTilesCount = 0;
+
+        /**
+         * @brief The number of tiles streaming failed to build or found empty since the build.
+         */
+        AZ::u32 mStreamedSkippedTilesCount = 0;
+
+        /**
+         * @brief The statistics of all the tiles built by streaming since the build, aggregated.
+         */
+        NavigationMeshTileBuildStatistics mStreamedTotal;
+
+        /**
+         * @brief The statistics of the last tiles built by streaming, oldest first. Only the most recent ones are kept.
+         */
+        AZStd::vector<NavigationMeshTileBuildStatistics> mStreamedTiles;
+    };
+
+    class NavigationMeshStatisticsRequests : public AZ::ComponentBus
+    {
+    public:
+        AZ_RTTI(NavigationMeshStatisticsRequests, "{5B0E4A4D-41A7-4C8B-9F0E-3E6C8A2B7D15}");
+
+        /**
+         * @brief Gets the statistics of the last navigation mesh build.
+         */
+        virtual NavigationMeshBuildStatistics GetBuildStatistics() = 0;
+
+        /**
+         * @brief Gets the statistics of the last navigation mesh build as a JSON document.
+         *
+         * @param includeTiles Whether to include the statistics of each tile, or only the aggregated ones.
+         */
+        virtual AZStd::string DumpBuildStatistics(bool includeTiles) = 0;
+    };
+
+    using NavigationMeshStatisticsRequestBus = AZ::EBus<NavigationMeshStatisticsRequests>;
+} // namespace SparkyStudios::AI::Behave::Navigation
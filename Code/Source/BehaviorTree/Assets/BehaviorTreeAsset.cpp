@@ -35,4 +35,18 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Assets
         , _buffer(_default_content, _default_content + strlen(_default_content))
     {
     }
+
+    AZStd::size_t BehaviorTreeAsset::GetTreeFootprint(const Core::Factory& factory) const
+    {
+        AZStd::size_t footprint = _treeFootprint.load(AZStd::memory_order_relaxed);
+
+        // Concurrent first calls compute the same value.
+        if (footprint == kUnknownTreeFootprint)
+        {
+            footprint = factory.GetTreeFootprint(AZStd::string(_buffer.cbegin(), _buffer.cend()));
+            _treeFootprint.store(footprint, AZStd::memory_order_relaxed);
+        }
+
+        return footprint;
+    }
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Assets
@@ -14,9 +14,12 @@
 
 #pragma once
 
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Factory.h>
+
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace SparkyStudios::AI::Behave::BehaviorTree::Assets
 {
@@ -55,10 +58,24 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Assets
             return _debugName.empty() ? nullptr : _debugName.c_str();
         }
 
+        /**
+         * @brief Gets the size to reserve in a node arena for a tree of this asset. It is computed by the factory
+         * on the first call, and reused for the next trees.
+         *
+         * @param factory The factory creating the trees of this asset.
+         *
+         * @return AZStd::size_t The size to reserve in the arena, in bytes.
+         */
+        [[nodiscard]] AZStd::size_t GetTreeFootprint(const Core::Factory& factory) const;
+
     private:
+        static constexpr AZStd::size_t kUnknownTreeFootprint = ~AZStd::size_t(0);
+
         AZStd::vector<char> _buffer;
         AZStd::string _debugName;
 
+        mutable AZStd::atomic<AZStd::size_t> _treeFootprint = kUnknownTreeFootprint;
+
         friend class BehaviorTreeAssetHandler;
     };
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Assets
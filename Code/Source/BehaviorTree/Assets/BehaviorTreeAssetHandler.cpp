@@ -68,6 +68,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Assets
             behaviorTreeAsset->_buffer.clear();
             behaviorTreeAsset->_buffer.resize(dataLength);
             stream->Read(dataLength, behaviorTreeAsset->_buffer.data());
+            behaviorTreeAsset->_treeFootprint = BehaviorTreeAsset::kUnknownTreeFootprint;
 
             return AZ::Data::AssetHandler::LoadResult::LoadComplete;
         }
@@ -20,6 +20,7 @@
 
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace SparkyStudios::AI::Behave::BehaviorTree
 {
@@ -49,6 +50,28 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
         UpdateAsset(asset, !_running);
     }
 
+    AZ::u32 BehaviorTreeComponent::GetTeamId() const
+    {
+        return _teamId;
+    }
+
+    void BehaviorTreeComponent::SetTeamId(const AZ::u32 teamId)
+    {
+        _teamId = teamId;
+        LinkSharedBlackboards();
+    }
+
+    AZ::u32 BehaviorTreeComponent::GetSquadId() const
+    {
+        return _squadId;
+    }
+
+    void BehaviorTreeComponent::SetSquadId(const AZ::u32 squadId)
+    {
+        _squadId = squadId;
+        LinkSharedBlackboards();
+    }
+
     void BehaviorTreeComponent::Init()
     {
     }
@@ -70,7 +93,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
 
     void BehaviorTreeComponent::Deactivate()
     {
-        UnloadBehaviorTree();
+        ReleaseBehaviorTree();
 
         AZ::Data::AssetBus::Handler::BusDisconnect(_behaviorTreeAsset.GetId());
         AZ::TickBus::Handler::BusDisconnect();
@@ -83,13 +106,16 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
 
     void BehaviorTreeComponent::OnAssetReloaded(AZ::Data::Asset<AZ::Data::AssetData> asset)
     {
+        // The pooled trees were built from the previous version of the asset.
+        if (auto* behaviorTree = BehaveBehaviorTreeInterface::Get())
+            behaviorTree->GetTreeInstancePool().Clear(asset.GetId());
+
         UpdateAsset(asset, true);
     }
 
     void BehaviorTreeComponent::OnTick(float deltaTime, AZ::ScriptTimePoint time)
     {
         AZ_UNUSED(time);
-        AZ_UNUSED(deltaTime);
 
         // If the behavior tree is paused
         if (!_running)
@@ -102,8 +128,23 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
             return;
         }
 
+        // Read the last committed shared entries during this tick
+        if (_sharedBlackboards != nullptr)
+            _sharedBlackboards->Refresh();
+
+        // Apply the writes queued from other threads
+        _btBlackboard.ProcessCommands();
+
         // Run the behavior tree
-        _tree.tickRoot();
+        if (_flatTree.IsCompiled())
+            _flatTree.Tick();
+        else
+            _tree.tickRoot();
+
+        _btBlackboard.PublishSnapshot();
+        _btBlackboard.NotifyObservers();
+
+        ReleaseIdleSubTrees(deltaTime);
     }
 
     int BehaviorTreeComponent::GetTickOrder()
@@ -119,13 +160,55 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
         {
             AZ_Printf("BehaveAI [BehaviorTree]", "Loading  %s", _behaviorTreeAsset.GetHint().c_str());
 
-            Core::Factory factory;
-            EBUS_EVENT_RESULT(factory, BehaveBehaviorTreeRequestBus, GetFactory);
+            Core::TreeInstancePool* pool = nullptr;
+            if (auto* behaviorTree = BehaveBehaviorTreeInterface::Get(); behaviorTree != nullptr && _useInstancePool)
+                pool = &behaviorTree->GetTreeInstancePool();
 
-            LoadBlackboard(asset);
+            _flatTree.Clear();
 
-            const auto data = AZStd::string(buffer.cbegin(), buffer.cend());
-            _tree = factory.CreateTreeFromText(data, _btBlackboard);
+            if (pool != nullptr && _poolPrewarmCount > 0)
+            {
+                pool->Prewarm(
+                    _behaviorTreeAsset.GetId(), _btBlackboard.mSingleOwner, _poolPrewarmCount,
+                    [this, asset]()
+                    {
+                        // Build the tree on its own blackboard, holding the properties of this component. The component
+                        // which acquires the tree links it to its own shared blackboards.
+                        Blackboard::Blackboard blackboard;
+                        LoadBlackboard(blackboard);
+                        SetSharedBlackboardLookup(blackboard, CreateSharedBlackboardLookup());
+
+                        Core::NodeArena arena;
+                        return CreateTree(asset, blackboard, arena);
+                    });
+            }
+
+            if (pool != nullptr && pool->Acquire(_behaviorTreeAsset.GetId(), _btBlackboard.mSingleOwner, _tree))
+            {
+                // Use the blackboard of the pooled tree, and restore the properties of this component in it.
+                _btBlackboard.mBlackboard = _tree.rootBlackboard();
+                LoadBlackboard(_btBlackboard);
+                LinkSharedBlackboards();
+
+                _btBlackboard.mBlackboard->set<AZ::EntityId>("entityId", GetEntityId());
+            }
+            else
+            {
+                LoadBlackboard(_btBlackboard);
+                LinkSharedBlackboards();
+
+                _tree = CreateTree(asset, _btBlackboard, _nodeArena);
+            }
+
+            if (_useFlatExecutor)
+                _flatTree.Compile(_tree.rootNode());
+
+            _lazySubTrees.clear();
+            for (const BT::TreeNode::Ptr& node : _tree.nodes)
+            {
+                if (auto* lazySubTree = dynamic_cast<BT::LazySubtreeNode*>(node.get()); lazySubTree && lazySubTree->releaseAfter() >= 0.0)
+                    _lazySubTrees.push_back({ lazySubTree, 0.0f });
+            }
 
             AZ_Printf("BehaveAI [BehaviorTree]", "Loaded  %s", _behaviorTreeAsset.GetHint().c_str());
 
@@ -133,6 +216,18 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
         }
     }
 
+    BT::Tree BehaviorTreeComponent::CreateTree(
+        const Assets::BehaviorTreeAsset* asset, const Blackboard::Blackboard& blackboard, Core::NodeArena& arena)
+    {
+        Core::Factory factory;
+        EBUS_EVENT_RESULT(factory, BehaveBehaviorTreeRequestBus, GetFactory);
+
+        const AZStd::vector<char>& buffer = asset->GetBuffer();
+        const auto data = AZStd::string(buffer.cbegin(), buffer.cend());
+
+        return factory.CreateTreeFromText(data, blackboard, arena, asset->GetTreeFootprint(factory));
+    }
+
     void BehaviorTreeComponent::UpdateAsset(const AZ::Data::Asset<Assets::BehaviorTreeAsset>& asset, bool force)
     {
         if (asset && (asset.GetId() != _behaviorTreeAsset.GetId() || force))
@@ -157,22 +252,105 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
         }
     }
 
-    void BehaviorTreeComponent::LoadBlackboard(const Assets::BehaviorTreeAsset* asset) const
+    void BehaviorTreeComponent::LoadBlackboard(const Blackboard::Blackboard& blackboard) const
     {
-        AZ_UNUSED(asset);
+        // Must be set before the tree is created, so subtree blackboards inherit it.
+        blackboard.mBlackboard->setSingleOwner(_btBlackboard.mSingleOwner);
 
         for (const auto* prop : _btBlackboard.mProperties)
         {
-            prop->AddBlackboardEntry(_btBlackboard);
+            prop->AddBlackboardEntry(blackboard);
         }
     }
 
+    void BehaviorTreeComponent::LinkSharedBlackboards()
+    {
+        // The snapshots of the shared blackboards are refreshed before each tick, see OnTick().
+        _sharedBlackboards = CreateSharedBlackboardLookup();
+        SetSharedBlackboardLookup(_btBlackboard, _sharedBlackboards);
+    }
+
+    AZStd::shared_ptr<Blackboard::SharedBlackboardLookup> BehaviorTreeComponent::CreateSharedBlackboardLookup() const
+    {
+        auto* behaviorTree = BehaveBehaviorTreeInterface::Get();
+        if (behaviorTree == nullptr)
+            return nullptr;
+
+        // Looked up from the most specific scope to the global one.
+        AZStd::vector<AZStd::shared_ptr<Blackboard::SharedBlackboard>> scopes;
+        if (_squadId != 0)
+            scopes.push_back(behaviorTree->GetSharedBlackboards().Get(Blackboard::SharedBlackboardScope::Squad, _squadId));
+        if (_teamId != 0)
+            scopes.push_back(behaviorTree->GetSharedBlackboards().Get(Blackboard::SharedBlackboardScope::Team, _teamId));
+        scopes.push_back(behaviorTree->GetSharedBlackboards().Get(Blackboard::SharedBlackboardScope::Global));
+
+        return AZStd::make_shared<Blackboard::SharedBlackboardLookup>(AZStd::move(scopes));
+    }
+
+    void BehaviorTreeComponent::SetSharedBlackboardLookup(
+        const Blackboard::Blackboard& blackboard, const AZStd::shared_ptr<Blackboard::SharedBlackboardLookup>& lookup)
+    {
+        if (lookup == nullptr)
+            return;
+
+        blackboard.mBlackboard->setSharedEntryLookup(
+            [lookup](const std::string& key) -> const BT::Blackboard::Entry*
+            {
+                return lookup->Find(key);
+            });
+    }
+
     void BehaviorTreeComponent::UnloadBehaviorTree()
     {
+        _flatTree.Halt();
+        _flatTree.Clear();
+
         _tree.haltTree();
         _running = false;
     }
 
+    void BehaviorTreeComponent::ReleaseIdleSubTrees(const float deltaTime)
+    {
+        for (LazySubTree& subTree : _lazySubTrees)
+        {
+            if (!subTree.mNode->isInstantiated() || subTree.mNode->status() == BT::NodeStatus::RUNNING)
+            {
+                subTree.mIdleTime = 0.0f;
+                continue;
+            }
+
+            subTree.mIdleTime += deltaTime;
+
+            if (subTree.mIdleTime >= subTree.mNode->releaseAfter())
+            {
+                subTree.mNode->release();
+                subTree.mIdleTime = 0.0f;
+            }
+        }
+    }
+
+    void BehaviorTreeComponent::ReleaseBehaviorTree()
+    {
+        UnloadBehaviorTree();
+
+        if (!_useInstancePool || _tree.rootNode() == nullptr)
+            return;
+
+        if (auto* behaviorTree = BehaveBehaviorTreeInterface::Get())
+        {
+            _lazySubTrees.clear();
+
+            // Pooled trees are linked again to the shared blackboards of the component acquiring them.
+            _btBlackboard.mBlackboard->setSharedEntryLookup(nullptr);
+
+            behaviorTree->GetTreeInstancePool().Release(_behaviorTreeAsset.GetId(), AZStd::move(_tree));
+            _tree = BT::Tree();
+
+            // The blackboard stays with the released tree.
+            _btBlackboard.mBlackboard = BT::Blackboard::create();
+        }
+    }
+
     void BehaviorTreeComponent::Reflect(AZ::ReflectContext* rc)
     {
         if (auto* const sc = azrtti_cast<AZ::SerializeContext*>(rc))
@@ -184,10 +362,16 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
                 sc->Class<BehaviorTreeComponent, AZ::Component>()
                     ->Version(0)
                     ->Field("Blackboard", &BehaviorTreeComponent::_btBlackboard)
-                    ->Field("BehaviorTree", &BehaviorTreeComponent::_behaviorTreeAsset);
+                    ->Field("BehaviorTree", &BehaviorTreeComponent::_behaviorTreeAsset)
+                    ->Field("UseFlatExecutor", &BehaviorTreeComponent::_useFlatExecutor)
+                    ->Field("UseInstancePool", &BehaviorTreeComponent::_useInstancePool)
+                    ->Field("PoolPrewarmCount", &BehaviorTreeComponent::_poolPrewarmCount)
+                    ->Field("TeamId", &BehaviorTreeComponent::_teamId)
+                    ->Field("SquadId", &BehaviorTreeComponent::_squadId);
 
                 sc->Class<Blackboard::Blackboard>()
                     ->Field("Name", &Blackboard::Blackboard::mName)
+                    ->Field("SingleOwner", &Blackboard::Blackboard::mSingleOwner)
                     ->Field("Properties", &Blackboard::Blackboard::mProperties);
 
                 // Reflect all properties
@@ -200,6 +384,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
                 Blackboard::BlackboardPropertyEntityRef::Reflect(rc);
 
                 Blackboard::BlackboardPropertyVector2::Reflect(rc);
+                Blackboard::BlackboardPropertyVector3::Reflect(rc);
             }
         }
     }
@@ -15,6 +15,9 @@
 #pragma once
 
 #include <SparkyStudios/AI/Behave/BehaviorTree/Blackboard/Blackboard.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Blackboard/SharedBlackboard.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/FlatTree.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/NodeArena.h>
 
 #include <BehaviorTree/Assets/BehaviorTreeAsset.h>
 
@@ -40,6 +43,24 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
 
         void SetBehaviorTree(const AZ::Data::Asset<Assets::BehaviorTreeAsset>& asset);
 
+        [[nodiscard]] AZ::u32 GetTeamId() const;
+
+        /**
+         * @brief Links the blackboard to the shared blackboard of a team.
+         *
+         * @param teamId The ID of the team, or 0 to unlink it.
+         */
+        void SetTeamId(AZ::u32 teamId);
+
+        [[nodiscard]] AZ::u32 GetSquadId() const;
+
+        /**
+         * @brief Links the blackboard to the shared blackboard of a squad.
+         *
+         * @param squadId The ID of the squad, or 0 to unlink it.
+         */
+        void SetSquadId(AZ::u32 squadId);
+
         // AZ::Component
         void Init() override;
         void Activate() override;
@@ -61,14 +82,41 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
 
     private:
         void UpdateAsset(const AZ::Data::Asset<Assets::BehaviorTreeAsset>& asset, bool force = false);
-        void LoadBlackboard(const Assets::BehaviorTreeAsset* asset) const;
+        void LoadBlackboard(const Blackboard::Blackboard& blackboard) const;
+        void LinkSharedBlackboards();
+        [[nodiscard]] AZStd::shared_ptr<Blackboard::SharedBlackboardLookup> CreateSharedBlackboardLookup() const;
+        static void SetSharedBlackboardLookup(
+            const Blackboard::Blackboard& blackboard, const AZStd::shared_ptr<Blackboard::SharedBlackboardLookup>& lookup);
+        static BT::Tree CreateTree(
+            const Assets::BehaviorTreeAsset* asset, const Blackboard::Blackboard& blackboard, Core::NodeArena& arena);
+        void ReleaseBehaviorTree();
+        void ReleaseIdleSubTrees(float deltaTime);
 
         AZ::Data::Asset<Assets::BehaviorTreeAsset> _behaviorTreeAsset;
         bool _running;
 
+        Core::NodeArena _nodeArena;
         BT::Tree _tree;
         Blackboard::Blackboard _btBlackboard;
 
+        bool _useFlatExecutor = false;
+        Core::FlatTree _flatTree;
+
+        struct LazySubTree
+        {
+            BT::LazySubtreeNode* mNode;
+            float mIdleTime;
+        };
+
+        AZStd::vector<LazySubTree> _lazySubTrees;
+
+        bool _useInstancePool = false;
+        AZ::u32 _poolPrewarmCount = 0;
+
+        AZ::u32 _teamId = 0;
+        AZ::u32 _squadId = 0;
+        AZStd::shared_ptr<Blackboard::SharedBlackboardLookup> _sharedBlackboards;
+
         friend class BehaviorTreeEditorComponent;
     };
 } // namespace SparkyStudios::AI::Behave::BehaviorTree
@@ -257,6 +257,11 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
                         _behaviorTreeComponent._btBlackboard.mName = blackboardName->value();
                     }
 
+                    if (const AZ::rapidxml::xml_attribute<char>* singleOwner = blackboardNode->first_attribute("single_owner"))
+                    {
+                        _behaviorTreeComponent._btBlackboard.mSingleOwner = strcmp(singleOwner->value(), "true") == 0;
+                    }
+
                     AZ::rapidxml::xml_node<char>* propertyNode;
                     while ((propertyNode = blackboardNode->first_node("Property")))
                     {
@@ -536,6 +541,22 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
 
                 ec->Class<BehaviorTreeComponent>(
                       "BehaviorTree", "An implementation of behavior trees for O3DE, powered by BehaviorTree.CPP.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &BehaviorTreeComponent::_useFlatExecutor, "Use Flat Executor",
+                        "Runs the behavior tree from a flat array of its nodes, interpreting the builtin control and decorator nodes.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &BehaviorTreeComponent::_useInstancePool, "Use Instance Pool",
+                        "Reuses the behavior tree instances released by deactivated entities, instead of building a new tree.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &BehaviorTreeComponent::_poolPrewarmCount, "Pool Prewarm Count",
+                        "The number of behavior tree instances built in the pool when the asset is first loaded.")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &BehaviorTreeComponent::_useInstancePool)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &BehaviorTreeComponent::_teamId, "Team",
+                        "The team whose shared blackboard is read for the keys missing in the blackboard. 0 for none.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &BehaviorTreeComponent::_squadId, "Squad",
+                        "The squad whose shared blackboard is read for the keys missing in the blackboard. 0 for none.")
                     ->DataElement(0, &BehaviorTreeComponent::_btBlackboard, "Blackboard", "BehaviorTree properties.")
                     ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                     ->DataElement(0, &BehaviorTreeComponent::_behaviorTreeAsset, "Asset", "")
@@ -596,6 +617,14 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
                     ->Attribute(AZ::Edit::Attributes::NameLabelOverride, &BlackboardProperty::mName)
                     ->Attribute(AZ::Edit::Attributes::Suffix, &BlackboardProperty::mSuffix)
                     ->Attribute(AZ::Edit::Attributes::DescriptionTextOverride, &BlackboardProperty::mDescription);
+
+                ec->Class<BlackboardPropertyVector3>("BehaviorTree Blackboard Property (Vector3)", "A blackboard Vector3 property")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "BlackboardProperty's class attributes.")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &BlackboardProperty::mVisibility)
+                    ->DataElement(0, &BlackboardPropertyVector3::mValue, "Value", "A three dimensional vector")
+                    ->Attribute(AZ::Edit::Attributes::NameLabelOverride, &BlackboardProperty::mName)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, &BlackboardProperty::mSuffix)
+                    ->Attribute(AZ::Edit::Attributes::DescriptionTextOverride, &BlackboardProperty::mDescription);
             }
         }
     }
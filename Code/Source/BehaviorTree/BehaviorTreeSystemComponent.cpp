@@ -102,6 +102,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
     void BehaviorTreeSystemComponent::Activate()
     {
         BehaveBehaviorTreeRequestBus::Handler::BusConnect();
+        AZ::TickBus::Handler::BusConnect();
 
         AZStd::vector<AZStd::string> superchargedGems{ "EMotionFX", "LmbrCentral" };
 
@@ -177,15 +178,55 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
             // Enable all the available nodes.
             _factory.GetRegistry()->EnableNodes(enabledNodes);
         }
+
+        if (AZ::u64 capacity; settingsRegistry->Get(capacity, "/SparkyStudios/AI/Behave/BehaviorTree/InstancePoolCapacity"))
+        {
+            _treeInstancePool.SetCapacity(aznumeric_cast<AZ::u32>(capacity));
+        }
     }
 
     void BehaviorTreeSystemComponent::Deactivate()
     {
+        AZ::TickBus::Handler::BusDisconnect();
         BehaveBehaviorTreeRequestBus::Handler::BusDisconnect();
+
+        _treeInstancePool.Clear();
+        _sharedBlackboards.Clear();
+        _timerWheel.Clear();
+    }
+
+    void BehaviorTreeSystemComponent::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+    {
+        AZ_UNUSED(time);
+
+        _sharedBlackboards.Commit();
+        _timerWheel.Advance(deltaTime);
+    }
+
+    int BehaviorTreeSystemComponent::GetTickOrder()
+    {
+        // Expire the timers and commit the shared blackboards before the behavior trees are ticked,
+        // so nodes see them in the same frame.
+        return AZ::TICK_GAME - 1;
     }
 
     const Core::Factory& BehaviorTreeSystemComponent::GetFactory() const
     {
         return _factory;
     }
+
+    Core::TimerWheel& BehaviorTreeSystemComponent::GetTimerWheel()
+    {
+        return _timerWheel;
+    }
+
+    Core::TreeInstancePool& BehaviorTreeSystemComponent::GetTreeInstancePool()
+    {
+        return _treeInstancePool;
+    }
+
+    SharedBlackboardRegistry& BehaviorTreeSystemComponent::GetSharedBlackboards()
+    {
+        return _sharedBlackboards;
+    }
 } // namespace SparkyStudios::AI::Behave::BehaviorTree
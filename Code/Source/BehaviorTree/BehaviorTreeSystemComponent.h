@@ -15,6 +15,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 
 #include <SparkyStudios/AI/Behave/BehaviorTree/BehaveBehaviorTreeBus.h>
 
@@ -23,6 +24,7 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
     class BehaviorTreeSystemComponent
         : public AZ::Component
         , protected BehaveBehaviorTreeRequestBus::Handler
+        , public AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(BehaviorTreeSystemComponent, "{4A9E985C-692E-47C3-9573-94DD1AA64DCE}");
@@ -40,16 +42,26 @@ namespace SparkyStudios::AI::Behave::BehaviorTree
     protected:
         // BehaveBehaviorTreeRequestBus
         const Core::Factory& GetFactory() const override;
+        Core::TimerWheel& GetTimerWheel() override;
+        Core::TreeInstancePool& GetTreeInstancePool() override;
+        Blackboard::SharedBlackboardRegistry& GetSharedBlackboards() override;
 
         // AZ::Component
         void Init() override;
         void Activate() override;
         void Deactivate() override;
 
+        // AZ::TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
     private:
         void RegisterDefaultProperties() const;
         void RegisterDefaultNodes() const;
 
         Core::Factory _factory;
+        Core::TimerWheel _timerWheel;
+        Core::TreeInstancePool _treeInstancePool;
+        Blackboard::SharedBlackboardRegistry _sharedBlackboards;
     };
 } // namespace SparkyStudios::AI::Behave::BehaviorTree
@@ -17,6 +17,7 @@
 #include <SparkyStudios/AI/Behave/BehaviorTree/Blackboard/Blackboard.h>
 
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 
 namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
 {
@@ -45,9 +46,123 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
         mProperties.clear();
 
         BT::Blackboard::Ptr bb = BT::Blackboard::create();
+        bb->setSingleOwner(mSingleOwner);
         mBlackboard.swap(bb);
     }
 
+    void Blackboard::EnqueueCommand(BlackboardCommand command)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_commandsMutex);
+        _commands.push_back(AZStd::move(command));
+        _hasCommands = true;
+    }
+
+    void Blackboard::ProcessCommands()
+    {
+        // Avoid locking on each tick when nothing was queued.
+        if (!_hasCommands)
+            return;
+
+        AZStd::vector<BlackboardCommand> commands;
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(_commandsMutex);
+            commands.swap(_commands);
+            _hasCommands = false;
+        }
+
+        for (const BlackboardCommand& command : commands)
+        {
+            command(*mBlackboard);
+        }
+    }
+
+    void Blackboard::RequestSnapshot()
+    {
+        _snapshotRequested = true;
+    }
+
+    void Blackboard::PublishSnapshot()
+    {
+        if (!_snapshotRequested.exchange(false))
+            return;
+
+        auto snapshot = AZStd::make_shared<BlackboardSnapshot>();
+
+        for (const BT::StringView& key : mBlackboard->getKeys())
+        {
+            if (const BT::Any* value = mBlackboard->getAny(static_cast<std::string>(key)); value != nullptr && !value->empty())
+                snapshot->emplace(AZStd::string(key.data(), key.size()), *value);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(_snapshotMutex);
+        _snapshot = AZStd::move(snapshot);
+    }
+
+    AZStd::shared_ptr<const BlackboardSnapshot> Blackboard::GetSnapshot() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_snapshotMutex);
+        return _snapshot;
+    }
+
+    AZ::u64 Blackboard::GetVersion(const AZStd::string& key) const
+    {
+        return mBlackboard->getSequenceId(key.c_str());
+    }
+
+    BlackboardObserverId Blackboard::AddObserver(const AZStd::string& key, BlackboardObserver observer)
+    {
+        const BlackboardObserverId id = _nextObserverId++;
+
+        // Only the changes made after the registration are notified.
+        _observers.push_back({ id, key, AZStd::move(observer), GetVersion(key) });
+
+        return id;
+    }
+
+    void Blackboard::RemoveObserver(const BlackboardObserverId id)
+    {
+        // Only invalidated, observers may be removed while they are notified.
+        for (ObserverEntry& entry : _observers)
+        {
+            if (entry.mId == id)
+                entry.mObserver = nullptr;
+        }
+    }
+
+    void Blackboard::NotifyObservers()
+    {
+        // Observers added while notifying are appended, so the entries are accessed by index.
+        for (size_t i = 0; i < _observers.size(); ++i)
+        {
+            if (!_observers[i].mObserver)
+                continue;
+
+            const AZ::u64 version = GetVersion(_observers[i].mKey);
+            if (version == _observers[i].mVersion)
+                continue;
+
+            _observers[i].mVersion = version;
+
+            // Read through the const blackboard, to also find the shared entries.
+            const BT::Blackboard& blackboard = *mBlackboard;
+            if (const BT::Any* value = blackboard.getAny(_observers[i].mKey.c_str()); value != nullptr)
+            {
+                // Copied, since the observer may add observers.
+                const AZStd::string key = _observers[i].mKey;
+                const BlackboardObserver observer = _observers[i].mObserver;
+                observer(key, *value);
+            }
+        }
+
+        AZStd::erase_if(
+            _observers,
+            [](const ObserverEntry& entry)
+            {
+                return !entry.mObserver;
+            });
+    }
+
     Blackboard::Blackboard(Blackboard&& rhs) noexcept
     {
         *this = AZStd::move(rhs);
@@ -61,9 +176,25 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
     Blackboard& Blackboard::operator=(Blackboard&& rhs) noexcept
     {
         mName.swap(rhs.mName);
+        AZStd::swap(mSingleOwner, rhs.mSingleOwner);
         mProperties.swap(rhs.mProperties);
         mBlackboard.swap(rhs.mBlackboard);
 
+        {
+            AZStd::scoped_lock lock(_commandsMutex, rhs._commandsMutex);
+            _commands.swap(rhs._commands);
+            _hasCommands = !_commands.empty();
+            rhs._hasCommands = !rhs._commands.empty();
+        }
+
+        {
+            AZStd::scoped_lock lock(_snapshotMutex, rhs._snapshotMutex);
+            _snapshot.swap(rhs._snapshot);
+        }
+
+        _observers.swap(rhs._observers);
+        AZStd::swap(_nextObserverId, rhs._nextObserverId);
+
         return *this;
     }
 
@@ -481,5 +612,62 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
         mValue = BT::convertFromString<AZ::Vector2>(value);
     }
 
+#pragma endregion
+
+#pragma region BlackboardPropertyVector3
+
+    void BlackboardPropertyVector3::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* sc = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            sc->Class<BlackboardPropertyVector3, BlackboardProperty>()->Version(0)->Field("value", &BlackboardPropertyVector3::mValue);
+        }
+    }
+
+    BlackboardPropertyVector3::BlackboardPropertyVector3(const char* name)
+        : BlackboardProperty(name)
+    {
+    }
+
+    const void* BlackboardPropertyVector3::GetDataAddress() const
+    {
+        return &mValue;
+    }
+
+    const AZ::Uuid& BlackboardPropertyVector3::GetDataTypeUuid() const
+    {
+        return azrtti_typeid<AZ::Vector3>();
+    }
+
+    BlackboardPropertyVector3* BlackboardPropertyVector3::Clone(const char* name) const
+    {
+        auto* clonedValue = aznew BlackboardPropertyVector3(name ? name : mName.c_str());
+        clonedValue->mValue = mValue;
+        return clonedValue;
+    }
+
+    void BlackboardPropertyVector3::CloneDataFrom(const BlackboardProperty* scriptProperty)
+    {
+        const auto* entityProperty = azrtti_cast<const BlackboardPropertyVector3*>(scriptProperty);
+
+        AZ_Error(
+            "BlackboardPropertyVector3", entityProperty, "Invalid call to CloneData. Types must match before clone attempt is made.\n");
+
+        if (entityProperty)
+        {
+            mValue = entityProperty->mValue;
+        }
+    }
+
+    void BlackboardPropertyVector3::AddBlackboardEntry(const Blackboard& blackboard) const
+    {
+        blackboard.mBlackboard->set<AZ::Vector3>(mName.c_str(), mValue);
+    }
+
+    void BlackboardPropertyVector3::SetValueFromString(const char* value)
+    {
+        mValue = BT::convertFromString<AZ::Vector3>(value);
+    }
+
 #pragma endregion
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
@@ -76,7 +76,6 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
 
     bool BlackboardProperty::IsVector3() const
     {
-        // TODO: Implement a SSBehaviorTreeBlackboardPropertyVector3
-        return false;
+        return GetDataTypeUuid() == azrtti_typeid<BlackboardPropertyVector3>();
     }
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
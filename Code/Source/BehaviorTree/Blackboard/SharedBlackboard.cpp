@@ -0,0 +1,171 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StdAfx.h>
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Blackboard/SharedBlackboard.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
+{
+    // Shared entries are versioned from a single counter, so a key keeps changing its version when it is read from
+    // another shared blackboard.
+    static AZStd::atomic<AZ::u64> gSharedSequenceId = 0;
+
+    void SharedBlackboard::Write(const AZStd::string& key, BT::Any value)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_writesMutex);
+        _writes.emplace_back(key.c_str(), AZStd::move(value));
+        _hasWrites = true;
+    }
+
+    const BT::Blackboard::Entry* SharedBlackboard::Snapshot::Find(const std::string& key) const
+    {
+        const auto it = _entries.find(key);
+        return it == _entries.end() ? nullptr : &it->second;
+    }
+
+    AZStd::shared_ptr<const SharedBlackboard::Snapshot> SharedBlackboard::GetSnapshot() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_snapshotMutex);
+        return _snapshot;
+    }
+
+    AZStd::shared_ptr<const SharedBlackboard::Snapshot> SharedBlackboard::GetSnapshot(AZ::u64& version) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_snapshotMutex);
+        version = _version.load(AZStd::memory_order_relaxed);
+        return _snapshot;
+    }
+
+    AZ::u64 SharedBlackboard::GetVersion() const
+    {
+        return _version.load(AZStd::memory_order_acquire);
+    }
+
+    bool SharedBlackboard::Commit()
+    {
+        if (!_hasWrites.exchange(false))
+            return false;
+
+        AZStd::vector<AZStd::pair<std::string, BT::Any>> writes;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(_writesMutex);
+            writes.swap(_writes);
+        }
+
+        // Published snapshots are immutable, the writes are applied on a copy of the current one. The pointer is only
+        // replaced by this method, on the game thread, so reading it here doesn't race with the readers copying it.
+        auto snapshot = AZStd::make_shared<Snapshot>();
+        if (_snapshot != nullptr)
+            snapshot->_entries = _snapshot->_entries;
+
+        for (auto& [key, value] : writes)
+        {
+            if (const auto it = snapshot->_entries.find(key); it != snapshot->_entries.end())
+            {
+                BT::Blackboard::Entry& entry = it->second;
+                if (!entry.value.empty() && !value.empty() && entry.value.type() != value.type())
+                {
+                    AZ_Warning(
+                        "BehaveAI [BehaviorTree]", false, "The type of the shared blackboard entry [%s] can't change.", key.c_str());
+                    continue;
+                }
+
+                entry.value = AZStd::move(value);
+                entry.sequence_id = ++gSharedSequenceId;
+            }
+            else
+            {
+                const auto it = snapshot->_entries.emplace(key, BT::Blackboard::Entry(AZStd::move(value), BT::PortInfo())).first;
+                it->second.sequence_id = ++gSharedSequenceId;
+            }
+        }
+
+        // The replaced snapshot is freed by its last reader.
+        AZStd::shared_ptr<const Snapshot> replaced = AZStd::move(snapshot);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(_snapshotMutex);
+            _snapshot.swap(replaced);
+            _version.fetch_add(1, AZStd::memory_order_release);
+        }
+
+        return true;
+    }
+
+    SharedBlackboardLookup::SharedBlackboardLookup(AZStd::vector<AZStd::shared_ptr<SharedBlackboard>> blackboards)
+        : _blackboards(AZStd::move(blackboards))
+    {
+        _snapshots.resize(_blackboards.size());
+        _versions.resize(_blackboards.size(), 0);
+        Refresh();
+    }
+
+    void SharedBlackboardLookup::Refresh()
+    {
+        for (size_t i = 0; i < _blackboards.size(); ++i)
+        {
+            // Most ticks nothing was committed, and the held snapshot is still the current one.
+            if (_blackboards[i]->GetVersion() == _versions[i])
+                continue;
+
+            _snapshots[i] = _blackboards[i]->GetSnapshot(_versions[i]);
+        }
+    }
+
+    const BT::Blackboard::Entry* SharedBlackboardLookup::Find(const std::string& key) const
+    {
+        for (const auto& snapshot : _snapshots)
+        {
+            if (snapshot == nullptr)
+                continue;
+
+            if (const BT::Blackboard::Entry* entry = snapshot->Find(key); entry != nullptr && !entry->value.empty())
+                return entry;
+        }
+
+        return nullptr;
+    }
+
+    AZStd::shared_ptr<SharedBlackboard> SharedBlackboardRegistry::Get(const SharedBlackboardScope scope, const AZ::u32 id)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_mutex);
+
+        AZStd::shared_ptr<SharedBlackboard>& blackboard = _blackboards[GetKey(scope, id)];
+        if (!blackboard)
+            blackboard = AZStd::make_shared<SharedBlackboard>();
+
+        return blackboard;
+    }
+
+    void SharedBlackboardRegistry::Commit()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_mutex);
+
+        for (auto& [key, blackboard] : _blackboards)
+        {
+            blackboard->Commit();
+        }
+    }
+
+    void SharedBlackboardRegistry::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_mutex);
+        _blackboards.clear();
+    }
+
+    AZ::u64 SharedBlackboardRegistry::GetKey(const SharedBlackboardScope scope, const AZ::u32 id)
+    {
+        return (static_cast<AZ::u64>(scope) << 32) | (scope == SharedBlackboardScope::Global ? 0 : id);
+    }
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Blackboard
@@ -0,0 +1,96 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StdAfx.h>
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/AsyncNode.h>
+
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    struct AsyncNode::JobState
+    {
+        AZStd::atomic<bool> mRunning = true;
+        AZStd::atomic<bool> mCancelRequested = false;
+        AZStd::atomic<BehaviorTreeNodeStatus> mStatus = BehaviorTreeNodeStatus::IDLE;
+    };
+
+    AsyncNode::AsyncNode(const std::string& name, const BehaviorTreeNodeConfiguration& config)
+        : Node(name, config)
+    {
+    }
+
+    AsyncNode::~AsyncNode()
+    {
+        Cancel();
+    }
+
+    BehaviorTreeNodeStatus AsyncNode::Complete(const BehaviorTreeNodeStatus status)
+    {
+        return status;
+    }
+
+    void AsyncNode::Start()
+    {
+        Work work = CreateWork();
+        if (!work)
+            return;
+
+        _job = AZStd::make_shared<JobState>();
+
+        // Jobs are allocated from the job system pool, so starting a node doesn't create a thread. The job only
+        // uses the work and its state, so it doesn't depend on the lifetime of the node.
+        auto* job = AZ::CreateJobFunction(
+            [state = _job, work = AZStd::move(work)]() -> void
+            {
+                state->mStatus = work(state->mCancelRequested);
+                state->mRunning = false;
+            },
+            true);
+
+        job->Start();
+    }
+
+    BehaviorTreeNodeStatus AsyncNode::Tick()
+    {
+        if (_job == nullptr)
+            return BehaviorTreeNodeStatus::FAILURE;
+
+        if (_job->mRunning)
+            return BehaviorTreeNodeStatus::RUNNING;
+
+        const BehaviorTreeNodeStatus status = _job->mStatus;
+        _job.reset();
+
+        return Complete(status);
+    }
+
+    void AsyncNode::Finish()
+    {
+        Cancel();
+    }
+
+    void AsyncNode::Cancel()
+    {
+        // Cooperative cancellation, a running job notices it through its flag and its result is dropped. A new run
+        // doesn't wait for it, since it gets its own state.
+        if (_job != nullptr)
+        {
+            _job->mCancelRequested = true;
+            _job.reset();
+        }
+    }
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
@@ -16,10 +16,86 @@
 
 #include <SparkyStudios/AI/Behave/BehaviorTree/Core/Factory.h>
 
+#include <AzCore/XML/rapidxml.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace SparkyStudios::AI::Behave::BehaviorTree::Core
 {
+    using XmlNode = AZ::rapidxml::xml_node<char>;
+
+    // Guards against subtrees referencing themselves, which BT::Tree creation rejects anyway.
+    static constexpr AZ::u32 kMaxSubTreeDepth = 32;
+
+    static const XmlNode* FindBehaviorTree(const XmlNode* root, const char* id)
+    {
+        for (const XmlNode* tree = root->first_node("BehaviorTree"); tree != nullptr; tree = tree->next_sibling("BehaviorTree"))
+        {
+            const auto* treeId = tree->first_attribute("ID");
+            if (id == nullptr || (treeId != nullptr && strcmp(treeId->value(), id) == 0))
+                return tree;
+        }
+
+        return nullptr;
+    }
+
+    static bool IsLazySubTree(const XmlNode* subTree)
+    {
+        const auto* lazy = subTree->first_attribute("__lazy");
+        if (lazy == nullptr)
+            return false;
+
+        // The footprint is only an estimate, invalid values are reported when the tree is created.
+        try
+        {
+            return BT::convertFromString<bool>(lazy->value());
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    static AZStd::size_t ComputeFootprint(const Registry& registry, const XmlNode* root, const XmlNode* element, const AZ::u32 depth)
+    {
+        AZStd::size_t footprint = 0;
+
+        for (const XmlNode* child = element->first_node(); child != nullptr; child = child->next_sibling())
+        {
+            if (child->type() != AZ::rapidxml::node_element)
+                continue;
+
+            // Nodes are written either with their registration ID as the tag, or with their category and an ID attribute.
+            const char* name = child->name();
+            if (strcmp(name, "Action") == 0 || strcmp(name, "Condition") == 0 || strcmp(name, "Decorator") == 0 ||
+                strcmp(name, "Control") == 0 || strcmp(name, "SubTree") == 0 || strcmp(name, "SubTreePlus") == 0)
+            {
+                if (const auto* id = child->first_attribute("ID"))
+                {
+                    if (strcmp(name, "SubTree") == 0 || strcmp(name, "SubTreePlus") == 0)
+                    {
+                        // Lazy subtrees are instantiated when first ticked, outside of the arena.
+                        if (IsLazySubTree(child))
+                            continue;
+
+                        if (const XmlNode* subTree = FindBehaviorTree(root, id->value()); subTree != nullptr && depth < kMaxSubTreeDepth)
+                            footprint += ComputeFootprint(registry, root, subTree, depth + 1);
+
+                        continue;
+                    }
+
+                    name = id->value();
+                }
+            }
+
+            if (const AZStd::size_t size = registry.GetNodeSize(name); size > 0)
+                footprint += NodeArena::GetNodeFootprint(size);
+
+            footprint += ComputeFootprint(registry, root, child, depth);
+        }
+
+        return footprint;
+    }
+
     Factory::Factory(Registry* registry)
     {
         if (registry)
@@ -47,12 +123,12 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
         return nullptr;
     }
 
-    AZStd::unique_ptr<Node> Factory::CreateNode(
+    AZStd::unique_ptr<BT::TreeNode> Factory::CreateNode(
         const AZStd::string& name, const AZStd::string& instanceName, const BehaviorTreeNodeConfiguration& config) const
     {
         if (const auto findIt = _registry->_registeredNodeBuilders.find(name); findIt != _registry->_registeredNodeBuilders.end())
         {
-            AZStd::unique_ptr<Node> node = findIt->second(instanceName.c_str(), config);
+            AZStd::unique_ptr<BT::TreeNode> node = findIt->second(instanceName.c_str(), config);
             node->setRegistrationID(name.c_str());
             return node;
         }
@@ -65,4 +141,37 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
     {
         return _registry->_factory->createTreeFromText(text.c_str(), blackboard.mBlackboard);
     }
+
+    BT::Tree Factory::CreateTreeFromText(const AZStd::string& text, const Blackboard::Blackboard& blackboard, NodeArena& arena) const
+    {
+        return CreateTreeFromText(text, blackboard, arena, GetTreeFootprint(text));
+    }
+
+    BT::Tree Factory::CreateTreeFromText(
+        const AZStd::string& text, const Blackboard::Blackboard& blackboard, NodeArena& arena, const AZStd::size_t footprint) const
+    {
+        arena.Reserve(footprint);
+
+        NodeArena::Scope scope(arena);
+        return _registry->_factory->createTreeFromText(text.c_str(), blackboard.mBlackboard);
+    }
+
+    AZStd::size_t Factory::GetTreeFootprint(const AZStd::string& text) const
+    {
+        // The parser works in place, so it needs its own copy of the text.
+        AZStd::string xml = text;
+
+        AZ::rapidxml::xml_document<char> doc;
+        if (!doc.parse<0>(xml.data()))
+            return 0;
+
+        const XmlNode* root = doc.first_node("root");
+        if (root == nullptr)
+            return 0;
+
+        const auto* mainTreeId = root->first_attribute("main_tree_to_execute");
+        const XmlNode* mainTree = FindBehaviorTree(root, mainTreeId != nullptr ? mainTreeId->value() : nullptr);
+
+        return mainTree != nullptr ? ComputeFootprint(*_registry, root, mainTree, 0) : 0;
+    }
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
@@ -0,0 +1,379 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StdAfx.h>
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/FlatTree.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    static constexpr const char* kRepeatCyclesPort = "num_cycles";
+    static constexpr const char* kRetryAttemptsPort = "num_attempts";
+
+    /**
+     * @brief Gives access to the status of any node, which BT::TreeNode only exposes to derived classes.
+     */
+    class TreeNodeStatusAccess : public BT::TreeNode
+    {
+    public:
+        static void ResetStatus(BT::TreeNode* node)
+        {
+            (node->*(&TreeNodeStatusAccess::setStatus))(BehaviorTreeNodeStatus::IDLE);
+        }
+    };
+
+    // Reads the constant value of a count port. Ports mapped to the blackboard can change, so they can't be compiled.
+    static bool GetConstantCount(const BT::TreeNode* node, const char* port, AZ::s32& count)
+    {
+        const auto& ports = node->config().input_ports;
+
+        const auto it = ports.find(port);
+        if (it == ports.end() || BT::TreeNode::getRemappedKey(it->first, it->second))
+            return false;
+
+        try
+        {
+            count = BT::convertFromString<int>(it->second);
+            return true;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    bool FlatTree::Compile(BT::TreeNode* root)
+    {
+        Clear();
+
+        if (root == nullptr)
+            return false;
+
+        Append(root);
+        _states.resize(_nodes.size());
+
+        for (AZ::u32 i = 0; i < _nodes.size(); ++i)
+            ResetCursor(i);
+
+        return true;
+    }
+
+    void FlatTree::Clear()
+    {
+        _nodes.clear();
+        _states.clear();
+    }
+
+    bool FlatTree::IsCompiled() const
+    {
+        return !_nodes.empty();
+    }
+
+    BehaviorTreeNodeStatus FlatTree::Tick()
+    {
+        if (_nodes.empty())
+            return BehaviorTreeNodeStatus::IDLE;
+
+        const BehaviorTreeNodeStatus status = Execute(0);
+
+        // Like BT::Tree::tickRoot(), so the tree starts again on the next tick.
+        if (status != BehaviorTreeNodeStatus::RUNNING)
+        {
+            _states[0].mStatus = BehaviorTreeNodeStatus::IDLE;
+
+            if (_nodes[0].mOpcode == Opcode::Leaf)
+                TreeNodeStatusAccess::ResetStatus(_nodes[0].mNode);
+        }
+
+        return status;
+    }
+
+    void FlatTree::Halt()
+    {
+        if (!_nodes.empty())
+            HaltNode(0);
+    }
+
+    AZ::u32 FlatTree::GetNodesCount() const
+    {
+        return aznumeric_cast<AZ::u32>(_nodes.size());
+    }
+
+    void FlatTree::Append(BT::TreeNode* node)
+    {
+        const auto index = aznumeric_cast<AZ::u32>(_nodes.size());
+
+        FlatNode& flatNode = _nodes.emplace_back();
+        flatNode.mNode = node;
+        flatNode.mOpcode = Opcode::Leaf;
+
+        AZ::s32 parameter = 0;
+
+        if (dynamic_cast<BT::SequenceStarNode*>(node))
+            flatNode.mOpcode = Opcode::SequenceStar;
+        else if (dynamic_cast<BT::SequenceNode*>(node))
+            flatNode.mOpcode = Opcode::Sequence;
+        else if (dynamic_cast<BT::FallbackNode*>(node))
+            flatNode.mOpcode = Opcode::Fallback;
+        else if (dynamic_cast<BT::ReactiveSequence*>(node))
+            flatNode.mOpcode = Opcode::ReactiveSequence;
+        else if (dynamic_cast<BT::ReactiveFallback*>(node))
+            flatNode.mOpcode = Opcode::ReactiveFallback;
+        else if (dynamic_cast<BT::InverterNode*>(node))
+            flatNode.mOpcode = Opcode::Inverter;
+        else if (dynamic_cast<BT::ForceSuccessNode*>(node))
+            flatNode.mOpcode = Opcode::ForceSuccess;
+        else if (dynamic_cast<BT::ForceFailureNode*>(node))
+            flatNode.mOpcode = Opcode::ForceFailure;
+        else if (dynamic_cast<BT::SubtreeNode*>(node) || dynamic_cast<BT::SubtreePlusNode*>(node))
+            flatNode.mOpcode = Opcode::Passthrough;
+        else if (dynamic_cast<BT::RepeatNode*>(node) && GetConstantCount(node, kRepeatCyclesPort, parameter))
+            flatNode.mOpcode = Opcode::Repeat;
+        else if (dynamic_cast<BT::RetryNode*>(node) && GetConstantCount(node, kRetryAttemptsPort, parameter))
+            flatNode.mOpcode = Opcode::Retry;
+
+        flatNode.mParameter = parameter;
+
+        // The reference to the node is invalidated by the children appended below.
+        if (_nodes[index].mOpcode != Opcode::Leaf)
+        {
+            if (auto* control = dynamic_cast<BT::ControlNode*>(node))
+            {
+                for (BT::TreeNode* child : control->children())
+                    Append(child);
+            }
+            else if (auto* decorator = dynamic_cast<BT::DecoratorNode*>(node); decorator != nullptr && decorator->child() != nullptr)
+            {
+                Append(decorator->child());
+            }
+        }
+
+        _nodes[index].mEnd = aznumeric_cast<AZ::u32>(_nodes.size());
+    }
+
+    BehaviorTreeNodeStatus FlatTree::Execute(const AZ::u32 index)
+    {
+        const BehaviorTreeNodeStatus status = Run(index);
+        _states[index].mStatus = status;
+
+        return status;
+    }
+
+    BehaviorTreeNodeStatus FlatTree::Run(const AZ::u32 index)
+    {
+        const FlatNode& node = _nodes[index];
+        FlatNodeState& state = _states[index];
+
+        const AZ::u32 firstChild = index + 1;
+
+        switch (node.mOpcode)
+        {
+        case Opcode::Leaf:
+            return node.mNode->executeTick();
+
+        case Opcode::Sequence:
+        case Opcode::SequenceStar:
+            {
+                while (state.mCursor < node.mEnd)
+                {
+                    const AZ::u32 child = state.mCursor;
+                    const BehaviorTreeNodeStatus status = Execute(child);
+
+                    if (status == BehaviorTreeNodeStatus::RUNNING)
+                        return status;
+
+                    if (status == BehaviorTreeNodeStatus::FAILURE)
+                    {
+                        // SequenceStar keeps its current child on failure, to start again from it.
+                        if (node.mOpcode == Opcode::Sequence)
+                        {
+                            HaltChildren(index, firstChild);
+                            state.mCursor = firstChild;
+                        }
+                        else
+                        {
+                            HaltChildren(index, child);
+                        }
+
+                        return status;
+                    }
+
+                    state.mCursor = _nodes[child].mEnd;
+                }
+
+                HaltChildren(index, firstChild);
+                state.mCursor = firstChild;
+
+                return BehaviorTreeNodeStatus::SUCCESS;
+            }
+
+        case Opcode::Fallback:
+            {
+                while (state.mCursor < node.mEnd)
+                {
+                    const AZ::u32 child = state.mCursor;
+                    const BehaviorTreeNodeStatus status = Execute(child);
+
+                    if (status == BehaviorTreeNodeStatus::RUNNING)
+                        return status;
+
+                    if (status == BehaviorTreeNodeStatus::SUCCESS)
+                    {
+                        HaltChildren(index, firstChild);
+                        state.mCursor = firstChild;
+                        return status;
+                    }
+
+                    state.mCursor = _nodes[child].mEnd;
+                }
+
+                HaltChildren(index, firstChild);
+                state.mCursor = firstChild;
+
+                return BehaviorTreeNodeStatus::FAILURE;
+            }
+
+        case Opcode::ReactiveSequence:
+        case Opcode::ReactiveFallback:
+            {
+                // A reactive sequence stops on the first failure, and a reactive fallback on the first success.
+                const BehaviorTreeNodeStatus stopStatus = node.mOpcode == Opcode::ReactiveSequence ? BehaviorTreeNodeStatus::FAILURE
+                                                                                                   : BehaviorTreeNodeStatus::SUCCESS;
+
+                for (AZ::u32 child = firstChild; child < node.mEnd; child = _nodes[child].mEnd)
+                {
+                    const BehaviorTreeNodeStatus status = Execute(child);
+
+                    if (status == BehaviorTreeNodeStatus::RUNNING)
+                    {
+                        HaltChildren(index, _nodes[child].mEnd);
+                        return status;
+                    }
+
+                    if (status == stopStatus)
+                    {
+                        HaltChildren(index, firstChild);
+                        return status;
+                    }
+                }
+
+                HaltChildren(index, firstChild);
+
+                return node.mOpcode == Opcode::ReactiveSequence ? BehaviorTreeNodeStatus::SUCCESS : BehaviorTreeNodeStatus::FAILURE;
+            }
+
+        case Opcode::Inverter:
+            {
+                const BehaviorTreeNodeStatus status = Execute(firstChild);
+
+                if (status == BehaviorTreeNodeStatus::SUCCESS)
+                    return BehaviorTreeNodeStatus::FAILURE;
+
+                if (status == BehaviorTreeNodeStatus::FAILURE)
+                    return BehaviorTreeNodeStatus::SUCCESS;
+
+                return status;
+            }
+
+        case Opcode::ForceSuccess:
+        case Opcode::ForceFailure:
+            {
+                const BehaviorTreeNodeStatus status = Execute(firstChild);
+
+                if (status == BehaviorTreeNodeStatus::RUNNING)
+                    return status;
+
+                return node.mOpcode == Opcode::ForceSuccess ? BehaviorTreeNodeStatus::SUCCESS : BehaviorTreeNodeStatus::FAILURE;
+            }
+
+        case Opcode::Repeat:
+        case Opcode::Retry:
+            {
+                // Repeat runs its child until it fails, and Retry until it succeeds.
+                const BehaviorTreeNodeStatus stopStatus =
+                    node.mOpcode == Opcode::Repeat ? BehaviorTreeNodeStatus::FAILURE : BehaviorTreeNodeStatus::SUCCESS;
+
+                while (node.mParameter == -1 || state.mCursor < aznumeric_cast<AZ::u32>(node.mParameter))
+                {
+                    const BehaviorTreeNodeStatus status = Execute(firstChild);
+
+                    if (status == BehaviorTreeNodeStatus::RUNNING)
+                        return status;
+
+                    HaltNode(firstChild);
+
+                    if (status == stopStatus)
+                    {
+                        state.mCursor = 0;
+                        return status;
+                    }
+
+                    ++state.mCursor;
+                }
+
+                state.mCursor = 0;
+
+                return node.mOpcode == Opcode::Repeat ? BehaviorTreeNodeStatus::SUCCESS : BehaviorTreeNodeStatus::FAILURE;
+            }
+
+        case Opcode::Passthrough:
+            return firstChild < node.mEnd ? Execute(firstChild) : BehaviorTreeNodeStatus::SUCCESS;
+        }
+
+        return BehaviorTreeNodeStatus::FAILURE;
+    }
+
+    void FlatTree::HaltNode(const AZ::u32 index)
+    {
+        const FlatNode& node = _nodes[index];
+        FlatNodeState& state = _states[index];
+
+        if (node.mOpcode == Opcode::Leaf)
+        {
+            // Same as BT::ControlNode::haltChild().
+            if (node.mNode->status() == BehaviorTreeNodeStatus::RUNNING)
+                node.mNode->halt();
+
+            TreeNodeStatusAccess::ResetStatus(node.mNode);
+        }
+        else if (state.mStatus == BehaviorTreeNodeStatus::RUNNING)
+        {
+            HaltChildren(index, index + 1);
+            ResetCursor(index);
+        }
+
+        state.mStatus = BehaviorTreeNodeStatus::IDLE;
+    }
+
+    void FlatTree::HaltChildren(const AZ::u32 index, const AZ::u32 first)
+    {
+        for (AZ::u32 child = first; child < _nodes[index].mEnd; child = _nodes[child].mEnd)
+            HaltNode(child);
+    }
+
+    void FlatTree::ResetCursor(const AZ::u32 index)
+    {
+        switch (_nodes[index].mOpcode)
+        {
+        case Opcode::Sequence:
+        case Opcode::SequenceStar:
+        case Opcode::Fallback:
+            _states[index].mCursor = index + 1;
+            break;
+        default:
+            _states[index].mCursor = 0;
+            break;
+        }
+    }
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
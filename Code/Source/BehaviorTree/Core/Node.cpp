@@ -14,10 +14,87 @@
 
 #include <StdAfx.h>
 
+#include <SparkyStudios/AI/Behave/BehaviorTree/BehaveBehaviorTreeBus.h>
 #include <SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h>
 
 namespace SparkyStudios::AI::Behave::BehaviorTree::Core
 {
+    void ConstantPortValues::Build(const BehaviorTreePortsList& ports, const BehaviorTreeNodeConfiguration& config)
+    {
+        _ports.clear();
+
+        for (const auto& [portName, portInfo] : ports)
+        {
+            if (portInfo.direction() == BT::PortDirection::OUTPUT || !portInfo.converter())
+                continue;
+
+            const auto remapIt = config.input_ports.find(portName);
+            if (remapIt == config.input_ports.end() || BT::TreeNode::getRemappedKey(portName, remapIt->second))
+                continue;
+
+            try
+            {
+                _ports.push_back({ portName, portInfo.converter()(remapIt->second) });
+            }
+            catch (const std::exception&)
+            {
+                // Invalid values are not cached, the error is reported when the port is read.
+            }
+        }
+    }
+
+    const BT::Any* ConstantPortValues::Find(const AZStd::string& id) const
+    {
+        for (const ConstantPort& port : _ports)
+        {
+            if (id == port.mName.c_str())
+                return &port.mValue;
+        }
+
+        return nullptr;
+    }
+
+    BT::Blackboard::Entry* BlackboardPortEntries::FindInput(const AZStd::string& id, const BehaviorTreeNodeConfiguration& config) const
+    {
+        return Find(id, config, config.input_ports, _inputs);
+    }
+
+    BT::Blackboard::Entry* BlackboardPortEntries::FindOutput(const AZStd::string& id, const BehaviorTreeNodeConfiguration& config) const
+    {
+        return Find(id, config, config.output_ports, _outputs);
+    }
+
+    BT::Blackboard::Entry* BlackboardPortEntries::Find(
+        const AZStd::string& id,
+        const BehaviorTreeNodeConfiguration& config,
+        const BT::PortsRemapping& remapping,
+        AZStd::vector<PortEntry>& entries)
+    {
+        if (!config.blackboard || !config.blackboard->isSingleOwner())
+            return nullptr;
+
+        for (const PortEntry& port : entries)
+        {
+            if (id == port.mName.c_str())
+                return port.mEntry;
+        }
+
+        const auto remapIt = remapping.find(id.c_str());
+        if (remapIt == remapping.end())
+            return nullptr;
+
+        const auto key = BT::TreeNode::getRemappedKey(remapIt->first, remapIt->second);
+        if (!key)
+            return nullptr;
+
+        // Entries are never removed from the blackboard storage, so their address is stable.
+        BT::Blackboard::Entry* entry = config.blackboard->getEntry(static_cast<std::string>(key.value()));
+        if (entry != nullptr)
+            entries.push_back({ remapIt->first, entry });
+
+        return entry;
+    }
+
     Node::Node(const std::string& name, const BehaviorTreeNodeConfiguration& config)
         : BT::StatefulActionNode(name, config)
         , _started(false)
@@ -110,13 +187,124 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
     {
     }
 
+    BehaviorTreePortsList BehaviorTreeConditionNode::providedPorts()
+    {
+        return {};
+    }
+
+    std::string BehaviorTreeConditionNode::NodeCategory() const
+    {
+        return std::string();
+    }
+
+    AZ::EntityId BehaviorTreeConditionNode::GetEntityId() const
+    {
+        auto id = AZ::EntityId();
+        config().blackboard->get<AZ::EntityId>("entityId", id);
+
+        return id;
+    }
+
+    void BehaviorTreeConditionNode::AddBlackboardDependency(const AZStd::string& key)
+    {
+        std::string entryKey = key.c_str();
+
+        if (const auto remapIt = config().input_ports.find(entryKey); remapIt != config().input_ports.end())
+        {
+            const auto remappedKey = BT::TreeNode::getRemappedKey(remapIt->first, remapIt->second);
+
+            // Constant ports never change.
+            if (!remappedKey)
+                return;
+
+            entryKey = static_cast<std::string>(remappedKey.value());
+        }
+
+        _dependencies.push_back({ AZStd::move(entryKey), nullptr, 0 });
+        _hasResult = false;
+    }
+
+    bool BehaviorTreeConditionNode::HaveDependenciesChanged()
+    {
+        const BT::Blackboard::Ptr& blackboard = config().blackboard;
+        bool changed = !_hasResult;
+
+        for (BlackboardDependency& dependency : _dependencies)
+        {
+            AZ::u64 sequenceId;
+
+            // Local entries of single owner blackboards are cached, like the ports of the nodes. Shared entries are
+            // looked up each time, since they are replaced when the shared blackboards are committed.
+            if (blackboard->isSingleOwner())
+            {
+                if (dependency.mEntry == nullptr)
+                    dependency.mEntry = blackboard->getEntry(dependency.mKey);
+
+                sequenceId = blackboard->getSequenceId(dependency.mKey, dependency.mEntry);
+            }
+            else
+            {
+                sequenceId = blackboard->getSequenceId(dependency.mKey);
+            }
+
+            if (sequenceId != dependency.mSequenceId)
+            {
+                dependency.mSequenceId = sequenceId;
+                changed = true;
+            }
+        }
+
+        return changed;
+    }
+
     BehaviorTreeNodeStatus BehaviorTreeConditionNode::tick()
     {
-        return Condition() ? BehaviorTreeNodeStatus::SUCCESS : BehaviorTreeNodeStatus::FAILURE;
+        if (_dependencies.empty())
+            return Condition() ? BehaviorTreeNodeStatus::SUCCESS : BehaviorTreeNodeStatus::FAILURE;
+
+        if (HaveDependenciesChanged())
+        {
+            _result = Condition();
+            _hasResult = true;
+        }
+
+        return _result ? BehaviorTreeNodeStatus::SUCCESS : BehaviorTreeNodeStatus::FAILURE;
     }
 
     std::string Node::NodeCategory() const
     {
         return std::string();
     }
+
+    BehaviorTreeDecoratorNode::BehaviorTreeDecoratorNode(const std::string& name, const BehaviorTreeNodeConfiguration& config)
+        : BT::DecoratorNode(name, config)
+    {
+    }
+
+    BehaviorTreePortsList BehaviorTreeDecoratorNode::providedPorts()
+    {
+        return {};
+    }
+
+    std::string BehaviorTreeDecoratorNode::NodeCategory() const
+    {
+        return std::string();
+    }
+
+    TimerWheel* BehaviorTreeDecoratorNode::GetTimerWheel()
+    {
+        BehaveBehaviorTreeRequests* const requests = BehaveBehaviorTreeInterface::Get();
+        return requests != nullptr ? &requests->GetTimerWheel() : nullptr;
+    }
+
+    void BehaviorTreeDecoratorNode::CancelTimer(TimerWheel::TimerId& id)
+    {
+        if (id == TimerWheel::InvalidTimerId)
+            return;
+
+        if (TimerWheel* const wheel = GetTimerWheel())
+            wheel->Cancel(id);
+
+        id = TimerWheel::InvalidTimerId;
+    }
 } // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
@@ -0,0 +1,121 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StdAfx.h>
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/NodeArena.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    static thread_local NodeArena* sCurrentArena = nullptr;
+
+    NodeArena::Scope::Scope(NodeArena& arena)
+        : _previous(sCurrentArena)
+    {
+        sCurrentArena = &arena;
+    }
+
+    NodeArena::Scope::~Scope()
+    {
+        sCurrentArena = _previous;
+    }
+
+    NodeArena::~NodeArena()
+    {
+        Reset();
+    }
+
+    void NodeArena::Reserve(const AZStd::size_t size)
+    {
+        Reset();
+
+        if (size == 0)
+            return;
+
+        _block = aznew Block();
+        _block->mMemory = static_cast<char*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(size, Alignment));
+        _block->mCapacity = size;
+    }
+
+    void NodeArena::Reset()
+    {
+        if (_block == nullptr)
+            return;
+
+        Release(_block);
+        _block = nullptr;
+    }
+
+    AZStd::size_t NodeArena::GetCapacity() const
+    {
+        return _block != nullptr ? _block->mCapacity : 0;
+    }
+
+    AZStd::size_t NodeArena::GetUsedSize() const
+    {
+        return _block != nullptr ? _block->mUsed : 0;
+    }
+
+    void* NodeArena::AllocateNode(const AZStd::size_t size)
+    {
+        const AZStd::size_t footprint = GetNodeFootprint(size);
+
+        char* memory = nullptr;
+        Block* block = nullptr;
+
+        if (sCurrentArena != nullptr && sCurrentArena->_block != nullptr)
+        {
+            // Nodes are only created from the thread owning the scope, the block doesn't need to be synchronized.
+            if (Block* current = sCurrentArena->_block; current->mUsed + footprint <= current->mCapacity)
+            {
+                block = current;
+                memory = current->mMemory + current->mUsed;
+                current->mUsed += footprint;
+                ++current->mReferences;
+            }
+        }
+
+        if (memory == nullptr)
+            memory = static_cast<char*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(footprint, Alignment));
+
+        reinterpret_cast<NodeHeader*>(memory)->mBlock = block;
+        return memory + kHeaderSize;
+    }
+
+    void NodeArena::DeallocateNode(void* pointer)
+    {
+        if (pointer == nullptr)
+            return;
+
+        char* memory = static_cast<char*>(pointer) - kHeaderSize;
+
+        if (Block* block = reinterpret_cast<NodeHeader*>(memory)->mBlock)
+        {
+            Release(block);
+        }
+        else
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(memory);
+        }
+    }
+
+    void NodeArena::Release(Block* block)
+    {
+        if (--block->mReferences != 0)
+            return;
+
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(block->mMemory);
+        delete block;
+    }
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
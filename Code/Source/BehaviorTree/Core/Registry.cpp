@@ -51,6 +51,14 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Core
         return InvalidUuid;
     }
 
+    AZStd::size_t Registry::GetNodeSize(const AZStd::string& type) const
+    {
+        if (const auto findIt = _registeredNodeSize.find(type); findIt != _registeredNodeSize.end())
+            return findIt->second;
+
+        return 0;
+    }
+
     void Registry::EnableNodes(const AZStd::vector<AZStd::string>& nodes)
     {
         AZ::SerializeContext* serializeContext = nullptr;
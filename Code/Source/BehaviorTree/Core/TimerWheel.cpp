@@ -0,0 +1,214 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StdAfx.h>
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/TimerWheel.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    TimerWheel::TimerWheel()
+    {
+        _slots.fill(kInvalidIndex);
+    }
+
+    TimerWheel::TimerId TimerWheel::Schedule(const float delay, Callback callback)
+    {
+        AZ::u32 index;
+        if (!_freeTimers.empty())
+        {
+            index = _freeTimers.back();
+            _freeTimers.pop_back();
+        }
+        else
+        {
+            index = aznumeric_cast<AZ::u32>(_timers.size());
+            _timers.emplace_back();
+        }
+
+        // Round up, so a timer never expires before its delay. Timers without delay expire on the next tick.
+        const double ticks = AZStd::ceil((AZStd::max(0.0f, delay) + _remainder) / TickDuration);
+
+        Timer& timer = _timers[index];
+        timer.mDeadline = _currentTick + AZStd::max<AZ::u64>(1, aznumeric_cast<AZ::u64>(AZStd::max(0.0, ticks)));
+        timer.mCallback = AZStd::move(callback);
+
+        Insert(index);
+        ++_pendingCount;
+
+        return (aznumeric_cast<TimerId>(timer.mGeneration) << 32) | index;
+    }
+
+    bool TimerWheel::Cancel(const TimerId id)
+    {
+        const AZ::u32 index = aznumeric_cast<AZ::u32>(id & 0xFFFFFFFF);
+        const AZ::u32 generation = aznumeric_cast<AZ::u32>(id >> 32);
+
+        if (id == InvalidTimerId || index >= _timers.size())
+            return false;
+
+        const Timer& timer = _timers[index];
+        if (timer.mGeneration != generation || timer.mSlot == kInvalidIndex)
+            return false;
+
+        Unlink(index);
+        Release(index);
+
+        return true;
+    }
+
+    void TimerWheel::Advance(const float deltaTime)
+    {
+        _remainder += AZStd::max(0.0f, deltaTime);
+
+        const auto ticks = aznumeric_cast<AZ::u64>(_remainder / TickDuration);
+        _remainder -= aznumeric_cast<double>(ticks) * TickDuration;
+
+        for (AZ::u64 i = 0; i < ticks; ++i)
+        {
+            ++_currentTick;
+
+            // Move the timers of the coarser wheels down, when the finer wheel completes a turn.
+            for (AZ::u32 level = 1; level < kLevelsCount; ++level)
+            {
+                if ((_currentTick & ((AZ::u64(1) << (kSlotBits * level)) - 1)) != 0)
+                    break;
+
+                Cascade(level);
+            }
+
+            // Nothing is pending, skip the remaining ticks.
+            if (_pendingCount == 0)
+            {
+                _currentTick += ticks - i - 1;
+                break;
+            }
+
+            AZ::u32& head = _slots[_currentTick & kSlotMask];
+
+            while (head != kInvalidIndex)
+            {
+                const AZ::u32 index = head;
+                Unlink(index);
+
+                Timer& timer = _timers[index];
+                if (timer.mDeadline > _currentTick)
+                {
+                    Insert(index);
+                    continue;
+                }
+
+                // Release the timer before running the callback, which may schedule new timers.
+                Callback callback = AZStd::move(timer.mCallback);
+                Release(index);
+
+                if (callback)
+                    callback();
+            }
+        }
+    }
+
+    void TimerWheel::Clear()
+    {
+        for (AZ::u32 index = 0; index < _timers.size(); ++index)
+        {
+            if (_timers[index].mSlot != kInvalidIndex)
+            {
+                Unlink(index);
+                Release(index);
+            }
+        }
+    }
+
+    double TimerWheel::GetTime() const
+    {
+        return aznumeric_cast<double>(_currentTick) * TickDuration + _remainder;
+    }
+
+    AZ::u32 TimerWheel::GetPendingCount() const
+    {
+        return _pendingCount;
+    }
+
+    void TimerWheel::Insert(const AZ::u32 index)
+    {
+        Timer& timer = _timers[index];
+
+        // Timers too far in the future wait in the last wheel, and are moved down when it turns.
+        const AZ::u64 maxDelta = (AZ::u64(1) << (kSlotBits * kLevelsCount)) - 1;
+        const AZ::u64 deadline = AZStd::min(timer.mDeadline, _currentTick + maxDelta);
+        const AZ::u64 delta = deadline - _currentTick;
+
+        AZ::u32 level = 0;
+        while (level + 1 < kLevelsCount && delta >= (AZ::u64(1) << (kSlotBits * (level + 1))))
+            ++level;
+
+        const AZ::u32 slot = level * kSlotsCount + aznumeric_cast<AZ::u32>((deadline >> (kSlotBits * level)) & kSlotMask);
+
+        timer.mSlot = slot;
+        timer.mPrevious = kInvalidIndex;
+        timer.mNext = _slots[slot];
+
+        if (timer.mNext != kInvalidIndex)
+            _timers[timer.mNext].mPrevious = index;
+
+        _slots[slot] = index;
+    }
+
+    void TimerWheel::Unlink(const AZ::u32 index)
+    {
+        Timer& timer = _timers[index];
+
+        if (timer.mPrevious != kInvalidIndex)
+            _timers[timer.mPrevious].mNext = timer.mNext;
+        else
+            _slots[timer.mSlot] = timer.mNext;
+
+        if (timer.mNext != kInvalidIndex)
+            _timers[timer.mNext].mPrevious = timer.mPrevious;
+
+        timer.mPrevious = kInvalidIndex;
+        timer.mNext = kInvalidIndex;
+        timer.mSlot = kInvalidIndex;
+    }
+
+    void TimerWheel::Release(const AZ::u32 index)
+    {
+        Timer& timer = _timers[index];
+        timer.mCallback = nullptr;
+
+        // Outdated IDs of this timer don't match anymore.
+        ++timer.mGeneration;
+        if (timer.mGeneration == 0)
+            timer.mGeneration = 1;
+
+        _freeTimers.push_back(index);
+        --_pendingCount;
+    }
+
+    void TimerWheel::Cascade(const AZ::u32 level)
+    {
+        const AZ::u32 slot = level * kSlotsCount + aznumeric_cast<AZ::u32>((_currentTick >> (kSlotBits * level)) & kSlotMask);
+
+        AZ::u32 index = _slots[slot];
+        _slots[slot] = kInvalidIndex;
+
+        while (index != kInvalidIndex)
+        {
+            const AZ::u32 next = _timers[index].mNext;
+            Insert(index);
+            index = next;
+        }
+    }
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
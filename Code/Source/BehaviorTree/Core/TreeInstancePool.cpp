@@ -0,0 +1,154 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StdAfx.h>
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/TreeInstancePool.h>
+
+#include <AzCore/std/algorithm.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Core
+{
+    void TreeInstancePool::SetCapacity(const AZ::u32 capacity)
+    {
+        _capacity = capacity;
+
+        for (auto& [assetId, pool] : _pools)
+        {
+            for (ModePool& modePool : pool.mModes)
+            {
+                if (modePool.mTrees.size() > _capacity)
+                    modePool.mTrees.resize(_capacity);
+            }
+        }
+    }
+
+    AZ::u32 TreeInstancePool::GetCapacity() const
+    {
+        return _capacity;
+    }
+
+    bool TreeInstancePool::Acquire(const AZ::Data::AssetId& assetId, const bool singleOwner, BT::Tree& tree)
+    {
+        const auto findIt = _pools.find(assetId);
+        if (findIt == _pools.end())
+            return false;
+
+        ModePool& pool = findIt->second.mModes[singleOwner];
+        if (pool.mTrees.empty())
+            return false;
+
+        tree = AZStd::move(*pool.mTrees.back());
+        pool.mTrees.pop_back();
+
+        return true;
+    }
+
+    bool TreeInstancePool::Release(const AZ::Data::AssetId& assetId, BT::Tree&& tree)
+    {
+        bool singleOwner = false;
+        if (!assetId.IsValid() || tree.rootNode() == nullptr || !GetSingleOwner(tree, singleOwner))
+            return false;
+
+        ModePool& pool = _pools[assetId].mModes[singleOwner];
+        if (pool.mTrees.size() >= _capacity)
+            return false;
+
+        Reset(tree);
+        pool.mTrees.push_back(AZStd::make_unique<BT::Tree>(AZStd::move(tree)));
+
+        return true;
+    }
+
+    void TreeInstancePool::Prewarm(
+        const AZ::Data::AssetId& assetId, const bool singleOwner, const AZ::u32 count, const TreeBuilder& builder)
+    {
+        if (!assetId.IsValid())
+            return;
+
+        ModePool& pool = _pools[assetId].mModes[singleOwner];
+        if (pool.mPrewarmed)
+            return;
+
+        pool.mPrewarmed = true;
+
+        const AZ::u32 target = AZStd::min(count, _capacity);
+        while (pool.mTrees.size() < target)
+        {
+            auto tree = AZStd::make_unique<BT::Tree>(builder());
+
+            bool treeSingleOwner = false;
+            if (tree->rootNode() == nullptr || !GetSingleOwner(*tree, treeSingleOwner) || treeSingleOwner != singleOwner)
+                break;
+
+            Reset(*tree);
+            pool.mTrees.push_back(AZStd::move(tree));
+        }
+    }
+
+    AZ::u32 TreeInstancePool::GetPooledCount(const AZ::Data::AssetId& assetId, const bool singleOwner) const
+    {
+        if (const auto findIt = _pools.find(assetId); findIt != _pools.end())
+            return aznumeric_cast<AZ::u32>(findIt->second.mModes[singleOwner].mTrees.size());
+
+        return 0;
+    }
+
+    void TreeInstancePool::Clear(const AZ::Data::AssetId& assetId)
+    {
+        _pools.erase(assetId);
+    }
+
+    void TreeInstancePool::Clear()
+    {
+        _pools.clear();
+    }
+
+    void TreeInstancePool::Reset(BT::Tree& tree)
+    {
+        tree.haltTree();
+
+        // Lazy subtrees are instantiated again when the tree is reused and ticks them. Nodes keeping a state across
+        // halts, like cooldowns, must not hand it over to the next owner.
+        for (const BT::TreeNode::Ptr& node : tree.nodes)
+        {
+            if (auto* lazySubTree = dynamic_cast<BT::LazySubtreeNode*>(node.get()))
+                lazySubTree->release();
+            else if (auto* resettable = dynamic_cast<ResettableNode*>(node.get()))
+                resettable->ResetNode();
+        }
+
+        // Entries are kept, so the nodes caching them in single owner blackboards stay valid. Values set when the tree
+        // was built, like the constant ports of SubTreePlus nodes, are restored.
+        for (const BT::Blackboard::Ptr& blackboard : tree.blackboard_stack)
+            blackboard->resetValues();
+    }
+
+    bool TreeInstancePool::GetSingleOwner(const BT::Tree& tree, bool& singleOwner)
+    {
+        if (tree.blackboard_stack.empty())
+            return false;
+
+        // The mode of the root blackboard may have been changed after the subtree blackboards inherited it.
+        singleOwner = tree.blackboard_stack.front()->isSingleOwner();
+
+        return AZStd::all_of(
+            tree.blackboard_stack.begin(), tree.blackboard_stack.end(),
+            [singleOwner](const BT::Blackboard::Ptr& blackboard)
+            {
+                return blackboard->isSingleOwner() == singleOwner;
+            });
+    }
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Core
@@ -0,0 +1,85 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StdAfx.h>
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/CooldownNode.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
+{
+    CooldownNode::CooldownNode(const std::string& name, const Core::BehaviorTreeNodeConfiguration& config)
+        : Core::BehaviorTreeDecoratorNode(name, config)
+    {
+    }
+
+    CooldownNode::~CooldownNode()
+    {
+        CancelTimer(_timerId);
+    }
+
+    void CooldownNode::Reflect(AZ::ReflectContext* rc)
+    {
+        AZ_UNUSED(rc);
+    }
+
+    void CooldownNode::RegisterNode(const AZStd::shared_ptr<Core::Registry>& registry)
+    {
+        // 1 - Add node for delayed registration
+        registry->DelayNodeRegistration<CooldownNode>(NODE_NAME);
+    }
+
+    Core::BehaviorTreePortsList CooldownNode::providedPorts()
+    {
+        Core::BehaviorTreePortsList ports = Core::BehaviorTreeDecoratorNode::providedPorts();
+
+        ports.merge(Core::BehaviorTreePortsList({
+            BT::InputPort<float>(NODE_PORT_SECONDS_NAME, 0, NODE_PORT_SECONDS_DESCRIPTION),
+        }));
+
+        return ports;
+    }
+
+    void CooldownNode::ResetNode()
+    {
+        CancelTimer(_timerId);
+    }
+
+    Core::BehaviorTreeNodeStatus CooldownNode::tick()
+    {
+        // The timer is still pending, the child is cooling down.
+        if (_timerId != Core::TimerWheel::InvalidTimerId)
+            return Core::BehaviorTreeNodeStatus::FAILURE;
+
+        setStatus(Core::BehaviorTreeNodeStatus::RUNNING);
+
+        const Core::BehaviorTreeNodeStatus status = child()->executeTick();
+
+        if (status != Core::BehaviorTreeNodeStatus::RUNNING)
+        {
+            const Core::Optional<float> seconds = GetInputValue<float>(NODE_PORT_SECONDS_NAME);
+
+            if (Core::TimerWheel* const wheel = GetTimerWheel(); seconds.has_value() && seconds.value() > 0 && wheel != nullptr)
+            {
+                _timerId = wheel->Schedule(
+                    seconds.value(),
+                    [this]()
+                    {
+                        _timerId = Core::TimerWheel::InvalidTimerId;
+                    });
+            }
+        }
+
+        return status;
+    }
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
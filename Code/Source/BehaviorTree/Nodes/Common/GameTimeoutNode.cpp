@@ -0,0 +1,108 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StdAfx.h>
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/GameTimeoutNode.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
+{
+    GameTimeoutNode::GameTimeoutNode(const std::string& name, const Core::BehaviorTreeNodeConfiguration& config)
+        : Core::BehaviorTreeDecoratorNode(name, config)
+    {
+    }
+
+    GameTimeoutNode::~GameTimeoutNode()
+    {
+        CancelTimer(_timerId);
+    }
+
+    void GameTimeoutNode::Reflect(AZ::ReflectContext* rc)
+    {
+        AZ_UNUSED(rc);
+    }
+
+    void GameTimeoutNode::RegisterNode(const AZStd::shared_ptr<Core::Registry>& registry)
+    {
+        // 1 - Add node for delayed registration
+        registry->DelayNodeRegistration<GameTimeoutNode>(NODE_NAME);
+    }
+
+    Core::BehaviorTreePortsList GameTimeoutNode::providedPorts()
+    {
+        Core::BehaviorTreePortsList ports = Core::BehaviorTreeDecoratorNode::providedPorts();
+
+        ports.merge(Core::BehaviorTreePortsList({
+            BT::InputPort<float>(NODE_PORT_SECONDS_NAME, 0, NODE_PORT_SECONDS_DESCRIPTION),
+        }));
+
+        return ports;
+    }
+
+    void GameTimeoutNode::halt()
+    {
+        CancelTimer(_timerId);
+        _started = false;
+        _timedOut = false;
+
+        Core::BehaviorTreeDecoratorNode::halt();
+    }
+
+    Core::BehaviorTreeNodeStatus GameTimeoutNode::tick()
+    {
+        if (!_started)
+        {
+            _started = true;
+            _timedOut = false;
+            setStatus(Core::BehaviorTreeNodeStatus::RUNNING);
+
+            const Core::Optional<float> seconds = GetInputValue<float>(NODE_PORT_SECONDS_NAME);
+            Core::TimerWheel* const wheel = GetTimerWheel();
+
+            if (seconds.has_value() && seconds.value() > 0 && wheel != nullptr)
+            {
+                // Runs on the game thread before the trees are ticked, so the child can be halted right away.
+                _timerId = wheel->Schedule(
+                    seconds.value(),
+                    [this]()
+                    {
+                        _timerId = Core::TimerWheel::InvalidTimerId;
+
+                        if (child()->status() == Core::BehaviorTreeNodeStatus::RUNNING)
+                        {
+                            _timedOut = true;
+                            haltChild();
+                        }
+                    });
+            }
+        }
+
+        if (_timedOut)
+        {
+            _started = false;
+            _timedOut = false;
+            return Core::BehaviorTreeNodeStatus::FAILURE;
+        }
+
+        const Core::BehaviorTreeNodeStatus status = child()->executeTick();
+
+        if (status != Core::BehaviorTreeNodeStatus::RUNNING)
+        {
+            CancelTimer(_timerId);
+            _started = false;
+        }
+
+        return status;
+    }
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Common
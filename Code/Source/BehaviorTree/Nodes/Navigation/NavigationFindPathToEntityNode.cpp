@@ -16,6 +16,8 @@
 
 #include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Navigation/NavigationFindPathToEntityNode.h>
 
+#include <AzCore/Component/TransformBus.h>
+
 namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
 {
     using SSBehaviorTreeBlackboardProperty = Blackboard::BlackboardProperty;
@@ -30,6 +32,11 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
     {
     }
 
+    NavigationFindPathToEntityNode::~NavigationFindPathToEntityNode()
+    {
+        ReleasePathCorridor();
+    }
+
     void NavigationFindPathToEntityNode::Reflect(AZ::ReflectContext* rc)
     {
         BlackboardPropertyNavigationFindPathToEntityNavigationState::Reflect(rc);
@@ -52,6 +59,9 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
         ports.merge(Core::BehaviorTreePortsList({
             BT::InputPort<AZ::EntityId>(NODE_PORT_TARGET_NAME, NODE_PORT_TARGET_DESCRIPTION),
             BT::OutputPort<NavigationState>(NODE_PORT_STATE_NAME, NODE_PORT_STATE_DESCRIPTION),
+            BT::InputPort<AZ::EntityId>(NODE_PORT_NAVIGATION_MESH_NAME, NODE_PORT_NAVIGATION_MESH_DESCRIPTION),
+            BT::InputPort<float>(NODE_PORT_ARRIVAL_DISTANCE_NAME, 1.0f, NODE_PORT_ARRIVAL_DISTANCE_DESCRIPTION),
+            BT::OutputPort<AZ::Vector3>(NODE_PORT_NEXT_POSITION_NAME, NODE_PORT_NEXT_POSITION_DESCRIPTION),
         }));
 
         return ports;
@@ -106,8 +116,29 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
         }
     }
 
+    void NavigationFindPathToEntityNode::ResetNode()
+    {
+        ReleasePathCorridor();
+    }
+
     void NavigationFindPathToEntityNode::Start()
     {
+        // The path corridor is kept between runs, so chasing the same target again only adjusts it.
+        if (const AZ::EntityId navigationMesh = GetNavigationMesh();
+            navigationMesh != _corridorNavigationMesh || GetEntityId() != _corridorAgent)
+        {
+            ReleasePathCorridor();
+            _corridorNavigationMesh = navigationMesh;
+            _corridorAgent = GetEntityId();
+        }
+
+        if (_corridorNavigationMesh.IsValid())
+        {
+            _lastTarget = GetTarget();
+            SetNavigationState(NavigationState::Idle);
+            return;
+        }
+
         if (const AZ::EntityId& target = GetTarget(); target.IsValid())
         {
             if (!_requestId && target != _lastTarget)
@@ -130,6 +161,9 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
 
     Core::BehaviorTreeNodeStatus NavigationFindPathToEntityNode::Tick()
     {
+        if (_corridorNavigationMesh.IsValid())
+            return TickPathCorridor();
+
         if (_lastTarget.IsValid() && _requestId)
         {
             switch (_navigationState)
@@ -183,6 +217,13 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
         return id.has_value() ? id.value() : invalidEntityId;
     }
 
+    AZ::EntityId NavigationFindPathToEntityNode::GetNavigationMesh() const
+    {
+        // The port is optional, so don't use GetInputValue which reports missing values.
+        Core::Optional<AZ::EntityId> id = getInput<AZ::EntityId>(NODE_PORT_NAVIGATION_MESH_NAME);
+        return id.has_value() ? id.value() : AZ::EntityId();
+    }
+
     void NavigationFindPathToEntityNode::ConnectBus()
     {
         LmbrCentral::NavigationComponentNotificationBus::Handler::BusConnect(GetEntityId());
@@ -222,6 +263,67 @@ namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
         StartNavigation();
     }
 
+    Core::BehaviorTreeNodeStatus NavigationFindPathToEntityNode::TickPathCorridor()
+    {
+        if (!_lastTarget.IsValid())
+        {
+            AZ_Warning("BehaveAI [BehaviorTree]", false, "[%s:%s]: No target attribute was supplied.", RegisteredNodeName(), NodeName());
+            return Core::BehaviorTreeNodeStatus::FAILURE;
+        }
+
+        AZ::Vector3 from = AZ::Vector3::CreateZero(), to = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(from, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+        AZ::TransformBus::EventResult(to, _lastTarget, &AZ::TransformBus::Events::GetWorldTranslation);
+
+        const Core::Optional<float> arrivalDistance = GetInputValue<float>(NODE_PORT_ARRIVAL_DISTANCE_NAME);
+        if (arrivalDistance.has_value() && from.GetDistanceSq(to) <= arrivalDistance.value() * arrivalDistance.value())
+        {
+            SetNavigationState(NavigationState::Complete);
+            TraversalComplete();
+            return Core::BehaviorTreeNodeStatus::SUCCESS;
+        }
+
+        Behave::Navigation::NavigationPathBuffer buffer = _corridorPath.GetBuffer();
+        Behave::Navigation::NavigationPathResult result;
+        Behave::Navigation::NavigationMeshRequestBus::EventResult(
+            result, _corridorNavigationMesh, &Behave::Navigation::NavigationMeshRequestBus::Events::UpdatePathCorridor, _corridorAgent,
+            from, to, buffer);
+
+        // No path was found, or the end of a partial path is reached and the target can't be reached from here.
+        if (!result.mFound || result.mCornersCount == 0)
+        {
+            SetNavigationState(NavigationState::Idle);
+            TraversalCancelled();
+            return Core::BehaviorTreeNodeStatus::FAILURE;
+        }
+
+        const AZ::Vector3& nextPosition = _corridorPath.mCorners[0];
+        SetOutputValue(NODE_PORT_NEXT_POSITION_NAME, nextPosition);
+
+        if (_navigationState != NavigationState::Navigating)
+        {
+            SetNavigationState(NavigationState::Navigating);
+            TraversalStarted();
+        }
+
+        const AZ::Vector3& inflectionPosition = _corridorPath.mCorners[result.mCornersCount > 1 ? 1 : 0];
+        TraversalPathUpdate(nextPosition, inflectionPosition);
+
+        return Core::BehaviorTreeNodeStatus::RUNNING;
+    }
+
+    void NavigationFindPathToEntityNode::ReleasePathCorridor()
+    {
+        if (_corridorNavigationMesh.IsValid() && _corridorAgent.IsValid())
+        {
+            Behave::Navigation::NavigationMeshRequestBus::Event(
+                _corridorNavigationMesh, &Behave::Navigation::NavigationMeshRequestBus::Events::ReleasePathCorridor, _corridorAgent);
+        }
+
+        _corridorNavigationMesh = AZ::EntityId();
+        _corridorAgent = AZ::EntityId();
+    }
+
 #pragma endregion
 
 #pragma region BlackboardPropertyNavigationFindPathToEntityNavigationState
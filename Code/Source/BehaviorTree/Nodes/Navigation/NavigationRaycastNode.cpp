@@ -0,0 +1,84 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <StdAfx.h>
+
+#include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Navigation/NavigationRaycastNode.h>
+#include <SparkyStudios/AI/Behave/Navigation/NavigationMeshBus.h>
+
+#include <AzCore/Component/TransformBus.h>
+
+namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
+{
+    NavigationRaycastNode::NavigationRaycastNode(const std::string& name, const Core::BehaviorTreeNodeConfiguration& config)
+        : Core::BehaviorTreeConditionNode(name, config)
+    {
+    }
+
+    void NavigationRaycastNode::Reflect(AZ::ReflectContext* rc)
+    {
+        AZ_UNUSED(rc);
+    }
+
+    void NavigationRaycastNode::RegisterNode(const AZStd::shared_ptr<Core::Registry>& registry)
+    {
+        registry->DelayNodeRegistration<NavigationRaycastNode>(NODE_NAME);
+    }
+
+    Core::BehaviorTreePortsList NavigationRaycastNode::providedPorts()
+    {
+        Core::BehaviorTreePortsList ports = Core::BehaviorTreeConditionNode::providedPorts();
+
+        ports.merge(Core::BehaviorTreePortsList({
+            BT::InputPort<AZ::EntityId>(NODE_PORT_NAVIGATION_MESH_NAME, NODE_PORT_NAVIGATION_MESH_DESCRIPTION),
+            BT::InputPort<AZ::EntityId>(NODE_PORT_TARGET_NAME, NODE_PORT_TARGET_DESCRIPTION),
+            BT::OutputPort<AZ::Vector3>(NODE_PORT_HIT_POSITION_NAME, NODE_PORT_HIT_POSITION_DESCRIPTION),
+        }));
+
+        return ports;
+    }
+
+    bool NavigationRaycastNode::Condition()
+    {
+        const Core::Optional<AZ::EntityId> navigationMesh = GetInputValue<AZ::EntityId>(NODE_PORT_NAVIGATION_MESH_NAME);
+        const Core::Optional<AZ::EntityId> target = GetInputValue<AZ::EntityId>(NODE_PORT_TARGET_NAME);
+
+        if (!navigationMesh.has_value() || !target.has_value() || !target.value().IsValid())
+            return false;
+
+        AZ::Vector3 from = AZ::Vector3::CreateZero(), to = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(from, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+        AZ::TransformBus::EventResult(to, target.value(), &AZ::TransformBus::Events::GetWorldTranslation);
+
+        float hitParameter = 0.0f;
+        AZ::Vector3 hitPoint = from;
+
+        Behave::Navigation::NavigationRaycastBatch batch;
+        batch.mStarts = &from;
+        batch.mEnds = &to;
+        batch.mHitParameters = &hitParameter;
+        batch.mHitPoints = &hitPoint;
+        batch.mCount = 1;
+
+        AZ::u32 clearCount = 0;
+        Behave::Navigation::NavigationMeshRequestBus::EventResult(
+            clearCount, navigationMesh.value(), &Behave::Navigation::NavigationMeshRequestBus::Events::Raycast, batch);
+
+        if (clearCount == 1)
+            return true;
+
+        SetOutputValue(NODE_PORT_HIT_POSITION_NAME, hitPoint);
+        return false;
+    }
+} // namespace SparkyStudios::AI::Behave::BehaviorTree::Nodes::Navigation
@@ -46,7 +46,11 @@ namespace SparkyStudios::AI::Behave::Navigation
                 ->Field("MaxSampleError", &NavigationMeshSettingsAsset::m_detailSampleMaxError)
                 ->Field("EnableTiling", &NavigationMeshSettingsAsset::m_enableTiling)
                 ->Field("TileSize", &NavigationMeshSettingsAsset::m_tileSize)
-                ->Field("BorderPadding", &NavigationMeshSettingsAsset::m_borderPadding);
+                ->Field("BorderPadding", &NavigationMeshSettingsAsset::m_borderPadding)
+                ->Field("EnableStreaming", &NavigationMeshSettingsAsset::m_enableStreaming)
+                ->Field("StreamingRadius", &NavigationMeshSettingsAsset::m_streamingRadius)
+                ->Field("StreamingMemoryBudget", &NavigationMeshSettingsAsset::m_streamingMemoryBudget)
+                ->Field("StreamingHotSetBudget", &NavigationMeshSettingsAsset::m_streamingHotSetBudget);
 
             if (AZ::EditContext* ec = sc->GetEditContext())
             {
@@ -167,7 +171,30 @@ namespace SparkyStudios::AI::Behave::Navigation
                         "The border padding of each tiles.")
                     ->Attribute(AZ::Edit::Attributes::Min, 0)
                     ->Attribute(AZ::Edit::Attributes::Max, 64)
-                    ->Attribute(AZ::Edit::Attributes::Step, 1);
+                    ->Attribute(AZ::Edit::Attributes::Step, 1)
+
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Streaming")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::CheckBox, &NavigationMeshSettingsAsset::m_enableStreaming, "Enable Streaming",
+                        "If enabled, tiles are only kept resident around the registered streaming anchors. Requires tiling.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &NavigationMeshSettingsAsset::m_streamingRadius, "Streaming Radius",
+                        "The distance around each streaming anchor in which tiles are loaded.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " m")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &NavigationMeshSettingsAsset::m_streamingMemoryBudget, "Memory Budget",
+                        "The maximum amount of memory used by resident tiles and the compressed copies of evicted tiles. Distant "
+                        "tiles are evicted past this budget, and compressed copies are dropped to leave room for resident tiles.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " MB")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &NavigationMeshSettingsAsset::m_streamingHotSetBudget, "Hot Set Budget",
+                        "The maximum amount of memory used to keep evicted tiles decompressed, for tiles frequently going in and out "
+                        "of range.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " MB");
             }
         }
     }
@@ -72,6 +72,11 @@ namespace SparkyStudios::AI::Behave::Navigation
         bool m_enableTiling = true;
         int m_tileSize = 16;
 
+        bool m_enableStreaming = false;
+        float m_streamingRadius = 100.0f;
+        int m_streamingMemoryBudget = 64;
+        int m_streamingHotSetBudget = 16;
+
         private:
         typedef AZStd::vector<AZStd::pair<AZ::u32, AZStd::string>> NavigationAgentComboBoxEntries;
 
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <SparkyStudios/AI/Behave/Navigation/BehaveNavigationBus.h>
+
 #include <Navigation/NavigationAreaProviderRequestBus.h>
 #include <Navigation/Components/DynamicNavigationMeshComponent.h>
 
@@ -90,67 +92,184 @@ namespace SparkyStudios::AI::Behave::Navigation
 
     AZStd::vector<AZ::Vector3> DynamicNavigationMeshComponent::FindPathToPosition(const AZ::Vector3& from, const AZ::Vector3& to)
     {
-        if (!_navigationMesh->IsNavigationMeshReady())
+        NavigationPathStorage<kMaxPathLength> storage;
+        NavigationPathBuffer buffer = storage.GetBuffer();
+
+        const NavigationPathResult result = FindPath(from, to, buffer);
+        if (!result.mFound)
             return {};
 
-        AZStd::vector<AZ::Vector3> pathPoints;
-        {
-            const dtNavMeshQuery* navMeshQuery = _navigationMesh->GetNavigationMeshQuery();
-            const dtNavMesh* navMesh = _navigationMesh->GetNavigationMesh();
+        return AZStd::vector<AZ::Vector3>(storage.mCorners.begin(), storage.mCorners.begin() + result.mCornersCount);
+    }
 
-            RecastVector3 startRecast{ from }, endRecast{ to };
-            constexpr float halfExtents[3] = { 1.0f, 1.0f, 1.0f };
+    NavigationPathResult DynamicNavigationMeshComponent::FindPath(const AZ::Vector3& from, const AZ::Vector3& to, NavigationPathBuffer& path)
+    {
+        NavigationPathResult result;
 
-            dtPolyRef startPoly = 0, endPoly = 0;
+        if (!_navigationMesh->IsNavigationMeshReady() || path.mCorners == nullptr || path.mCapacity == 0)
+            return result;
 
-            RecastVector3 nearestStartPoint, nearestEndPoint;
+        // Keep the navigation mesh alive while querying, in case a rebuild swaps it.
+        const RecastNavigationMesh::QueryScope scope(*_navigationMesh);
 
-            const dtQueryFilter filter;
+        const dtNavMeshQuery* navMeshQuery = scope.GetNavigationMeshQuery();
+        if (navMeshQuery == nullptr)
+            return result;
 
-            dtStatus result = navMeshQuery->findNearestPoly(startRecast.data(), halfExtents, &filter, &startPoly, nearestStartPoint.data());
-            if (result != DT_SUCCESS)
-                return {};
+        const RecastVector3 startRecast{ from }, endRecast{ to };
+        constexpr float halfExtents[3] = { 1.0f, 1.0f, 1.0f };
 
-            result = navMeshQuery->findNearestPoly(endRecast.data(), halfExtents, &filter, &endPoly, nearestEndPoint.data());
-            if (result != DT_SUCCESS)
-                return {};
+        const dtQueryFilter filter;
 
-            constexpr int maxPathLength = 100;
-            dtPolyRef path[maxPathLength] = {};
-            int pathLength = 0;
+        dtPolyRef startPoly = 0, endPoly = 0;
+        RecastVector3 nearestStartPoint, nearestEndPoint;
 
-            // find an approximate path
-            navMeshQuery->findPath(
-                startPoly, endPoly, nearestStartPoint.data(), nearestEndPoint.data(), &filter, path, &pathLength, maxPathLength);
+        dtStatus status = navMeshQuery->findNearestPoly(startRecast.data(), halfExtents, &filter, &startPoly, nearestStartPoint.data());
+        if (dtStatusFailed(status) || startPoly == 0)
+            return result;
 
-            AZStd::vector<RecastVector3> approximatePath;
-            approximatePath.resize(pathLength);
+        status = navMeshQuery->findNearestPoly(endRecast.data(), halfExtents, &filter, &endPoly, nearestEndPoint.data());
+        if (dtStatusFailed(status) || endPoly == 0)
+            return result;
 
-            for (int pathIndex = 0; pathIndex < pathLength; ++pathIndex)
-            {
-                RecastVector3 center = RecastNavigationMesh::GetPolyCenter(navMesh, path[pathIndex]);
-                approximatePath.push_back(center);
-            }
+        // Query results are written on the stack, then converted into the caller buffers.
+        dtPolyRef polygons[kMaxPathLength];
+        int polygonsCount = 0;
 
-            constexpr int maxDetailedPathLength = 100;
-            RecastVector3 detailedPath[maxDetailedPathLength] = {};
-            AZ::u8 detailedPathFlags[maxDetailedPathLength] = {};
-            dtPolyRef detailedPolyPathRefs[maxDetailedPathLength] = {};
-            int detailedPathCount = 0;
+        const dtStatus pathStatus = navMeshQuery->findPath(
+            startPoly, endPoly, nearestStartPoint.data(), nearestEndPoint.data(), &filter, polygons, &polygonsCount, kMaxPathLength);
 
-            navMeshQuery->findStraightPath(
-                startRecast.data(), endRecast.data(), path, pathLength, detailedPath[0].data(), detailedPathFlags, detailedPolyPathRefs,
-                &detailedPathCount, maxDetailedPathLength);
+        if (dtStatusFailed(pathStatus) || polygonsCount == 0)
+            return result;
 
-            // TODO: Debug Draw Path
+        result.mPartial = dtStatusDetail(pathStatus, DT_PARTIAL_RESULT);
+        result.mTruncated = dtStatusDetail(pathStatus, DT_BUFFER_TOO_SMALL);
 
-            for (int i = 0; i < detailedPathCount; ++i)
-            {
-                pathPoints.push_back(detailedPath[i].AsVector3());
-            }
+        // When the target can't be reached, end the path on the closest point of the last polygon.
+        if (polygons[polygonsCount - 1] != endPoly)
+        {
+            navMeshQuery->closestPointOnPoly(polygons[polygonsCount - 1], endRecast.data(), nearestEndPoint.data(), nullptr);
+            result.mPartial = true;
         }
 
-        return pathPoints;
+        RecastVector3 corners[kMaxPathLength];
+        AZ::u8 cornersFlags[kMaxPathLength];
+        dtPolyRef cornersPolygons[kMaxPathLength];
+        int cornersCount = 0;
+
+        const int maxCorners = aznumeric_cast<int>(AZStd::min<AZ::u32>(path.mCapacity, kMaxPathLength));
+
+        const dtStatus straightPathStatus = navMeshQuery->findStraightPath(
+            nearestStartPoint.data(), nearestEndPoint.data(), polygons, polygonsCount, corners[0].data(), cornersFlags, cornersPolygons,
+            &cornersCount, maxCorners);
+
+        if (dtStatusFailed(straightPathStatus))
+            return result;
+
+        result.mTruncated = result.mTruncated || dtStatusDetail(straightPathStatus, DT_BUFFER_TOO_SMALL);
+
+        for (int i = 0; i < cornersCount; ++i)
+        {
+            path.mCorners[i] = corners[i].AsVector3();
+
+            if (path.mFlags != nullptr)
+                path.mFlags[i] = cornersFlags[i];
+
+            if (path.mPolygons != nullptr)
+                path.mPolygons[i] = cornersPolygons[i];
+        }
+
+        result.mCornersCount = aznumeric_cast<AZ::u32>(cornersCount);
+        result.mFound = true;
+
+        return result;
+    }
+
+    bool DynamicNavigationMeshComponent::FindNearestPoint(const AZ::Vector3& position, const AZ::Vector3& extents, AZ::Vector3& nearest)
+    {
+        if (!_navigationMesh->IsNavigationMeshReady())
+            return false;
+
+        // Keep the navigation mesh alive while querying, in case a rebuild swaps it.
+        const RecastNavigationMesh::QueryScope scope(*_navigationMesh);
+
+        const dtNavMeshQuery* navMeshQuery = scope.GetNavigationMeshQuery();
+        if (navMeshQuery == nullptr)
+            return false;
+
+        const RecastVector3 positionRecast{ position }, halfExtents{ extents.GetAbs() };
+        const dtQueryFilter filter;
+
+        dtPolyRef polygon = 0;
+        RecastVector3 nearestPoint;
+
+        const dtStatus status =
+            navMeshQuery->findNearestPoly(positionRecast.data(), halfExtents.data(), &filter, &polygon, nearestPoint.data());
+        if (dtStatusFailed(status) || polygon == 0)
+            return false;
+
+        nearest = nearestPoint.AsVector3();
+        return true;
+    }
+
+    NavigationPathResult DynamicNavigationMeshComponent::UpdatePathCorridor(
+        const AZ::EntityId& agent, const AZ::Vector3& from, const AZ::Vector3& target, NavigationPathBuffer& path)
+    {
+        if (!_navigationMesh->IsNavigationMeshReady() || !agent.IsValid())
+            return {};
+
+        // Read the generation first, so a concurrent swap at worst causes an extra path search on the next update.
+        const AZ::u32 generation = _navigationMesh->GetGeneration();
+
+        // Keep the navigation mesh alive while querying, in case a rebuild swaps it.
+        const RecastNavigationMesh::QueryScope scope(*_navigationMesh);
+
+        return _pathCorridors.Update(scope, generation, agent, from, target, path);
+    }
+
+    void DynamicNavigationMeshComponent::ReleasePathCorridor(const AZ::EntityId& agent)
+    {
+        _pathCorridors.Release(agent);
+    }
+
+    AZ::u32 DynamicNavigationMeshComponent::Raycast(const NavigationRaycastBatch& batch)
+    {
+        return _navigationMesh->Raycast(batch);
+    }
+
+    void DynamicNavigationMeshComponent::AddStreamingAnchor(const AZ::EntityId& anchor)
+    {
+        if (!anchor.IsValid())
+            return;
+
+        if (AZStd::find(_streamingAnchors.begin(), _streamingAnchors.end(), anchor) == _streamingAnchors.end())
+            _streamingAnchors.push_back(anchor);
+    }
+
+    void DynamicNavigationMeshComponent::RemoveStreamingAnchor(const AZ::EntityId& anchor)
+    {
+        if (const auto it = AZStd::find(_streamingAnchors.begin(), _streamingAnchors.end(), anchor); it != _streamingAnchors.end())
+            _streamingAnchors.erase(it);
+    }
+
+    NavigationMeshTileStoreStatistics DynamicNavigationMeshComponent::GetTileStoreStatistics()
+    {
+        return _navigationMesh->GetTileStoreStatistics();
+    }
+
+    void DynamicNavigationMeshComponent::CancelNavigationMeshBuild()
+    {
+        _navigationMesh->CancelBuild();
+    }
+
+    NavigationMeshBuildStatistics DynamicNavigationMeshComponent::GetBuildStatistics()
+    {
+        return _navigationMesh->GetBuildStatistics();
+    }
+
+    AZStd::string DynamicNavigationMeshComponent::DumpBuildStatistics(const bool includeTiles)
+    {
+        return _navigationMesh->DumpBuildStatistics(includeTiles);
     }
 
     void DynamicNavigationMeshComponent::OnNavigationMeshUpdated()
@@ -172,23 +291,76 @@ namespace SparkyStudios::AI::Behave::Navigation
 
         NavigationMeshNotificationBus::Handler::BusConnect(GetEntityId());
         NavigationMeshRequestBus::Handler::BusConnect(GetEntityId());
+        NavigationMeshStatisticsRequestBus::Handler::BusConnect(GetEntityId());
 
         AzFramework::GameEntityContextEventBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
+
+        _changeTracker.Start();
+
+        if (auto* const navigation = BehaveNavigationInterface::Get())
+            navigation->RegisterNavigationMesh(GetEntityId(), _aabb, _offMeshConnections);
     }
 
     void DynamicNavigationMeshComponent::Deactivate()
     {
+        if (auto* const navigation = BehaveNavigationInterface::Get())
+            navigation->UnregisterNavigationMesh(GetEntityId());
+
+        _changeTracker.Stop();
+        _fullRebuildRequested = false;
+
         AZ::TickBus::Handler::BusDisconnect();
         AzFramework::GameEntityContextEventBus::Handler::BusDisconnect();
 
+        NavigationMeshStatisticsRequestBus::Handler::BusDisconnect();
         NavigationMeshRequestBus::Handler::BusDisconnect();
         NavigationMeshNotificationBus::Handler::BusDisconnect();
 
+        _pathCorridors.Clear();
+
         delete _navigationMesh;
+        _navigationMesh = nullptr;
     }
 
-    void DynamicNavigationMeshComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    void DynamicNavigationMeshComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        _navigationMesh->ProcessBuildQueue();
+
+        // Changes made before the first build are part of it.
+        if (_changeTracker.ConsumeDirtyBounds(_dirtyBounds) && (_navigationMesh->IsNavigationMeshReady() || _navigationMesh->IsBuilding()))
+        {
+            for (const AZ::Aabb& bounds : _dirtyBounds)
+            {
+                // Navigation meshes without tiles can only be rebuilt entirely.
+                if (!_navigationMesh->InvalidateTiles(bounds) && bounds.Overlaps(_aabb))
+                    _fullRebuildRequested = true;
+            }
+        }
+
+        _timeSinceFullRebuild += deltaTime;
+        if (_fullRebuildRequested && _timeSinceFullRebuild >= kMinFullRebuildInterval)
+        {
+            _fullRebuildRequested = false;
+            _timeSinceFullRebuild = 0.0f;
+
+            UpdateNavigationMesh();
+        }
+
+        _navigationMesh->UpdateDirtyTiles();
+
+        if (!_navigationMesh->IsStreamingEnabled())
+            return;
+
+        _streamingAnchorPositions.clear();
+        for (const AZ::EntityId& anchor : _streamingAnchors)
+        {
+            AZ::Vector3 position = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(position, anchor, &AZ::TransformBus::Events::GetWorldTranslation);
+
+            _streamingAnchorPositions.push_back(position);
+        }
+
+        _navigationMesh->UpdateStreaming(_streamingAnchorPositions);
     }
 } // namespace SparkyStudios::AI::Behave::Navigation
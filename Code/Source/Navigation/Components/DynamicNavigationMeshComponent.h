@@ -15,10 +15,13 @@
 #pragma once
 
 #include <SparkyStudios/AI/Behave/Navigation/NavigationMeshBus.h>
+#include <SparkyStudios/AI/Behave/Navigation/NavigationMeshStatisticsBus.h>
 #include <SparkyStudios/AI/Behave/Navigation/INavigationMesh.h>
 
 #include <Navigation/Assets/NavigationMeshSettingsAsset.h>
+#include <Navigation/NavigationMeshChangeTracker.h>
 #include <Navigation/Utils/RecastNavigationMesh.h>
+#include <Navigation/Utils/RecastPathCorridors.h>
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Component/Component.h>
@@ -34,6 +37,7 @@ namespace SparkyStudios::AI::Behave::Navigation
         , public INavigationMesh
         , protected NavigationMeshRequestBus::Handler
         , protected NavigationMeshNotificationBus::Handler
+        , protected NavigationMeshStatisticsRequestBus::Handler
         , protected AzFramework::GameEntityContextEventBus::Handler
     {
         friend class DynamicNavigationMeshEditorComponent;
@@ -55,6 +59,20 @@ namespace SparkyStudios::AI::Behave::Navigation
         bool UpdateNavigationMesh() override;
         AZStd::vector<AZ::Vector3> FindPathToEntity(const AZ::EntityId& from, const AZ::EntityId& to) override;
         AZStd::vector<AZ::Vector3> FindPathToPosition(const AZ::Vector3& from, const AZ::Vector3& to) override;
+        NavigationPathResult FindPath(const AZ::Vector3& from, const AZ::Vector3& to, NavigationPathBuffer& path) override;
+        bool FindNearestPoint(const AZ::Vector3& position, const AZ::Vector3& extents, AZ::Vector3& nearest) override;
+        NavigationPathResult UpdatePathCorridor(
+            const AZ::EntityId& agent, const AZ::Vector3& from, const AZ::Vector3& target, NavigationPathBuffer& path) override;
+        void ReleasePathCorridor(const AZ::EntityId& agent) override;
+        AZ::u32 Raycast(const NavigationRaycastBatch& batch) override;
+        void AddStreamingAnchor(const AZ::EntityId& anchor) override;
+        void RemoveStreamingAnchor(const AZ::EntityId& anchor) override;
+        NavigationMeshTileStoreStatistics GetTileStoreStatistics() override;
+        void CancelNavigationMeshBuild() override;
+
+        // NavigationMeshStatisticsRequestBus
+        NavigationMeshBuildStatistics GetBuildStatistics() override;
+        AZStd::string DumpBuildStatistics(bool includeTiles) override;
 
         void OnNavigationMeshUpdated() override;
 
@@ -70,10 +88,25 @@ namespace SparkyStudios::AI::Behave::Navigation
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
     private:
+        // Maximum number of polygons and corners of a path.
+        static constexpr AZ::u32 kMaxPathLength = 256;
+
+        // Minimum time in seconds between two full rebuilds triggered by changes, for navigation meshes without tiles.
+        static constexpr float kMinFullRebuildInterval = 1.0f;
+
         AZ::Data::Asset<NavigationMeshSettingsAsset> _settings;
         AZ::Aabb _aabb = AZ::Aabb::CreateNull();
         OffMeshConnections _offMeshConnections;
 
         RecastNavigationMesh* _navigationMesh = nullptr;
+        RecastPathCorridors _pathCorridors;
+
+        NavigationMeshChangeTracker _changeTracker;
+        AZStd::vector<AZ::Aabb> _dirtyBounds;
+        bool _fullRebuildRequested = false;
+        float _timeSinceFullRebuild = 0.0f;
+
+        AZStd::vector<AZ::EntityId> _streamingAnchors;
+        AZStd::vector<AZ::Vector3> _streamingAnchorPositions;
     };
 } // namespace SparkyStudios::AI::Behave::Navigation
@@ -16,13 +16,26 @@
 
 #include <DetourDebugDraw.h>
 
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzCore/Serialization/DynamicSerializableField.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/optional.h>
 
+#include <AzFramework/StringFunc/StringFunc.h>
+#include <AzFramework/Viewport/CameraState.h>
+
+#include <AzToolsFramework/API/EditorAssetSystemAPI.h>
 #include <AzToolsFramework/API/ToolsApplicationAPI.h>
+#include <AzToolsFramework/SourceControl/SourceControlAPI.h>
+#include <AzToolsFramework/Viewport/ViewportMessages.h>
 
 namespace SparkyStudios::AI::Behave::Navigation
 {
+    // Maximum number of navigation mesh tiles baked for debug draw in a single frame.
+    static constexpr int kMaxDebugDrawBakedTilesPerFrame = 16;
+
     void DynamicNavigationMeshEditorComponent::Reflect(AZ::ReflectContext* rc)
     {
         DynamicNavigationMeshComponent::Reflect(rc);
@@ -34,7 +47,8 @@ namespace SparkyStudios::AI::Behave::Navigation
                 ->Field("OffMeshConnections", &DynamicNavigationMeshEditorComponent::_offMeshConnections)
                 ->Field("Bounds", &DynamicNavigationMeshEditorComponent::_aabb)
                 ->Field("DebugDraw", &DynamicNavigationMeshEditorComponent::_enableDebug)
-                ->Field("DebugDepthTest", &DynamicNavigationMeshEditorComponent::_depthTest);
+                ->Field("DebugDepthTest", &DynamicNavigationMeshEditorComponent::_depthTest)
+                ->Field("DebugDrawDistance", &DynamicNavigationMeshEditorComponent::_debugDrawDistance);
 
             if (AZ::EditContext* ec = sc->GetEditContext())
             {
@@ -69,10 +83,49 @@ namespace SparkyStudios::AI::Behave::Navigation
                     ->DataElement(
                         AZ::Edit::UIHandlers::Default, &DynamicNavigationMeshEditorComponent::_depthTest, "Depth Test",
                         "Enable the depth test while drawing the navigation mesh.")
-                    ->UIElement(AZ::Edit::UIHandlers::Button, "", "Build the navigation mesh with the current settings.")
-                    ->Attribute(AZ::Edit::Attributes::ButtonText, "Build")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &DynamicNavigationMeshEditorComponent::_debugDrawDistance, "Draw Distance",
+                        "The maximum distance from the camera at which navigation mesh tiles are drawn. Set to 0 to draw all the tiles.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " m")
+                    ->UIElement(
+                        AZ::Edit::UIHandlers::Button, "",
+                        "Build the navigation mesh with the current settings. A running build is restarted.")
+                    ->Attribute(AZ::Edit::Attributes::ButtonText, &DynamicNavigationMeshEditorComponent::GetBuildButtonText)
                     ->Attribute(AZ::Edit::Attributes::ChangeNotify, &DynamicNavigationMeshEditorComponent::OnBuildNavigationMesh)
-                    ->Attribute(AZ::Edit::Attributes::ReadOnly, &DynamicNavigationMeshEditorComponent::IsNavigationMeshBuilding);
+                    ->UIElement(AZ::Edit::UIHandlers::Button, "", "Cancel the running navigation mesh build.")
+                    ->Attribute(AZ::Edit::Attributes::ButtonText, "Cancel")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &DynamicNavigationMeshEditorComponent::OnCancelNavigationMeshBuild)
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &DynamicNavigationMeshEditorComponent::GetCancelButtonVisibility)
+                    ->UIElement(
+                        AZ::Edit::UIHandlers::Button, "", "Print the aggregated statistics of the last navigation mesh build in the console.")
+                    ->Attribute(AZ::Edit::Attributes::ButtonText, "Print Build Statistics")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &DynamicNavigationMeshEditorComponent::OnPrintBuildStatistics)
+
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Settings Tuner")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->UIElement(
+                        AZ::Edit::UIHandlers::Button, "",
+                        "Build the navigation mesh with a grid of settings around the current ones, and measure each of them.")
+                    ->Attribute(AZ::Edit::Attributes::ButtonText, &DynamicNavigationMeshEditorComponent::GetTuneButtonText)
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &DynamicNavigationMeshEditorComponent::OnTuneSettings)
+                    // The selection is not serialized, tuning results only live until the editor is closed.
+                    ->UIElement(
+                        AZ::Edit::UIHandlers::Button, "Candidate",
+                        "The Pareto optimal settings found by the last tuning. Click to select the next one.")
+                    ->Attribute(AZ::Edit::Attributes::ButtonText, &DynamicNavigationMeshEditorComponent::GetTuningCandidateText)
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &DynamicNavigationMeshEditorComponent::OnSelectNextTuningCandidate)
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &DynamicNavigationMeshEditorComponent::GetTuningResultsVisibility)
+                    ->UIElement(
+                        AZ::Edit::UIHandlers::Button, "",
+                        "Save the selected candidate into the settings asset, and rebuild the navigation mesh.")
+                    ->Attribute(AZ::Edit::Attributes::ButtonText, "Apply")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &DynamicNavigationMeshEditorComponent::OnApplyTuningCandidate)
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &DynamicNavigationMeshEditorComponent::GetTuningResultsVisibility)
+                    ->UIElement(AZ::Edit::UIHandlers::Button, "", "Print the measures of every tuned candidate in the console.")
+                    ->Attribute(AZ::Edit::Attributes::ButtonText, "Print Tuning Results")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &DynamicNavigationMeshEditorComponent::OnPrintTuningResults)
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &DynamicNavigationMeshEditorComponent::GetTuningResultsVisibility);
             }
         }
 
@@ -145,8 +198,10 @@ namespace SparkyStudios::AI::Behave::Navigation
         _navigationMesh = new RecastNavigationMesh(GetEntityId(), true);
 
         NavigationMeshNotificationBus::Handler::BusConnect(GetEntityId());
+        NavigationMeshStatisticsRequestBus::Handler::BusConnect(GetEntityId());
         LmbrCentral::ShapeComponentNotificationsBus::Handler::BusConnect(GetEntityId());
         AzFramework::EntityDebugDisplayEventBus::Handler::BusConnect(GetEntityId());
+        AZ::TickBus::Handler::BusConnect();
 
         if (_settings.GetId().IsValid())
         {
@@ -169,13 +224,18 @@ namespace SparkyStudios::AI::Behave::Navigation
 
     void DynamicNavigationMeshEditorComponent::Deactivate()
     {
+        _tuner.Cancel();
+
         AZ::Data::AssetBus::Handler::BusDisconnect();
 
+        AZ::TickBus::Handler::BusDisconnect();
         AzFramework::EntityDebugDisplayEventBus::Handler::BusDisconnect(GetEntityId());
         LmbrCentral::ShapeComponentNotificationsBus::Handler::BusDisconnect(GetEntityId());
+        NavigationMeshStatisticsRequestBus::Handler::BusDisconnect(GetEntityId());
         NavigationMeshNotificationBus::Handler::BusDisconnect(GetEntityId());
 
         delete _navigationMesh;
+        _navigationMesh = nullptr;
     }
 
     void DynamicNavigationMeshEditorComponent::BuildGameEntity(AZ::Entity* gameEntity)
@@ -185,6 +245,22 @@ namespace SparkyStudios::AI::Behave::Navigation
 
     void DynamicNavigationMeshEditorComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        _navigationMesh->ProcessBuildQueue();
+
+        if (_tuner.IsRunning())
+        {
+            const int progress = aznumeric_cast<int>(_tuner.GetProgress() * 100.0f);
+
+            _tuner.Update();
+
+            // Refresh the property grid when the displayed percentage changes, or when the tuning is done.
+            if (!_tuner.IsRunning() || progress != aznumeric_cast<int>(_tuner.GetProgress() * 100.0f))
+            {
+                EBUS_EVENT(
+                    AzToolsFramework::ToolsApplicationEvents::Bus, InvalidatePropertyDisplay,
+                    _tuner.IsRunning() ? AzToolsFramework::Refresh_AttributesAndValues : AzToolsFramework::Refresh_EntireTree);
+            }
+        }
     }
 
     int DynamicNavigationMeshEditorComponent::GetTickOrder()
@@ -194,10 +270,39 @@ namespace SparkyStudios::AI::Behave::Navigation
 
     void DynamicNavigationMeshEditorComponent::OnNavigationMeshUpdated()
     {
-        AZStd::atomic_store_explicit(&_waitingOnNavMeshBuild, false, AZStd::memory_order_release);
         EBUS_EVENT(AzToolsFramework::ToolsApplicationEvents::Bus, InvalidatePropertyDisplay, AzToolsFramework::Refresh_AttributesAndValues);
     }
 
+    void DynamicNavigationMeshEditorComponent::OnNavigationMeshBuildProgress(const float progress, const float remainingTime)
+    {
+        // Only refresh the property grid when the displayed percentage changes.
+        const bool refresh = aznumeric_cast<int>(progress * 100.0f) != aznumeric_cast<int>(_buildProgress * 100.0f);
+
+        _buildProgress = progress;
+        _buildRemainingTime = remainingTime;
+
+        if (refresh)
+        {
+            EBUS_EVENT(
+                AzToolsFramework::ToolsApplicationEvents::Bus, InvalidatePropertyDisplay, AzToolsFramework::Refresh_AttributesAndValues);
+        }
+    }
+
+    void DynamicNavigationMeshEditorComponent::OnNavigationMeshBuildCancelled()
+    {
+        EBUS_EVENT(AzToolsFramework::ToolsApplicationEvents::Bus, InvalidatePropertyDisplay, AzToolsFramework::Refresh_AttributesAndValues);
+    }
+
+    NavigationMeshBuildStatistics DynamicNavigationMeshEditorComponent::GetBuildStatistics()
+    {
+        return _navigationMesh->GetBuildStatistics();
+    }
+
+    AZStd::string DynamicNavigationMeshEditorComponent::DumpBuildStatistics(const bool includeTiles)
+    {
+        return _navigationMesh->DumpBuildStatistics(includeTiles);
+    }
+
     void DynamicNavigationMeshEditorComponent::OnShapeChanged(ShapeChangeReasons changeReason)
     {
         if (changeReason == ShapeChangeReasons::ShapeChanged)
@@ -205,15 +310,52 @@ namespace SparkyStudios::AI::Behave::Navigation
     }
 
     void DynamicNavigationMeshEditorComponent::DisplayEntityViewport(
-        [[maybe_unused]] const AzFramework::ViewportInfo& viewportInfo, AzFramework::DebugDisplayRequests& debugDisplay)
+        const AzFramework::ViewportInfo& viewportInfo, AzFramework::DebugDisplayRequests& debugDisplay)
     {
-        if (_enableDebug && _navigationMesh->IsNavigationMeshReady() && _navigationMesh->GetNavigationMesh())
+        if (!_enableDebug)
         {
+            _debugDraw.Clear();
+            return;
+        }
+
+        if (!_navigationMesh->IsNavigationMeshReady())
+            return;
+
+        const RecastNavigationMesh::QueryScope scope(*_navigationMesh);
+
+        if (const dtNavMesh* navMesh = scope.GetNavigationMesh(); navMesh != nullptr)
+        {
+            // Tiles are baked once and only drawn again in the next frames, until they change.
+            _debugDraw.UpdateNavigationMesh(
+                *navMesh, _navigationMesh->GetGeneration(), DU_DRAWNAVMESH_OFFMESHCONS, kMaxDebugDrawBakedTilesPerFrame);
+
+            AzFramework::CameraState cameraState;
+            AzToolsFramework::ViewportInteraction::ViewportInteractionRequestBus::EventResult(
+                cameraState, viewportInfo.m_viewportId,
+                &AzToolsFramework::ViewportInteraction::ViewportInteractionRequestBus::Events::GetCameraState);
+
+            AZStd::optional<AZ::Frustum> frustum;
+            if (cameraState.m_viewportSize.m_width > 0 && cameraState.m_viewportSize.m_height > 0)
+            {
+                const float aspectRatio = aznumeric_cast<float>(cameraState.m_viewportSize.m_width) /
+                    aznumeric_cast<float>(cameraState.m_viewportSize.m_height);
+
+                frustum = AZ::Frustum(AZ::ViewFrustumAttributes(
+                    AzFramework::CameraTransform(cameraState), aspectRatio, cameraState.m_fovOrZoom, cameraState.m_nearClip,
+                    cameraState.m_farClip));
+            }
+
             debugDisplay.PushMatrix(AZ::Transform::Identity());
 
             _debugDraw.SetEnableDepthTest(_depthTest);
             _debugDraw.SetDebugDisplayRequestsHandler(&debugDisplay);
-            duDebugDrawNavMesh(&_debugDraw, *_navigationMesh->_navMesh, DU_DRAWNAVMESH_OFFMESHCONS);
+
+            // Without camera, every tile is drawn.
+            if (frustum.has_value())
+                _debugDraw.DrawNavigationMesh(&frustum.value(), cameraState.m_position, _debugDrawDistance);
+            else
+                _debugDraw.DrawNavigationMesh(nullptr, AZ::Vector3::CreateZero(), 0.0f);
+
             // duDebugDrawPolyMeshDetail(&_debugDraw, *_navigationMesh->_detailMesh);
             // duDebugDrawPolyMesh(&_debugDraw, *_navigationMesh->_polyMesh);
             // duDebugDrawCompactHeightfieldSolid(&_debugDraw, *_navigationMesh->_compactHeightField);
@@ -264,17 +406,201 @@ namespace SparkyStudios::AI::Behave::Navigation
 
     AZ::Crc32 DynamicNavigationMeshEditorComponent::OnBuildNavigationMesh()
     {
-        if (IsNavigationMeshBuilding())
-            return AZ::Edit::PropertyRefreshLevels::None;
+        _buildProgress = 0.0f;
+        _buildRemainingTime = -1.0f;
+
+        // The settings may have changed since the running build was started, so its result is outdated. Pressing the
+        // button several times only restarts the build once, as queued requests are coalesced.
+        _navigationMesh->BuildNavigationMesh(this, RecastNavigationMesh::BuildPriority::High);
+
+        return AZ::Edit::PropertyRefreshLevels::AttributesAndValues;
+    }
 
-        AZStd::atomic_store_explicit(&_waitingOnNavMeshBuild, true, AZStd::memory_order_release);
-        _navigationMesh->BuildNavigationMesh(this);
+    AZ::Crc32 DynamicNavigationMeshEditorComponent::OnCancelNavigationMeshBuild()
+    {
+        _navigationMesh->CancelBuild();
 
         return AZ::Edit::PropertyRefreshLevels::AttributesAndValues;
     }
 
+    AZ::Crc32 DynamicNavigationMeshEditorComponent::OnPrintBuildStatistics()
+    {
+        AZ_Printf("BehaveAI [Navigation]", "%s", DumpBuildStatistics(false).c_str());
+
+        return AZ::Edit::PropertyRefreshLevels::None;
+    }
+
     bool DynamicNavigationMeshEditorComponent::IsNavigationMeshBuilding() const
     {
-        return AZStd::atomic_load_explicit(&_waitingOnNavMeshBuild, AZStd::memory_order_acquire);
+        return _navigationMesh != nullptr && _navigationMesh->IsBuilding();
+    }
+
+    AZStd::string DynamicNavigationMeshEditorComponent::GetBuildButtonText() const
+    {
+        if (!IsNavigationMeshBuilding())
+            return "Build";
+
+        if (_buildRemainingTime < 0.0f)
+            return AZStd::string::format("Rebuild (%d%%)", aznumeric_cast<int>(_buildProgress * 100.0f));
+
+        return AZStd::string::format(
+            "Rebuild (%d%%, %.0fs left)", aznumeric_cast<int>(_buildProgress * 100.0f), AZStd::ceil(_buildRemainingTime));
+    }
+
+    AZ::Crc32 DynamicNavigationMeshEditorComponent::GetCancelButtonVisibility() const
+    {
+        return IsNavigationMeshBuilding() ? AZ::Edit::PropertyVisibility::Show : AZ::Edit::PropertyVisibility::Hide;
+    }
+
+    AZ::Crc32 DynamicNavigationMeshEditorComponent::OnTuneSettings()
+    {
+        if (_tuner.IsRunning())
+        {
+            _tuner.Cancel();
+            return AZ::Edit::PropertyRefreshLevels::EntireTree;
+        }
+
+        _tuningCandidate = -1;
+
+        if (!_tuner.Start(GetEntityId(), this))
+        {
+            AZ_Warning("BehaveAI [Navigation]", false, "Unable to tune the navigation mesh settings, no settings asset is loaded.");
+        }
+
+        return AZ::Edit::PropertyRefreshLevels::EntireTree;
+    }
+
+    AZ::Crc32 DynamicNavigationMeshEditorComponent::OnApplyTuningCandidate()
+    {
+        const auto& candidates = _tuner.GetCandidates();
+
+        if (_tuningCandidate < 0 || _tuningCandidate >= aznumeric_cast<int>(candidates.size()) || !_settings.IsReady())
+            return AZ::Edit::PropertyRefreshLevels::None;
+
+        candidates[_tuningCandidate].ApplyTo(*_settings.Get());
+
+        if (!SaveSettings())
+        {
+            AZ_Warning(
+                "BehaveAI [Navigation]", false,
+                "Unable to save the navigation mesh settings asset. The tuned settings are only applied until the asset is reloaded.");
+        }
+
+        return OnBuildNavigationMesh();
+    }
+
+    AZ::Crc32 DynamicNavigationMeshEditorComponent::OnSelectNextTuningCandidate()
+    {
+        const TuningCandidateList list = BuildTuningCandidateList();
+
+        // Cycle through the Pareto optimal candidates, and back to none.
+        const auto it = AZStd::find_if(
+            list.begin(), list.end(),
+            [this](const auto& entry)
+            {
+                return entry.first == _tuningCandidate;
+            });
+
+        _tuningCandidate = it == list.end() || it + 1 == list.end() ? list.front().first : (it + 1)->first;
+
+        return AZ::Edit::PropertyRefreshLevels::AttributesAndValues;
+    }
+
+    AZ::Crc32 DynamicNavigationMeshEditorComponent::OnPrintTuningResults()
+    {
+        AZ_Printf("BehaveAI [Navigation]", "%s", _tuner.DumpParetoTable(true).c_str());
+
+        return AZ::Edit::PropertyRefreshLevels::None;
+    }
+
+    AZStd::string DynamicNavigationMeshEditorComponent::GetTuneButtonText() const
+    {
+        if (!_tuner.IsRunning())
+            return "Tune Settings";
+
+        return AZStd::string::format("Cancel Tuning (%d%%)", aznumeric_cast<int>(_tuner.GetProgress() * 100.0f));
+    }
+
+    AZStd::string DynamicNavigationMeshEditorComponent::GetTuningCandidateText() const
+    {
+        for (const auto& [index, text] : BuildTuningCandidateList())
+        {
+            if (index == _tuningCandidate)
+                return text;
+        }
+
+        return "<None>";
+    }
+
+    AZ::Crc32 DynamicNavigationMeshEditorComponent::GetTuningResultsVisibility() const
+    {
+        const auto& candidates = _tuner.GetCandidates();
+
+        const bool hasResults = !_tuner.IsRunning() &&
+            AZStd::any_of(candidates.begin(), candidates.end(),
+                          [](const NavigationMeshTuningCandidate& candidate)
+                          {
+                              return candidate.mParetoOptimal;
+                          });
+
+        return hasResults ? AZ::Edit::PropertyVisibility::Show : AZ::Edit::PropertyVisibility::Hide;
+    }
+
+    DynamicNavigationMeshEditorComponent::TuningCandidateList DynamicNavigationMeshEditorComponent::BuildTuningCandidateList() const
+    {
+        TuningCandidateList list;
+        list.emplace_back(-1, "<None>");
+
+        const auto& candidates = _tuner.GetCandidates();
+        for (int i = 0; i < aznumeric_cast<int>(candidates.size()); ++i)
+        {
+            const NavigationMeshTuningCandidate& candidate = candidates[i];
+            if (!candidate.mParetoOptimal)
+                continue;
+
+            list.emplace_back(
+                i,
+                AZStd::string::format(
+                    "Cell %.2f x %.2f, Tile %d, Edge Error %.2f, Detail %d - %.0f ms, %llu KB, %.0f%% paths",
+                    candidate.mCellSize, candidate.mCellHeight, candidate.mTileSize, candidate.mEdgeMaxError,
+                    candidate.mDetailSampleDist, candidate.mBuildTime,
+                    aznumeric_cast<unsigned long long>(candidate.mNavigationMeshSize / 1024), candidate.mPathSuccessRate * 100.0f));
+        }
+
+        return list;
+    }
+
+    bool DynamicNavigationMeshEditorComponent::SaveSettings()
+    {
+        bool found = false;
+        AZStd::string folderFoundIn;
+        AZ::Data::AssetInfo assetInfo;
+
+        AzToolsFramework::AssetSystemRequestBus::BroadcastResult(
+            found, &AzToolsFramework::AssetSystemRequestBus::Events::GetSourceInfoBySourceUUID, _settings.GetId().m_guid, assetInfo,
+            folderFoundIn);
+
+        if (!found)
+            return false;
+
+        AZStd::string fullPath;
+        AzFramework::StringFunc::Path::Join(folderFoundIn.c_str(), assetInfo.m_relativePath.c_str(), fullPath);
+
+        AZ::Data::AssetHandler* handler = AZ::Data::AssetManager::Instance().GetHandler(_settings.GetType());
+        if (handler == nullptr)
+            return false;
+
+        // Check it out in the source control system
+        EBUS_EVENT(
+            AzToolsFramework::SourceControlCommandBus, RequestEdit, fullPath.c_str(), true,
+            [](bool /*success*/, const AzToolsFramework::SourceControlFileInfo& /*info*/)
+            {
+            });
+
+        AZ::IO::FileIOStream fileStream(fullPath.c_str(), AZ::IO::OpenMode::ModeWrite);
+        if (!fileStream.IsOpen())
+            return false;
+
+        return handler->SaveAssetData(_settings, &fileStream);
     }
 } // namespace SparkyStudios::AI::Behave::Navigation
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <Navigation/Components/DynamicNavigationMeshComponent.h>
+#include <Navigation/NavigationMeshSettingsTuner.h>
 #include <Navigation/Utils/RecastNavMeshDebugDraw.h>
 #include <Navigation/Utils/RecastNavigationMesh.h>
 
@@ -33,6 +34,7 @@ namespace SparkyStudios::AI::Behave::Navigation
         , public AZ::TickBus::Handler
         , public INavigationMesh
         , protected NavigationMeshNotificationBus::Handler
+        , protected NavigationMeshStatisticsRequestBus::Handler
         , private LmbrCentral::ShapeComponentNotificationsBus::Handler
         , private AzFramework::EntityDebugDisplayEventBus::Handler
         , private AZ::Data::AssetBus::Handler
@@ -70,6 +72,12 @@ namespace SparkyStudios::AI::Behave::Navigation
 
         // SparkyStudios::AI::Behave::Navigation::NavigationMeshNotificationBus
         void OnNavigationMeshUpdated() override;
+        void OnNavigationMeshBuildProgress(float progress, float remainingTime) override;
+        void OnNavigationMeshBuildCancelled() override;
+
+        // SparkyStudios::AI::Behave::Navigation::NavigationMeshStatisticsRequestBus
+        NavigationMeshBuildStatistics GetBuildStatistics() override;
+        AZStd::string DumpBuildStatistics(bool includeTiles) override;
 
         // LmbrCentral::ShapeComponentNotificationsBus
         void OnShapeChanged(ShapeChangeReasons changeReason) override;
@@ -84,24 +92,44 @@ namespace SparkyStudios::AI::Behave::Navigation
 
     private:
         using NavigationAgentList = AZStd::vector<AZStd::pair<AZ::u32, AZStd::string>>;
+        using TuningCandidateList = AZStd::vector<AZStd::pair<int, AZStd::string>>;
 
         void SetSettings(const AZ::Data::Asset<AZ::Data::AssetData>& settings = {});
         void UpdateNavMeshAABB();
 
         AZ::Crc32 OnBuildNavigationMesh();
+        AZ::Crc32 OnCancelNavigationMeshBuild();
+        AZ::Crc32 OnPrintBuildStatistics();
         [[nodiscard]] bool IsNavigationMeshBuilding() const;
+        [[nodiscard]] AZStd::string GetBuildButtonText() const;
+        [[nodiscard]] AZ::Crc32 GetCancelButtonVisibility() const;
+
+        AZ::Crc32 OnTuneSettings();
+        AZ::Crc32 OnApplyTuningCandidate();
+        AZ::Crc32 OnSelectNextTuningCandidate();
+        AZ::Crc32 OnPrintTuningResults();
+        [[nodiscard]] AZStd::string GetTuneButtonText() const;
+        [[nodiscard]] AZStd::string GetTuningCandidateText() const;
+        [[nodiscard]] AZ::Crc32 GetTuningResultsVisibility() const;
+        [[nodiscard]] TuningCandidateList BuildTuningCandidateList() const;
+        bool SaveSettings();
 
         AZ::Transform _currentEntityTransform{};
 
         bool _enableDebug = false;
         bool _depthTest = false;
+        float _debugDrawDistance = 200.0f;
         RecastNavMeshDebugDraw _debugDraw{};
 
         AZ::Data::Asset<NavigationMeshSettingsAsset> _settings{};
         AZ::Aabb _aabb = AZ::Aabb::CreateNull();
         OffMeshConnections _offMeshConnections;
 
-        AZStd::atomic_bool _waitingOnNavMeshBuild = false;
+        float _buildProgress = 0.0f;
+        float _buildRemainingTime = -1.0f;
         RecastNavigationMesh* _navigationMesh = nullptr;
+
+        NavigationMeshSettingsTuner _tuner;
+        int _tuningCandidate = -1;
     };
 } // namespace SparkyStudios::AI::Behave::Navigation
@@ -52,10 +52,18 @@ namespace SparkyStudios::AI::Behave::Navigation
     void NavigationAreaComponent::Activate()
     {
         NavigationAreaRequestBus::Handler::BusConnect(GetEntityId());
+        NavigationMeshObjectRequestBus::Handler::BusConnect();
+
+        NavigationMeshObjectNotificationBus::Broadcast(
+            &NavigationMeshObjectNotificationBus::Events::OnNavigationMeshObjectActivated, GetEntityId());
     }
 
     void NavigationAreaComponent::Deactivate()
     {
+        NavigationMeshObjectNotificationBus::Broadcast(
+            &NavigationMeshObjectNotificationBus::Events::OnNavigationMeshObjectDeactivated, GetEntityId());
+
+        NavigationMeshObjectRequestBus::Handler::BusDisconnect();
         NavigationAreaRequestBus::Handler::BusDisconnect(GetEntityId());
     }
 
@@ -74,4 +82,9 @@ namespace SparkyStudios::AI::Behave::Navigation
     {
         return _polygonPrism;
     }
+
+    AZ::EntityId NavigationAreaComponent::GetNavigationMeshObject()
+    {
+        return GetEntityId();
+    }
 } // namespace SparkyStudios::AI::Behave::Navigation
@@ -26,6 +26,7 @@ namespace SparkyStudios::AI::Behave::Navigation
     class NavigationAreaComponent
         : public AZ::Component
         , public NavigationAreaRequestBus::Handler
+        , public NavigationMeshObjectRequestBus::Handler
     {
     public:
         AZ_COMPONENT(NavigationAreaComponent, "{2D8C08DA-9A0B-4644-AA1E-D71C5A08F46D}");
@@ -45,6 +46,9 @@ namespace SparkyStudios::AI::Behave::Navigation
         NavigationArea GetNavigationMeshArea() override;
         AZ::PolygonPrism GetNavigationMeshAreaPolygon() override;
 
+        // NavigationMeshObjectRequestBus
+        AZ::EntityId GetNavigationMeshObject() override;
+
     private:
         NavigationArea _area;
         AZ::PolygonPrism _polygonPrism;
@@ -18,10 +18,18 @@ namespace SparkyStudios::AI::Behave::Navigation
     void WalkableComponent::Activate()
     {
         WalkableRequestBus::Handler::BusConnect(GetEntityId());
+        NavigationMeshObjectRequestBus::Handler::BusConnect();
+
+        NavigationMeshObjectNotificationBus::Broadcast(
+            &NavigationMeshObjectNotificationBus::Events::OnNavigationMeshObjectActivated, GetEntityId());
     }
 
     void WalkableComponent::Deactivate()
     {
+        NavigationMeshObjectNotificationBus::Broadcast(
+            &NavigationMeshObjectNotificationBus::Events::OnNavigationMeshObjectDeactivated, GetEntityId());
+
+        NavigationMeshObjectRequestBus::Handler::BusDisconnect();
         WalkableRequestBus::Handler::BusDisconnect();
     }
 } // namespace SparkyStudios::AI::Behave::Navigation
@@ -22,6 +22,7 @@ namespace SparkyStudios::AI::Behave::Navigation
     class WalkableComponent
         : public AZ::Component
         , public WalkableRequestBus::Handler
+        , public NavigationMeshObjectRequestBus::Handler
     {
         friend class WalkableEditorComponent;
 
@@ -44,6 +45,14 @@ namespace SparkyStudios::AI::Behave::Navigation
         }
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // NavigationMeshObjectRequestBus
+        AZ::EntityId GetNavigationMeshObject() override
+        {
+            return GetEntityId();
+        }
+        //////////////////////////////////////////////////////////////////////////
+
     private:
         bool m_isWalkable = true;
     };
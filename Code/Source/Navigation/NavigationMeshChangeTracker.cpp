@@ -0,0 +1,180 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Navigation/NavigationMeshChangeTracker.h>
+
+#include <AzCore/EBus/Results.h>
+#include <AzCore/Math/PolygonPrism.h>
+
+#include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    NavigationMeshChangeTracker::~NavigationMeshChangeTracker()
+    {
+        Stop();
+    }
+
+    void NavigationMeshChangeTracker::Start()
+    {
+        Stop();
+
+        NavigationMeshObjectNotificationBus::Handler::BusConnect();
+
+        // Objects activated before us are part of the initial build, only track their future changes.
+        AZ::EBusAggregateResults<AZ::EntityId> objects;
+        NavigationMeshObjectRequestBus::BroadcastResult(objects, &NavigationMeshObjectRequestBus::Events::GetNavigationMeshObject);
+
+        for (const AZ::EntityId& entityId : objects.values)
+        {
+            Track(entityId);
+        }
+    }
+
+    void NavigationMeshChangeTracker::Stop()
+    {
+        NavigationMeshObjectNotificationBus::Handler::BusDisconnect();
+        AZ::TransformNotificationBus::MultiHandler::BusDisconnect();
+        LmbrCentral::ShapeComponentNotificationsBus::MultiHandler::BusDisconnect();
+
+        _objects.clear();
+        _dirtyBounds.clear();
+    }
+
+    bool NavigationMeshChangeTracker::ConsumeDirtyBounds(AZStd::vector<AZ::Aabb>& bounds)
+    {
+        bounds.clear();
+        bounds.swap(_dirtyBounds);
+
+        return !bounds.empty();
+    }
+
+    void NavigationMeshChangeTracker::OnNavigationMeshObjectActivated(const AZ::EntityId& entityId)
+    {
+        MarkDirty(Track(entityId).mWorldBounds);
+    }
+
+    void NavigationMeshChangeTracker::OnNavigationMeshObjectDeactivated(const AZ::EntityId& entityId)
+    {
+        const auto it = _objects.find(entityId);
+        if (it == _objects.end())
+            return;
+
+        MarkDirty(it->second.mWorldBounds);
+        _objects.erase(it);
+        AZ::TransformNotificationBus::MultiHandler::BusDisconnect(entityId);
+        LmbrCentral::ShapeComponentNotificationsBus::MultiHandler::BusDisconnect(entityId);
+    }
+
+    void NavigationMeshChangeTracker::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
+    {
+        const AZ::EntityId* entityId = AZ::TransformNotificationBus::GetCurrentBusId();
+        if (entityId == nullptr)
+            return;
+
+        const auto it = _objects.find(*entityId);
+        if (it == _objects.end())
+            return;
+
+        // The object leaves its previous bounds, and enters the new ones.
+        TrackedObject& object = it->second;
+        MarkDirty(object.mWorldBounds);
+
+        if (object.mLocalBounds.IsValid())
+            object.mWorldBounds = object.mLocalBounds.GetTransformedAabb(world);
+
+        MarkDirty(object.mWorldBounds);
+    }
+
+    void NavigationMeshChangeTracker::OnShapeChanged(
+        [[maybe_unused]] LmbrCentral::ShapeComponentNotifications::ShapeChangeReasons changeReason)
+    {
+        const AZ::EntityId* entityId = LmbrCentral::ShapeComponentNotificationsBus::GetCurrentBusId();
+        if (entityId == nullptr)
+            return;
+
+        const auto it = _objects.find(*entityId);
+        if (it == _objects.end())
+            return;
+
+        MarkDirty(it->second.mWorldBounds);
+
+        it->second = GetObjectBounds(*entityId);
+        MarkDirty(it->second.mWorldBounds);
+    }
+
+    NavigationMeshChangeTracker::TrackedObject NavigationMeshChangeTracker::GetObjectBounds(const AZ::EntityId& entityId)
+    {
+        TrackedObject object;
+
+        AZ::Transform worldTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(worldTM, entityId, &AZ::TransformBus::Events::GetWorldTM);
+
+        bool isArea = false;
+        NavigationAreaRequestBus::EventResult(isArea, entityId, &NavigationAreaRequestBus::Events::IsNavigationMeshArea, AZ::EntityId());
+
+        if (isArea)
+        {
+            // Navigation areas are extruded from their polygon, up to the prism height.
+            AZ::PolygonPrism prism;
+            NavigationAreaRequestBus::EventResult(prism, entityId, &NavigationAreaRequestBus::Events::GetNavigationMeshAreaPolygon);
+
+            for (size_t i = 0, l = prism.m_vertexContainer.Size(); i < l; ++i)
+            {
+                const AZ::Vector2& vertex = prism.m_vertexContainer[i];
+                object.mLocalBounds.AddPoint(AZ::Vector3(vertex.GetX(), vertex.GetY(), 0.0f));
+                object.mLocalBounds.AddPoint(AZ::Vector3(vertex.GetX(), vertex.GetY(), prism.GetHeight()));
+            }
+        }
+        else
+        {
+            AZ::Transform shapeTM = AZ::Transform::CreateIdentity();
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::ShapeComponentRequestsBus::Events::GetTransformAndLocalBounds, shapeTM, object.mLocalBounds);
+        }
+
+        if (!object.mLocalBounds.IsValid())
+        {
+            // Walkables are usually physics colliders without a shape, get back to local space so the bounds follow the transform.
+            AZ::Aabb worldBounds = AZ::Aabb::CreateNull();
+            AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+                worldBounds, entityId, &AzPhysics::SimulatedBodyComponentRequests::GetAabb);
+
+            if (worldBounds.IsValid())
+                object.mLocalBounds = worldBounds.GetTransformedAabb(worldTM.GetInverse());
+        }
+
+        if (object.mLocalBounds.IsValid())
+            object.mWorldBounds = object.mLocalBounds.GetTransformedAabb(worldTM);
+
+        return object;
+    }
+
+    NavigationMeshChangeTracker::TrackedObject& NavigationMeshChangeTracker::Track(const AZ::EntityId& entityId)
+    {
+        TrackedObject& object = _objects[entityId];
+        object = GetObjectBounds(entityId);
+
+        AZ::TransformNotificationBus::MultiHandler::BusConnect(entityId);
+        LmbrCentral::ShapeComponentNotificationsBus::MultiHandler::BusConnect(entityId);
+
+        return object;
+    }
+
+    void NavigationMeshChangeTracker::MarkDirty(const AZ::Aabb& bounds)
+    {
+        if (bounds.IsValid())
+            _dirtyBounds.push_back(bounds);
+    }
+} // namespace SparkyStudios::AI::Behave::Navigation
@@ -0,0 +1,87 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <SparkyStudios/AI/Behave/Navigation/NavigationMeshBus.h>
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <LmbrCentral/Shape/ShapeComponentBus.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    /**
+     * @brief Tracks the walkables and navigation areas taking part in navigation meshes generation, and accumulates
+     * the world bounds in which the navigation mesh is outdated when they move, change their shape, appear or disappear.
+     *
+     * Dirty bounds are accumulated between frames, and consumed by the navigation mesh to rebuild the overlapped tiles.
+     */
+    class NavigationMeshChangeTracker
+        : private NavigationMeshObjectNotificationBus::Handler
+        , private AZ::TransformNotificationBus::MultiHandler
+        , private LmbrCentral::ShapeComponentNotificationsBus::MultiHandler
+    {
+    public:
+        NavigationMeshChangeTracker() = default;
+        ~NavigationMeshChangeTracker() override;
+
+        /**
+         * @brief Starts tracking the currently active navigation mesh objects, and the ones activated later.
+         */
+        void Start();
+
+        /**
+         * @brief Stops tracking navigation mesh objects, and drops the accumulated dirty bounds.
+         */
+        void Stop();
+
+        /**
+         * @brief Moves the world bounds accumulated since the last call into the given vector.
+         *
+         * @param bounds The vector receiving the dirty bounds. Its previous content is dropped.
+         *
+         * @return true if there were dirty bounds, false otherwise.
+         */
+        bool ConsumeDirtyBounds(AZStd::vector<AZ::Aabb>& bounds);
+
+    private:
+        struct TrackedObject
+        {
+            AZ::Aabb mLocalBounds = AZ::Aabb::CreateNull();
+            AZ::Aabb mWorldBounds = AZ::Aabb::CreateNull();
+        };
+
+        // NavigationMeshObjectNotificationBus
+        void OnNavigationMeshObjectActivated(const AZ::EntityId& entityId) override;
+        void OnNavigationMeshObjectDeactivated(const AZ::EntityId& entityId) override;
+
+        // AZ::TransformNotificationBus
+        void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
+
+        // LmbrCentral::ShapeComponentNotificationsBus
+        void OnShapeChanged(LmbrCentral::ShapeComponentNotifications::ShapeChangeReasons changeReason) override;
+
+        static TrackedObject GetObjectBounds(const AZ::EntityId& entityId);
+
+        TrackedObject& Track(const AZ::EntityId& entityId);
+        void MarkDirty(const AZ::Aabb& bounds);
+
+        AZStd::unordered_map<AZ::EntityId, TrackedObject> _objects;
+        AZStd::vector<AZ::Aabb> _dirtyBounds;
+    };
+} // namespace SparkyStudios::AI::Behave::Navigation
@@ -0,0 +1,344 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Navigation/NavigationMeshRegistry.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    // Maximum number of navigation meshes in a leaf of the bounding volume hierarchy.
+    static constexpr AZ::u32 kMaxLeafSize = 2;
+
+    // Maximum depth of the bounding volume hierarchy. The hierarchy is split at the median, so it is never reached.
+    static constexpr size_t kMaxDepth = 64;
+
+    static float GetVolume(const AZ::Aabb& bounds)
+    {
+        const AZ::Vector3 extents = bounds.GetExtents();
+        return extents.GetX() * extents.GetY() * extents.GetZ();
+    }
+
+    void NavigationMeshRegistry::Register(
+        const AZ::EntityId& navigationMesh, const AZ::Aabb& bounds, const OffMeshConnections& offMeshConnections)
+    {
+        if (!navigationMesh.IsValid() || !bounds.IsValid())
+            return;
+
+        auto it = AZStd::find_if(
+            _entries.begin(), _entries.end(),
+            [&navigationMesh](const Entry& entry)
+            {
+                return entry.mNavigationMesh == navigationMesh;
+            });
+
+        if (it == _entries.end())
+            it = _entries.emplace(_entries.end());
+
+        it->mNavigationMesh = navigationMesh;
+        it->mBounds = bounds;
+        it->mConnections = offMeshConnections.mConnections;
+
+        Rebuild();
+    }
+
+    bool NavigationMeshRegistry::Unregister(const AZ::EntityId& navigationMesh)
+    {
+        const auto it = AZStd::find_if(
+            _entries.begin(), _entries.end(),
+            [&navigationMesh](const Entry& entry)
+            {
+                return entry.mNavigationMesh == navigationMesh;
+            });
+
+        if (it == _entries.end())
+            return false;
+
+        _entries.erase(it);
+        Rebuild();
+
+        return true;
+    }
+
+    AZ::EntityId NavigationMeshRegistry::Find(const AZ::Vector3& position) const
+    {
+        const AZ::u32 index = FindIndex(position);
+        return index != kInvalidIndex ? _entries[index].mNavigationMesh : AZ::EntityId();
+    }
+
+    void NavigationMeshRegistry::Query(const AZ::Aabb& bounds, AZStd::vector<AZ::EntityId>& navigationMeshes) const
+    {
+        navigationMeshes.clear();
+
+        Visit(
+            bounds,
+            [this, &navigationMeshes](const AZ::u32 index)
+            {
+                navigationMeshes.push_back(_entries[index].mNavigationMesh);
+            });
+    }
+
+    bool NavigationMeshRegistry::FindRoute(
+        const AZ::Vector3& from, const AZ::Vector3& target, AZStd::vector<NavigationMeshRouteLeg>& legs) const
+    {
+        legs.clear();
+
+        const AZ::u32 source = FindIndex(from);
+        const AZ::u32 destination = FindIndex(target);
+
+        if (source == kInvalidIndex || destination == kInvalidIndex)
+            return false;
+
+        if (source == destination)
+        {
+            legs.push_back({ _entries[source].mNavigationMesh, from, target });
+            return true;
+        }
+
+        // Dijkstra over the links, the last node being the target position.
+        const AZ::u32 linksCount = aznumeric_cast<AZ::u32>(_links.size());
+        const AZ::u32 goal = linksCount;
+
+        AZStd::vector<float> costs(linksCount + 1, AZStd::numeric_limits<float>::max());
+        AZStd::vector<AZ::u32> previous(linksCount + 1, kInvalidIndex);
+
+        using QueueEntry = AZStd::pair<float, AZ::u32>;
+        AZStd::priority_queue<QueueEntry, AZStd::vector<QueueEntry>, AZStd::greater<QueueEntry>> open;
+
+        const auto relaxLinksFrom = [&](const AZ::u32 mesh, const AZ::Vector3& position, const float cost, const AZ::u32 link)
+        {
+            for (AZ::u32 next = _linkStarts[mesh]; next < _linkStarts[mesh + 1]; ++next)
+            {
+                const Link& nextLink = _links[next];
+                const float nextCost = cost + position.GetDistance(nextLink.mStart) + nextLink.mStart.GetDistance(nextLink.mEnd);
+
+                if (nextCost < costs[next])
+                {
+                    costs[next] = nextCost;
+                    previous[next] = link;
+                    open.emplace(nextCost, next);
+                }
+            }
+
+            if (mesh == destination)
+            {
+                const float goalCost = cost + position.GetDistance(target);
+                if (goalCost < costs[goal])
+                {
+                    costs[goal] = goalCost;
+                    previous[goal] = link;
+                    open.emplace(goalCost, goal);
+                }
+            }
+        };
+
+        relaxLinksFrom(source, from, 0.0f, kInvalidIndex);
+
+        while (!open.empty())
+        {
+            const auto [cost, node] = open.top();
+            open.pop();
+
+            if (node == goal)
+                break;
+
+            // Skip outdated queue entries.
+            if (cost > costs[node])
+                continue;
+
+            const Link& link = _links[node];
+            relaxLinksFrom(link.mTo, link.mEnd, cost, node);
+        }
+
+        if (previous[goal] == kInvalidIndex)
+            return false;
+
+        // Walk the links back from the target, then reverse the legs.
+        AZ::Vector3 legEnd = target;
+        for (AZ::u32 link = previous[goal]; link != kInvalidIndex; link = previous[link])
+        {
+            legs.push_back({ _entries[_links[link].mTo].mNavigationMesh, _links[link].mEnd, legEnd });
+            legEnd = _links[link].mStart;
+        }
+
+        legs.push_back({ _entries[source].mNavigationMesh, from, legEnd });
+        AZStd::reverse(legs.begin(), legs.end());
+
+        return true;
+    }
+
+    bool NavigationMeshRegistry::IsEmpty() const
+    {
+        return _entries.empty();
+    }
+
+    void NavigationMeshRegistry::Rebuild()
+    {
+        const AZ::u32 entriesCount = aznumeric_cast<AZ::u32>(_entries.size());
+
+        _order.resize(entriesCount);
+        for (AZ::u32 i = 0; i < entriesCount; ++i)
+            _order[i] = i;
+
+        _nodes.clear();
+        if (entriesCount > 0)
+            BuildNode(0, entriesCount);
+
+        // Off-mesh connections starting in a navigation mesh and landing in another one link them. Connections
+        // staying in the same navigation mesh are already handled by Detour.
+        _links.clear();
+
+        for (AZ::u32 i = 0; i < entriesCount; ++i)
+        {
+            for (const OffMeshConnection& connection : _entries[i].mConnections)
+            {
+                if (!_entries[i].mBounds.Contains(connection.mStart))
+                    continue;
+
+                const AZ::u32 to = FindIndex(connection.mEnd, i);
+                if (to == kInvalidIndex)
+                    continue;
+
+                _links.push_back({ connection.mStart, connection.mEnd, i, to });
+
+                if (connection.mDirection == OffMeshConnectionDirection::Bidirectional)
+                    _links.push_back({ connection.mEnd, connection.mStart, to, i });
+            }
+        }
+
+        AZStd::sort(
+            _links.begin(), _links.end(),
+            [](const Link& a, const Link& b)
+            {
+                return a.mFrom < b.mFrom;
+            });
+
+        _linkStarts.assign(entriesCount + 1, 0);
+        for (const Link& link : _links)
+            ++_linkStarts[link.mFrom + 1];
+
+        for (AZ::u32 i = 0; i < entriesCount; ++i)
+            _linkStarts[i + 1] += _linkStarts[i];
+    }
+
+    AZ::u32 NavigationMeshRegistry::BuildNode(const AZ::u32 first, const AZ::u32 count)
+    {
+        const AZ::u32 index = aznumeric_cast<AZ::u32>(_nodes.size());
+        _nodes.emplace_back();
+
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        AZ::Aabb centers = AZ::Aabb::CreateNull();
+
+        for (AZ::u32 i = first; i < first + count; ++i)
+        {
+            const AZ::Aabb& entryBounds = _entries[_order[i]].mBounds;
+            bounds.AddAabb(entryBounds);
+            centers.AddPoint(entryBounds.GetCenter());
+        }
+
+        _nodes[index].mBounds = bounds;
+
+        if (count <= kMaxLeafSize)
+        {
+            _nodes[index].mFirst = first;
+            _nodes[index].mCount = count;
+            return index;
+        }
+
+        // Split at the median along the axis on which the navigation meshes are the most spread.
+        const AZ::Vector3 spread = centers.GetExtents();
+        int axis = spread.GetX() >= spread.GetY() ? 0 : 1;
+        if (spread.GetZ() > spread.GetElement(axis))
+            axis = 2;
+
+        AZStd::sort(
+            _order.begin() + first, _order.begin() + first + count,
+            [this, axis](const AZ::u32 a, const AZ::u32 b)
+            {
+                return _entries[a].mBounds.GetCenter().GetElement(axis) < _entries[b].mBounds.GetCenter().GetElement(axis);
+            });
+
+        const AZ::u32 half = count / 2;
+
+        BuildNode(first, half);
+        const AZ::u32 right = BuildNode(first + half, count - half);
+
+        _nodes[index].mRight = right;
+
+        return index;
+    }
+
+    template<typename Visitor>
+    void NavigationMeshRegistry::Visit(const AZ::Aabb& bounds, const Visitor& visitor) const
+    {
+        if (_nodes.empty())
+            return;
+
+        AZStd::fixed_vector<AZ::u32, kMaxDepth> stack;
+        stack.push_back(0);
+
+        while (!stack.empty())
+        {
+            const Node& node = _nodes[stack.back()];
+            const AZ::u32 index = stack.back();
+            stack.pop_back();
+
+            if (!node.mBounds.Overlaps(bounds))
+                continue;
+
+            if (node.mCount > 0)
+            {
+                for (AZ::u32 i = node.mFirst; i < node.mFirst + node.mCount; ++i)
+                {
+                    if (_entries[_order[i]].mBounds.Overlaps(bounds))
+                        visitor(_order[i]);
+                }
+
+                continue;
+            }
+
+            stack.push_back(node.mRight);
+            stack.push_back(index + 1);
+        }
+    }
+
+    AZ::u32 NavigationMeshRegistry::FindIndex(const AZ::Vector3& position, const AZ::u32 excluded) const
+    {
+        AZ::u32 found = kInvalidIndex;
+        float foundVolume = AZStd::numeric_limits<float>::max();
+
+        Visit(
+            AZ::Aabb::CreateFromPoint(position),
+            [&](const AZ::u32 index)
+            {
+                if (index == excluded)
+                    return;
+
+                // Nested navigation meshes are more specific than the ones around them.
+                const float volume = GetVolume(_entries[index].mBounds);
+                if (volume < foundVolume)
+                {
+                    found = index;
+                    foundVolume = volume;
+                }
+            });
+
+        return found;
+    }
+} // namespace SparkyStudios::AI::Behave::Navigation
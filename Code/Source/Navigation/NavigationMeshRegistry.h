@@ -0,0 +1,126 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <SparkyStudios/AI/Behave/Navigation/OffMeshConnection.h>
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    /**
+     * @brief A part of a path crossing navigation meshes, going from a position to another on the same navigation mesh.
+     */
+    struct NavigationMeshRouteLeg
+    {
+        AZ::EntityId mNavigationMesh;
+        AZ::Vector3 mStart = AZ::Vector3::CreateZero();
+        AZ::Vector3 mEnd = AZ::Vector3::CreateZero();
+    };
+
+    /**
+     * @brief Indexes the active navigation meshes by their world bounds in a bounding volume hierarchy, and links them
+     * through the off-mesh connections going from a navigation mesh to another.
+     *
+     * The hierarchy and the links are rebuilt when navigation meshes are registered or unregistered, which only happens
+     * when they are activated or deactivated. Queries don't modify the registry, and can be made concurrently.
+     */
+    class NavigationMeshRegistry
+    {
+    public:
+        /**
+         * @brief Adds a navigation mesh, or updates it if it was already registered.
+         */
+        void Register(const AZ::EntityId& navigationMesh, const AZ::Aabb& bounds, const OffMeshConnections& offMeshConnections);
+
+        /**
+         * @brief Removes a navigation mesh.
+         *
+         * @return false if the navigation mesh was not registered.
+         */
+        bool Unregister(const AZ::EntityId& navigationMesh);
+
+        /**
+         * @brief Finds the smallest navigation mesh containing the given position.
+         */
+        [[nodiscard]] AZ::EntityId Find(const AZ::Vector3& position) const;
+
+        /**
+         * @brief Finds the navigation meshes overlapping the given bounds.
+         */
+        void Query(const AZ::Aabb& bounds, AZStd::vector<AZ::EntityId>& navigationMeshes) const;
+
+        /**
+         * @brief Finds the shortest sequence of navigation meshes and off-mesh connections to go from a position to another.
+         *
+         * Distances between off-mesh connections are estimated in straight line, the actual path is found on each
+         * navigation mesh afterward.
+         *
+         * @param from The start position.
+         * @param target The target position.
+         * @param[out] legs The parts of the path on each crossed navigation mesh, in order.
+         *
+         * @return false if a position is not on a navigation mesh, or if the navigation meshes are not linked.
+         */
+        bool FindRoute(const AZ::Vector3& from, const AZ::Vector3& target, AZStd::vector<NavigationMeshRouteLeg>& legs) const;
+
+        [[nodiscard]] bool IsEmpty() const;
+
+    private:
+        static constexpr AZ::u32 kInvalidIndex = ~0u;
+
+        struct Entry
+        {
+            AZ::EntityId mNavigationMesh;
+            AZ::Aabb mBounds = AZ::Aabb::CreateNull();
+            AZStd::vector<OffMeshConnection> mConnections;
+        };
+
+        // Leaf nodes reference mCount entries from mFirst in _order. The left child of an inner node is the next node.
+        struct Node
+        {
+            AZ::Aabb mBounds = AZ::Aabb::CreateNull();
+            AZ::u32 mFirst = 0;
+            AZ::u32 mCount = 0;
+            AZ::u32 mRight = 0;
+        };
+
+        struct Link
+        {
+            AZ::Vector3 mStart;
+            AZ::Vector3 mEnd;
+            AZ::u32 mFrom;
+            AZ::u32 mTo;
+        };
+
+        void Rebuild();
+        AZ::u32 BuildNode(AZ::u32 first, AZ::u32 count);
+
+        template<typename Visitor>
+        void Visit(const AZ::Aabb& bounds, const Visitor& visitor) const;
+
+        [[nodiscard]] AZ::u32 FindIndex(const AZ::Vector3& position, AZ::u32 excluded = kInvalidIndex) const;
+
+        AZStd::vector<Entry> _entries;
+        AZStd::vector<AZ::u32> _order;
+        AZStd::vector<Node> _nodes;
+
+        // Links sorted by the navigation mesh they start from, and the range of links starting from each navigation mesh.
+        AZStd::vector<Link> _links;
+        AZStd::vector<AZ::u32> _linkStarts;
+    };
+} // namespace SparkyStudios::AI::Behave::Navigation
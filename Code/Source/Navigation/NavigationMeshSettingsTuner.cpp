@@ -0,0 +1,500 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Navigation/NavigationMeshSettingsTuner.h>
+
+#include <DetourCommon.h>
+#include <DetourNavMeshQuery.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    // Scales applied to the base settings to build the parameters grid.
+    static constexpr float kCellSizeScales[] = { 0.75f, 1.0f, 1.5f };
+    static constexpr float kCellHeightScales[] = { 1.0f, 1.5f };
+    static constexpr float kTileSizeScales[] = { 0.5f, 1.0f, 2.0f };
+    static constexpr float kEdgeMaxErrorScales[] = { 0.75f, 1.0f, 1.5f };
+    static constexpr int kDetailSampleDistScales[] = { 1, 2 };
+
+    // Maximum number of candidates built at the same time. Each build runs in its own job.
+    static constexpr AZ::u32 kMaxConcurrentBuilds = 4;
+
+    // Number of paths queried on each candidate navigation mesh.
+    static constexpr AZ::u32 kPathSamplesCount = 64;
+
+    static constexpr int kMaxPathLength = 256;
+
+    static void CopySettings(const NavigationMeshSettingsAsset& from, NavigationMeshSettingsAsset& to)
+    {
+        to.m_name = from.m_name;
+        to.m_agent = from.m_agent;
+        to.m_borderPadding = from.m_borderPadding;
+        to.m_cellSize = from.m_cellSize;
+        to.m_cellHeight = from.m_cellHeight;
+        to.m_regionMinSize = from.m_regionMinSize;
+        to.m_regionMergedSize = from.m_regionMergedSize;
+        to.m_partitionType = from.m_partitionType;
+        to.m_filterLowHangingObstacles = from.m_filterLowHangingObstacles;
+        to.m_filterLedgeSpans = from.m_filterLedgeSpans;
+        to.m_filterWalkableLowHeightSpans = from.m_filterWalkableLowHeightSpans;
+        to.m_edgeMaxError = from.m_edgeMaxError;
+        to.m_edgeMaxLength = from.m_edgeMaxLength;
+        to.m_maxVerticesPerPoly = from.m_maxVerticesPerPoly;
+        to.m_detailSampleDist = from.m_detailSampleDist;
+        to.m_detailSampleMaxError = from.m_detailSampleMaxError;
+        to.m_enableTiling = from.m_enableTiling;
+        to.m_tileSize = from.m_tileSize;
+        to.m_enableStreaming = from.m_enableStreaming;
+        to.m_streamingRadius = from.m_streamingRadius;
+        to.m_streamingMemoryBudget = from.m_streamingMemoryBudget;
+        to.m_streamingHotSetBudget = from.m_streamingHotSetBudget;
+    }
+
+    // Returns true if a is at least as good as b on every measure, and better on one of them.
+    static bool Dominates(const NavigationMeshTuningCandidate& a, const NavigationMeshTuningCandidate& b)
+    {
+        const float as[] = { a.mBuildTime, aznumeric_cast<float>(a.mNavigationMeshSize), a.mQueryTime, a.mPathLengthError,
+                             1.0f - a.mPathSuccessRate };
+        const float bs[] = { b.mBuildTime, aznumeric_cast<float>(b.mNavigationMeshSize), b.mQueryTime, b.mPathLengthError,
+                             1.0f - b.mPathSuccessRate };
+
+        bool better = false;
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(as); ++i)
+        {
+            if (as[i] > bs[i])
+                return false;
+
+            better = better || as[i] < bs[i];
+        }
+
+        return better;
+    }
+
+    void NavigationMeshTuningCandidate::ApplyTo(NavigationMeshSettingsAsset& settings) const
+    {
+        settings.m_cellSize = mCellSize;
+        settings.m_cellHeight = mCellHeight;
+        settings.m_tileSize = mTileSize;
+        settings.m_edgeMaxError = mEdgeMaxError;
+        settings.m_detailSampleDist = mDetailSampleDist;
+    }
+
+    NavigationMeshSettingsTuner::CandidateBuild::CandidateBuild(
+        const AZ::EntityId& entityId,
+        const NavigationMeshSettingsAsset& settings,
+        const AZ::Aabb& aabb,
+        const OffMeshConnections& offMeshConnections,
+        const AZ::u32 candidate)
+        : mAabb(aabb)
+        , mOffMeshConnections(offMeshConnections)
+        , mCandidate(candidate)
+        , mNavigationMesh(entityId, true)
+    {
+        CopySettings(settings, mSettings);
+    }
+
+    const NavigationMeshSettingsAsset* NavigationMeshSettingsTuner::CandidateBuild::GetSettings() const
+    {
+        return &mSettings;
+    }
+
+    const AZ::Aabb& NavigationMeshSettingsTuner::CandidateBuild::GetBoundingBox() const
+    {
+        return mAabb;
+    }
+
+    const OffMeshConnections& NavigationMeshSettingsTuner::CandidateBuild::GetOffMeshConnections() const
+    {
+        return mOffMeshConnections;
+    }
+
+    NavigationMeshSettingsTuner::~NavigationMeshSettingsTuner()
+    {
+        Cancel();
+    }
+
+    bool NavigationMeshSettingsTuner::Start(const AZ::EntityId& entityId, const INavigationMesh* navMesh)
+    {
+        Cancel();
+
+        if (navMesh == nullptr || navMesh->GetSettings() == nullptr || !navMesh->GetBoundingBox().IsValid())
+            return false;
+
+        // Gathering the geometry queries the physics scene, it is only done once for all the candidates.
+        RecastNavigationMesh navigationMesh(entityId, true);
+        if (!navigationMesh.GatherGeometry(navMesh, _geometry, _areaConvexVolumes))
+        {
+            AZ_Warning("BehaveAI [Navigation]", false, "Settings tuner: no geometry was found in the navigation mesh bounds.");
+            return false;
+        }
+
+        _entityId = entityId;
+        _navMesh = navMesh;
+
+        CreateCandidates(*navMesh->GetSettings());
+        CreateSamples();
+
+        _pathLengths.assign(_candidates.size(), {});
+        _nextCandidate = 0;
+        _evaluatedCount = 0;
+        _running = !_candidates.empty();
+
+        return _running;
+    }
+
+    void NavigationMeshSettingsTuner::Cancel()
+    {
+        // Destroying the navigation meshes cancels their builds.
+        _builds.clear();
+        _running = false;
+
+        _geometry.reset();
+        _areaConvexVolumes.reset();
+    }
+
+    void NavigationMeshSettingsTuner::Update()
+    {
+        if (!_running)
+            return;
+
+        // Evaluate the completed builds. Build notifications are not processed, so the navigation mesh entity is not notified.
+        for (auto it = _builds.begin(); it != _builds.end();)
+        {
+            if ((*it)->mNavigationMesh.IsBuilding())
+            {
+                ++it;
+                continue;
+            }
+
+            Evaluate(**it);
+            ++_evaluatedCount;
+
+            it = _builds.erase(it);
+        }
+
+        const AZ::u32 maxBuilds = AZStd::clamp(AZStd::thread::hardware_concurrency() / 2, 1u, kMaxConcurrentBuilds);
+        const AZ::u32 candidatesCount = aznumeric_cast<AZ::u32>(_candidates.size());
+
+        while (_builds.size() < maxBuilds && _nextCandidate < candidatesCount)
+        {
+            const NavigationMeshTuningCandidate& candidate = _candidates[_nextCandidate];
+
+            auto build = AZStd::make_unique<CandidateBuild>(
+                _entityId, *_navMesh->GetSettings(), _navMesh->GetBoundingBox(), _navMesh->GetOffMeshConnections(), _nextCandidate);
+
+            candidate.ApplyTo(build->mSettings);
+
+            // Candidates are fully built, to measure the whole navigation mesh.
+            build->mSettings.m_enableStreaming = false;
+
+            if (build->mNavigationMesh.BuildNavigationMesh(build.get(), _geometry, _areaConvexVolumes))
+                _builds.push_back(AZStd::move(build));
+            else
+                ++_evaluatedCount;
+
+            ++_nextCandidate;
+        }
+
+        if (_evaluatedCount == candidatesCount)
+            Finish();
+    }
+
+    bool NavigationMeshSettingsTuner::IsRunning() const
+    {
+        return _running;
+    }
+
+    float NavigationMeshSettingsTuner::GetProgress() const
+    {
+        return _candidates.empty() ? 0.0f : aznumeric_cast<float>(_evaluatedCount) / aznumeric_cast<float>(_candidates.size());
+    }
+
+    const AZStd::vector<NavigationMeshTuningCandidate>& NavigationMeshSettingsTuner::GetCandidates() const
+    {
+        return _candidates;
+    }
+
+    AZStd::string NavigationMeshSettingsTuner::DumpParetoTable(const bool includeAll) const
+    {
+        AZStd::vector<const NavigationMeshTuningCandidate*> rows;
+        for (const auto& candidate : _candidates)
+        {
+            if (candidate.mBuilt && (includeAll || candidate.mParetoOptimal))
+                rows.push_back(&candidate);
+        }
+
+        AZStd::sort(
+            rows.begin(), rows.end(),
+            [](const NavigationMeshTuningCandidate* a, const NavigationMeshTuningCandidate* b)
+            {
+                return a->mBuildTime < b->mBuildTime;
+            });
+
+        AZStd::string table = "  # | Pareto | Cell Size | Cell Height | Tile Size | Edge Error | Detail Dist | Build (ms) | Peak (KB) | "
+                              "Mesh (KB) | Polygons | Success | Length Error | Query (us)\n";
+
+        for (const NavigationMeshTuningCandidate* row : rows)
+        {
+            table += AZStd::string::format(
+                "%3d | %6s | %9.2f | %11.2f | %9d | %10.2f | %11d | %10.1f | %9llu | %9llu | %8u | %6.1f%% | %11.1f%% | %10.1f\n",
+                aznumeric_cast<int>(row - _candidates.data()), row->mParetoOptimal ? "yes" : "", row->mCellSize, row->mCellHeight,
+                row->mTileSize, row->mEdgeMaxError, row->mDetailSampleDist, row->mBuildTime,
+                aznumeric_cast<unsigned long long>(row->mPeakMemory / 1024),
+                aznumeric_cast<unsigned long long>(row->mNavigationMeshSize / 1024), row->mPolygonsCount, row->mPathSuccessRate * 100.0f,
+                row->mPathLengthError * 100.0f, row->mQueryTime);
+        }
+
+        return table;
+    }
+
+    void NavigationMeshSettingsTuner::CreateCandidates(const NavigationMeshSettingsAsset& settings)
+    {
+        _candidates.clear();
+
+        for (const float cellSizeScale : kCellSizeScales)
+        {
+            for (const float cellHeightScale : kCellHeightScales)
+            {
+                for (const float tileSizeScale : kTileSizeScales)
+                {
+                    // The tile size is not used without tiling.
+                    if (!settings.m_enableTiling && tileSizeScale != 1.0f)
+                        continue;
+
+                    for (const float edgeMaxErrorScale : kEdgeMaxErrorScales)
+                    {
+                        for (const int detailSampleDistScale : kDetailSampleDistScales)
+                        {
+                            // The detail mesh is disabled, there is nothing to scale.
+                            if (settings.m_detailSampleDist == 0 && detailSampleDistScale != 1)
+                                continue;
+
+                            NavigationMeshTuningCandidate candidate;
+                            candidate.mCellSize = settings.m_cellSize * cellSizeScale;
+                            candidate.mCellHeight = settings.m_cellHeight * cellHeightScale;
+                            candidate.mTileSize =
+                                AZStd::max(8, aznumeric_cast<int>(aznumeric_cast<float>(settings.m_tileSize) * tileSizeScale));
+                            candidate.mEdgeMaxError = settings.m_edgeMaxError * edgeMaxErrorScale;
+                            candidate.mDetailSampleDist = settings.m_detailSampleDist * detailSampleDistScale;
+
+                            // Small tile sizes are clamped, which may give the same parameters twice.
+                            const bool exists = AZStd::any_of(
+                                _candidates.begin(), _candidates.end(),
+                                [&candidate](const NavigationMeshTuningCandidate& other)
+                                {
+                                    return other.mCellSize == candidate.mCellSize && other.mCellHeight == candidate.mCellHeight &&
+                                        other.mTileSize == candidate.mTileSize && other.mEdgeMaxError == candidate.mEdgeMaxError &&
+                                        other.mDetailSampleDist == candidate.mDetailSampleDist;
+                                });
+
+                            if (!exists)
+                                _candidates.push_back(candidate);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void NavigationMeshSettingsTuner::CreateSamples()
+    {
+        _samples.clear();
+
+        const AZ::Aabb& aabb = _navMesh->GetBoundingBox();
+        const AZ::Vector3 min = aabb.GetMin();
+        const AZ::Vector3 extents = aabb.GetExtents();
+
+        // A fixed seed, so sweeps on the same level are comparable.
+        AZ::SimpleLcgRandom random(kPathSamplesCount);
+
+        const auto randomPoint = [&]() -> AZ::Vector3
+        {
+            return AZ::Vector3(
+                min.GetX() + random.GetRandomFloat() * extents.GetX(), min.GetY() + random.GetRandomFloat() * extents.GetY(),
+                aabb.GetCenter().GetZ());
+        };
+
+        for (AZ::u32 i = 0; i < kPathSamplesCount; ++i)
+        {
+            const AZ::Vector3 start = randomPoint();
+            const AZ::Vector3 end = randomPoint();
+            _samples.emplace_back(start, end);
+        }
+    }
+
+    void NavigationMeshSettingsTuner::Evaluate(CandidateBuild& build)
+    {
+        NavigationMeshTuningCandidate& candidate = _candidates[build.mCandidate];
+        AZStd::vector<float>& pathLengths = _pathLengths[build.mCandidate];
+
+        if (!build.mNavigationMesh.IsNavigationMeshReady())
+        {
+            AZ_Warning(
+                "BehaveAI [Navigation]", false, "Settings tuner: the navigation mesh build failed for candidate %u.", build.mCandidate);
+            return;
+        }
+
+        const NavigationMeshBuildStatistics statistics = build.mNavigationMesh.GetBuildStatistics();
+        candidate.mBuildTime = statistics.mBuildTime;
+        candidate.mPeakMemory = statistics.mTotal.mPeakMemory;
+        candidate.mPolygonsCount = statistics.mTotal.mPolygonsCount;
+
+        const RecastNavigationMesh::QueryScope scope(build.mNavigationMesh);
+
+        const dtNavMesh* navMesh = scope.GetNavigationMesh();
+        const dtNavMeshQuery* navMeshQuery = scope.GetNavigationMeshQuery();
+        if (navMesh == nullptr || navMeshQuery == nullptr)
+            return;
+
+        for (int i = 0; i < navMesh->getMaxTiles(); ++i)
+        {
+            if (const dtMeshTile* tile = navMesh->getTile(i); tile != nullptr && tile->header != nullptr)
+                candidate.mNavigationMeshSize += aznumeric_cast<AZ::u64>(tile->dataSize);
+        }
+
+        // Samples are on a horizontal plane at the middle of the bounds, so search through the whole bounds height.
+        const float halfExtents[3] = { 2.0f, build.mAabb.GetExtents().GetZ() * 0.5f + 1.0f, 2.0f };
+        const dtQueryFilter filter;
+
+        dtPolyRef polygons[kMaxPathLength];
+        RecastVector3 corners[kMaxPathLength];
+
+        AZ::u32 succeeded = 0;
+        pathLengths.assign(_samples.size(), -1.0f);
+
+        const auto start = AZStd::chrono::steady_clock::now();
+
+        for (size_t s = 0; s < _samples.size(); ++s)
+        {
+            const RecastVector3 startRecast{ _samples[s].first }, endRecast{ _samples[s].second };
+
+            dtPolyRef startPoly = 0, endPoly = 0;
+            RecastVector3 nearestStart, nearestEnd;
+
+            navMeshQuery->findNearestPoly(startRecast.data(), halfExtents, &filter, &startPoly, nearestStart.data());
+            navMeshQuery->findNearestPoly(endRecast.data(), halfExtents, &filter, &endPoly, nearestEnd.data());
+
+            if (startPoly == 0 || endPoly == 0)
+                continue;
+
+            int polygonsCount = 0;
+            const dtStatus status = navMeshQuery->findPath(
+                startPoly, endPoly, nearestStart.data(), nearestEnd.data(), &filter, polygons, &polygonsCount, kMaxPathLength);
+
+            // Only complete paths are compared.
+            if (dtStatusFailed(status) || polygonsCount == 0 || polygons[polygonsCount - 1] != endPoly)
+                continue;
+
+            int cornersCount = 0;
+            if (dtStatusFailed(navMeshQuery->findStraightPath(
+                    nearestStart.data(), nearestEnd.data(), polygons, polygonsCount, corners[0].data(), nullptr, nullptr, &cornersCount,
+                    kMaxPathLength)))
+            {
+                continue;
+            }
+
+            float length = 0.0f;
+            for (int c = 1; c < cornersCount; ++c)
+                length += dtVdist(corners[c - 1].data(), corners[c].data());
+
+            pathLengths[s] = length;
+            ++succeeded;
+        }
+
+        const float elapsed = aznumeric_cast<float>(
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - start).count());
+
+        candidate.mQueryTime = elapsed / aznumeric_cast<float>(AZStd::max<size_t>(1, _samples.size()));
+        candidate.mPathSuccessRate = aznumeric_cast<float>(succeeded) / aznumeric_cast<float>(AZStd::max<size_t>(1, _samples.size()));
+        candidate.mBuilt = true;
+    }
+
+    void NavigationMeshSettingsTuner::Finish()
+    {
+        _running = false;
+
+        _geometry.reset();
+        _areaConvexVolumes.reset();
+
+        // The finest built candidate is the reference for the paths quality.
+        int reference = -1;
+        for (int i = 0; i < aznumeric_cast<int>(_candidates.size()); ++i)
+        {
+            const NavigationMeshTuningCandidate& candidate = _candidates[i];
+            if (!candidate.mBuilt)
+                continue;
+
+            if (reference < 0 || candidate.mCellSize < _candidates[reference].mCellSize ||
+                (candidate.mCellSize == _candidates[reference].mCellSize &&
+                 (candidate.mCellHeight < _candidates[reference].mCellHeight ||
+                  (candidate.mCellHeight == _candidates[reference].mCellHeight &&
+                   candidate.mEdgeMaxError < _candidates[reference].mEdgeMaxError))))
+            {
+                reference = i;
+            }
+        }
+
+        if (reference < 0)
+        {
+            AZ_Warning("BehaveAI [Navigation]", false, "Settings tuner: no navigation mesh could be built with the swept settings.");
+            return;
+        }
+
+        const AZStd::vector<float>& referenceLengths = _pathLengths[reference];
+
+        for (size_t i = 0; i < _candidates.size(); ++i)
+        {
+            NavigationMeshTuningCandidate& candidate = _candidates[i];
+            if (!candidate.mBuilt)
+                continue;
+
+            float error = 0.0f;
+            AZ::u32 count = 0;
+
+            for (size_t s = 0; s < _samples.size(); ++s)
+            {
+                const float length = _pathLengths[i][s];
+                const float referenceLength = referenceLengths[s];
+
+                if (length < 0.0f || referenceLength <= 0.0f)
+                    continue;
+
+                error += AZStd::abs(length - referenceLength) / referenceLength;
+                ++count;
+            }
+
+            candidate.mPathLengthError = count > 0 ? error / aznumeric_cast<float>(count) : 0.0f;
+        }
+
+        for (auto& candidate : _candidates)
+        {
+            if (!candidate.mBuilt)
+                continue;
+
+            candidate.mParetoOptimal = AZStd::none_of(
+                _candidates.begin(), _candidates.end(),
+                [&candidate](const NavigationMeshTuningCandidate& other)
+                {
+                    return other.mBuilt && Dominates(other, candidate);
+                });
+        }
+
+        AZ_Printf("BehaveAI [Navigation]", "Settings tuner results:\n%s", DumpParetoTable(false).c_str());
+    }
+} // namespace SparkyStudios::AI::Behave::Navigation
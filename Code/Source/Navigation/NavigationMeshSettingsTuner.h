@@ -0,0 +1,189 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <SparkyStudios/AI/Behave/Navigation/INavigationMesh.h>
+
+#include <Navigation/Assets/NavigationMeshSettingsAsset.h>
+#include <Navigation/Utils/RecastNavigationMesh.h>
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    /**
+     * @brief A set of navigation mesh settings evaluated by the tuner, and its measured results.
+     */
+    struct NavigationMeshTuningCandidate
+    {
+        float mCellSize = 0.0f;
+        float mCellHeight = 0.0f;
+        int mTileSize = 0;
+        float mEdgeMaxError = 0.0f;
+        int mDetailSampleDist = 0;
+
+        /**
+         * @brief Whether the navigation mesh was successfully built with these settings.
+         */
+        bool mBuilt = false;
+
+        /**
+         * @brief The wall clock time of the build, in milliseconds.
+         */
+        float mBuildTime = 0.0f;
+
+        /**
+         * @brief The peak memory allocated by Recast while building a tile, in bytes.
+         */
+        AZ::u64 mPeakMemory = 0;
+
+        /**
+         * @brief The size of the built navigation mesh tiles data, in bytes.
+         */
+        AZ::u64 mNavigationMeshSize = 0;
+
+        AZ::u32 mPolygonsCount = 0;
+
+        /**
+         * @brief The ratio of sampled paths reaching their destination.
+         */
+        float mPathSuccessRate = 0.0f;
+
+        /**
+         * @brief The mean relative difference between the sampled paths lengths and the ones of the finest candidate.
+         */
+        float mPathLengthError = 0.0f;
+
+        /**
+         * @brief The mean time of a sampled path query, in microseconds.
+         */
+        float mQueryTime = 0.0f;
+
+        /**
+         * @brief Whether no other candidate is better on every measure.
+         */
+        bool mParetoOptimal = false;
+
+        /**
+         * @brief Copies the candidate parameters into the given settings.
+         */
+        void ApplyTo(NavigationMeshSettingsAsset& settings) const;
+    };
+
+    /**
+     * @brief Sweeps a grid of navigation mesh settings around the current ones against the level geometry.
+     *
+     * The level geometry is gathered once when the sweep starts, and shared by all the candidate builds.
+     * Each candidate is built in its own background job, then sampled paths are queried on it. Once every
+     * candidate is evaluated, the candidates which are not dominated by another one on build time, memory,
+     * query time and path quality are marked as Pareto optimal.
+     */
+    class NavigationMeshSettingsTuner
+    {
+    public:
+        NavigationMeshSettingsTuner() = default;
+        ~NavigationMeshSettingsTuner();
+
+        /**
+         * @brief Starts a new sweep, cancelling the running one.
+         *
+         * @param entityId The navigation mesh entity, used to gather the walkable geometry.
+         * @param navMesh The navigation mesh providing the base settings, the bounds and the off-mesh connections.
+         *
+         * @return false if the navigation mesh has no settings, or no geometry was found in its bounds.
+         */
+        bool Start(const AZ::EntityId& entityId, const INavigationMesh* navMesh);
+
+        /**
+         * @brief Cancels the running sweep. Candidates evaluated so far are kept.
+         */
+        void Cancel();
+
+        /**
+         * @brief Starts the next candidate builds, and evaluates the completed ones.
+         *
+         * This method must be called regularly from the main thread, usually on tick.
+         */
+        void Update();
+
+        /**
+         * @brief Checks if a sweep is running.
+         */
+        [[nodiscard]] bool IsRunning() const;
+
+        /**
+         * @brief Gets the ratio of evaluated candidates of the current sweep.
+         */
+        [[nodiscard]] float GetProgress() const;
+
+        /**
+         * @brief Gets the candidates of the last sweep.
+         */
+        [[nodiscard]] const AZStd::vector<NavigationMeshTuningCandidate>& GetCandidates() const;
+
+        /**
+         * @brief Formats the Pareto optimal candidates as a table, sorted by build time.
+         *
+         * @param includeAll Whether to also include the dominated candidates.
+         */
+        [[nodiscard]] AZStd::string DumpParetoTable(bool includeAll) const;
+
+    private:
+        class CandidateBuild : public INavigationMesh
+        {
+        public:
+            CandidateBuild(
+                const AZ::EntityId& entityId,
+                const NavigationMeshSettingsAsset& settings,
+                const AZ::Aabb& aabb,
+                const OffMeshConnections& offMeshConnections,
+                AZ::u32 candidate);
+
+            // SparkyStudios::AI::Behave::Navigation::INavigationMesh
+            [[nodiscard]] const NavigationMeshSettingsAsset* GetSettings() const override;
+            [[nodiscard]] const AZ::Aabb& GetBoundingBox() const override;
+            [[nodiscard]] const OffMeshConnections& GetOffMeshConnections() const override;
+
+            NavigationMeshSettingsAsset mSettings;
+            AZ::Aabb mAabb;
+            OffMeshConnections mOffMeshConnections;
+            AZ::u32 mCandidate;
+            RecastNavigationMesh mNavigationMesh;
+        };
+
+        void CreateCandidates(const NavigationMeshSettingsAsset& settings);
+        void CreateSamples();
+        void Evaluate(CandidateBuild& build);
+        void Finish();
+
+        AZ::EntityId _entityId;
+        const INavigationMesh* _navMesh = nullptr;
+
+        AZStd::shared_ptr<const RecastNavigationMeshGeometry> _geometry;
+        AZStd::shared_ptr<const RecastAreaConvexVolumes> _areaConvexVolumes;
+
+        AZStd::vector<NavigationMeshTuningCandidate> _candidates;
+        AZStd::vector<AZStd::unique_ptr<CandidateBuild>> _builds;
+        AZ::u32 _nextCandidate = 0;
+        AZ::u32 _evaluatedCount = 0;
+        bool _running = false;
+
+        // Sampled paths start and end positions, and their length for each candidate (negative when no path is found).
+        AZStd::vector<AZStd::pair<AZ::Vector3, AZ::Vector3>> _samples;
+        AZStd::vector<AZStd::vector<float>> _pathLengths;
+    };
+} // namespace SparkyStudios::AI::Behave::Navigation
@@ -16,12 +16,32 @@
 #include <Navigation/Assets/NavigationAreasAsset.h>
 #include <Navigation/Assets/NavigationMeshSettingsAsset.h>
 #include <Navigation/NavigationSystemComponent.h>
+#include <Navigation/Utils/RecastContext.h>
+
+#include <DetourNavMesh.h>
 
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/lock.h>
 
 namespace SparkyStudios::AI::Behave::Navigation
 {
+    NavigationSystemComponent::NavigationSystemComponent()
+    {
+        if (BehaveNavigationInterface::Get() == nullptr)
+        {
+            BehaveNavigationInterface::Register(this);
+        }
+    }
+
+    NavigationSystemComponent::~NavigationSystemComponent()
+    {
+        if (BehaveNavigationInterface::Get() == this)
+        {
+            BehaveNavigationInterface::Unregister(this);
+        }
+    }
+
     void NavigationSystemComponent::Reflect(AZ::ReflectContext* rc)
     {
         NavigationAgentsAsset::Reflect(rc);
@@ -59,9 +79,128 @@ namespace SparkyStudios::AI::Behave::Navigation
 
     void NavigationSystemComponent::Activate()
     {
+        RecastContext::InstallAllocator();
+
+        BehaveNavigationRequestBus::Handler::BusConnect();
     }
 
     void NavigationSystemComponent::Deactivate()
     {
+        BehaveNavigationRequestBus::Handler::BusDisconnect();
+    }
+
+    void NavigationSystemComponent::RegisterNavigationMesh(
+        const AZ::EntityId& navigationMesh, const AZ::Aabb& bounds, const OffMeshConnections& offMeshConnections)
+    {
+        AZStd::unique_lock lock(_registryMutex);
+        _registry.Register(navigationMesh, bounds, offMeshConnections);
+    }
+
+    void NavigationSystemComponent::UnregisterNavigationMesh(const AZ::EntityId& navigationMesh)
+    {
+        AZStd::unique_lock lock(_registryMutex);
+        _registry.Unregister(navigationMesh);
+    }
+
+    AZ::EntityId NavigationSystemComponent::FindNavigationMesh(const AZ::Vector3& position) const
+    {
+        AZStd::shared_lock lock(_registryMutex);
+        return _registry.Find(position);
+    }
+
+    void NavigationSystemComponent::FindNavigationMeshes(const AZ::Aabb& bounds, AZStd::vector<AZ::EntityId>& navigationMeshes) const
+    {
+        AZStd::shared_lock lock(_registryMutex);
+        _registry.Query(bounds, navigationMeshes);
+    }
+
+    bool NavigationSystemComponent::FindNearestPoint(const AZ::Vector3& position, const AZ::Vector3& extents, AZ::Vector3& nearest)
+    {
+        AZStd::vector<AZ::EntityId> navigationMeshes;
+        FindNavigationMeshes(AZ::Aabb::CreateCenterHalfExtents(position, extents.GetAbs()), navigationMeshes);
+
+        bool found = false;
+        float nearestDistanceSq = 0.0f;
+
+        for (const AZ::EntityId& navigationMesh : navigationMeshes)
+        {
+            bool hit = false;
+            AZ::Vector3 point = AZ::Vector3::CreateZero();
+
+            NavigationMeshRequestBus::EventResult(
+                hit, navigationMesh, &NavigationMeshRequests::FindNearestPoint, position, extents, point);
+
+            if (!hit)
+                continue;
+
+            if (const float distanceSq = point.GetDistanceSq(position); !found || distanceSq < nearestDistanceSq)
+            {
+                nearest = point;
+                nearestDistanceSq = distanceSq;
+                found = true;
+            }
+        }
+
+        return found;
+    }
+
+    NavigationPathResult NavigationSystemComponent::FindPath(const AZ::Vector3& from, const AZ::Vector3& target, NavigationPathBuffer& path)
+    {
+        NavigationPathResult result;
+
+        if (path.mCorners == nullptr || path.mCapacity == 0)
+            return result;
+
+        AZStd::vector<NavigationMeshRouteLeg> legs;
+
+        {
+            AZStd::shared_lock lock(_registryMutex);
+            if (!_registry.FindRoute(from, target, legs))
+                return result;
+        }
+
+        AZ::u32 cornersCount = 0;
+
+        for (size_t i = 0; i < legs.size(); ++i)
+        {
+            if (cornersCount == path.mCapacity)
+            {
+                result.mTruncated = true;
+                break;
+            }
+
+            // Each leg writes its corners after the ones of the previous legs.
+            NavigationPathBuffer legPath{ path.mCorners + cornersCount, path.mFlags != nullptr ? path.mFlags + cornersCount : nullptr,
+                                          path.mPolygons != nullptr ? path.mPolygons + cornersCount : nullptr,
+                                          path.mCapacity - cornersCount };
+
+            NavigationPathResult legResult;
+            NavigationMeshRequestBus::EventResult(
+                legResult, legs[i].mNavigationMesh, &NavigationMeshRequests::FindPath, legs[i].mStart, legs[i].mEnd, legPath);
+
+            if (!legResult.mFound)
+            {
+                result.mPartial = true;
+                break;
+            }
+
+            cornersCount += legResult.mCornersCount;
+
+            if (legResult.mPartial || legResult.mTruncated)
+            {
+                result.mPartial = result.mPartial || legResult.mPartial;
+                result.mTruncated = result.mTruncated || legResult.mTruncated;
+                break;
+            }
+
+            // The leg ends where the off-mesh connection to the next navigation mesh starts.
+            if (i + 1 < legs.size() && path.mFlags != nullptr && cornersCount > 0)
+                path.mFlags[cornersCount - 1] = DT_STRAIGHTPATH_OFFMESH_CONNECTION;
+        }
+
+        result.mCornersCount = cornersCount;
+        result.mFound = cornersCount > 0;
+
+        return result;
     }
 } // namespace SparkyStudios::AI::Behave::Navigation
@@ -14,11 +14,18 @@
 
 #pragma once
 
+#include <SparkyStudios/AI/Behave/Navigation/BehaveNavigationBus.h>
+
+#include <Navigation/NavigationMeshRegistry.h>
+
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 namespace SparkyStudios::AI::Behave::Navigation
 {
-    class NavigationSystemComponent : public AZ::Component
+    class NavigationSystemComponent
+        : public AZ::Component
+        , protected BehaveNavigationRequestBus::Handler
     {
     public:
         AZ_COMPONENT(NavigationSystemComponent, "{45F8E5D4-D7DD-47F9-A9A7-2A65C9FE924A}");
@@ -30,13 +37,27 @@ namespace SparkyStudios::AI::Behave::Navigation
         static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
         static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
 
-        NavigationSystemComponent() = default;
-        ~NavigationSystemComponent() override = default;
+        NavigationSystemComponent();
+        ~NavigationSystemComponent() override;
 
     protected:
+        // BehaveNavigationRequestBus
+        void RegisterNavigationMesh(
+            const AZ::EntityId& navigationMesh, const AZ::Aabb& bounds, const OffMeshConnections& offMeshConnections) override;
+        void UnregisterNavigationMesh(const AZ::EntityId& navigationMesh) override;
+        [[nodiscard]] AZ::EntityId FindNavigationMesh(const AZ::Vector3& position) const override;
+        void FindNavigationMeshes(const AZ::Aabb& bounds, AZStd::vector<AZ::EntityId>& navigationMeshes) const override;
+        bool FindNearestPoint(const AZ::Vector3& position, const AZ::Vector3& extents, AZ::Vector3& nearest) override;
+        NavigationPathResult FindPath(const AZ::Vector3& from, const AZ::Vector3& target, NavigationPathBuffer& path) override;
+
         // AZ::Component
         void Init() override;
         void Activate() override;
         void Deactivate() override;
+
+    private:
+        // Navigation meshes are registered on the main thread, while queries may come from any thread.
+        mutable AZStd::shared_mutex _registryMutex;
+        NavigationMeshRegistry _registry;
     };
 } // namespace SparkyStudios::AI::Behave::Navigation
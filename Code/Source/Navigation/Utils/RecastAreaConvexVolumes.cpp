@@ -0,0 +1,213 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Recast.h>
+
+#include <Navigation/NavigationAreaProviderRequestBus.h>
+#include <Navigation/Utils/RecastAreaConvexVolumes.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    // Maximum number of grid cells over each axis of the volumes index.
+    static constexpr int kMaxGridSize = 128;
+
+    RecastAreaConvexVolumes::RecastAreaConvexVolumes()
+        : _gridMin{ 0.0f, 0.0f }
+        , _gridCellSize(1.0f)
+        , _gridWidth(0)
+        , _gridHeight(0)
+    {
+        _areaFlags.fill(0);
+    }
+
+    void RecastAreaConvexVolumes::Add(RecastAreaConvexVolume volume)
+    {
+        if (volume.mVertices.empty())
+            return;
+
+        VolumeBounds bounds{};
+        rcVcopy(bounds.mMin, volume.mVertices.front().data());
+        rcVcopy(bounds.mMax, volume.mVertices.front().data());
+
+        for (const auto& vertex : volume.mVertices)
+        {
+            rcVmin(bounds.mMin, vertex.data());
+            rcVmax(bounds.mMax, vertex.data());
+        }
+
+        bounds.mMin[1] = volume.mHMin;
+        bounds.mMax[1] = volume.mHMax;
+
+        _volumes.push_back(AZStd::move(volume));
+        _bounds.push_back(bounds);
+    }
+
+    void RecastAreaConvexVolumes::Build()
+    {
+        _areaFlags.fill(0);
+
+        BehaveNavigationMeshAreaVector areas;
+        EBUS_EVENT(NavigationAreaProviderRequestBus, GetRegisteredNavigationAreas, areas);
+
+        // Walk the areas backward, so the first registered area wins when IDs are duplicated.
+        for (auto it = areas.rbegin(); it != areas.rend(); ++it)
+            _areaFlags[it->GetId()] = it->GetFlags();
+
+        _cellStarts.clear();
+        _cellVolumes.clear();
+        _gridWidth = 0;
+        _gridHeight = 0;
+
+        if (_volumes.empty())
+            return;
+
+        float gridMax[2] = { _bounds.front().mMax[0], _bounds.front().mMax[2] };
+        _gridMin[0] = _bounds.front().mMin[0];
+        _gridMin[1] = _bounds.front().mMin[2];
+
+        for (const auto& bounds : _bounds)
+        {
+            _gridMin[0] = AZStd::min(_gridMin[0], bounds.mMin[0]);
+            _gridMin[1] = AZStd::min(_gridMin[1], bounds.mMin[2]);
+            gridMax[0] = AZStd::max(gridMax[0], bounds.mMax[0]);
+            gridMax[1] = AZStd::max(gridMax[1], bounds.mMax[2]);
+        }
+
+        // Aim for about one volume per cell.
+        const float extent = AZStd::max(gridMax[0] - _gridMin[0], gridMax[1] - _gridMin[1]);
+        const int cellsPerAxis =
+            AZStd::clamp(aznumeric_cast<int>(AZStd::ceil(AZStd::sqrt(aznumeric_cast<float>(_volumes.size())))), 1, kMaxGridSize);
+
+        _gridCellSize = AZStd::max(extent / aznumeric_cast<float>(cellsPerAxis), 0.01f);
+        _gridWidth = AZStd::clamp(aznumeric_cast<int>((gridMax[0] - _gridMin[0]) / _gridCellSize) + 1, 1, kMaxGridSize);
+        _gridHeight = AZStd::clamp(aznumeric_cast<int>((gridMax[1] - _gridMin[1]) / _gridCellSize) + 1, 1, kMaxGridSize);
+
+        const auto toCell = [this](const float v, const float min, const int size) -> int
+        {
+            return AZStd::clamp(aznumeric_cast<int>((v - min) / _gridCellSize), 0, size - 1);
+        };
+
+        // Count the volumes of each cell, then fill the cells in a single buffer.
+        _cellStarts.resize(_gridWidth * _gridHeight + 1, 0);
+
+        for (const auto& bounds : _bounds)
+        {
+            const int x0 = toCell(bounds.mMin[0], _gridMin[0], _gridWidth), x1 = toCell(bounds.mMax[0], _gridMin[0], _gridWidth);
+            const int y0 = toCell(bounds.mMin[2], _gridMin[1], _gridHeight), y1 = toCell(bounds.mMax[2], _gridMin[1], _gridHeight);
+
+            for (int y = y0; y <= y1; ++y)
+                for (int x = x0; x <= x1; ++x)
+                    ++_cellStarts[y * _gridWidth + x + 1];
+        }
+
+        for (AZStd::size_t i = 1; i < _cellStarts.size(); ++i)
+            _cellStarts[i] += _cellStarts[i - 1];
+
+        _cellVolumes.resize(_cellStarts.back());
+        AZStd::vector<AZ::u32> cellCounts(_gridWidth * _gridHeight, 0);
+
+        for (AZ::u32 i = 0, l = aznumeric_cast<AZ::u32>(_bounds.size()); i < l; ++i)
+        {
+            const VolumeBounds& bounds = _bounds[i];
+
+            const int x0 = toCell(bounds.mMin[0], _gridMin[0], _gridWidth), x1 = toCell(bounds.mMax[0], _gridMin[0], _gridWidth);
+            const int y0 = toCell(bounds.mMin[2], _gridMin[1], _gridHeight), y1 = toCell(bounds.mMax[2], _gridMin[1], _gridHeight);
+
+            for (int y = y0; y <= y1; ++y)
+            {
+                for (int x = x0; x <= x1; ++x)
+                {
+                    const int cell = y * _gridWidth + x;
+                    _cellVolumes[_cellStarts[cell] + cellCounts[cell]++] = i;
+                }
+            }
+        }
+    }
+
+    void RecastAreaConvexVolumes::Clear()
+    {
+        _volumes.clear();
+        _bounds.clear();
+        _cellStarts.clear();
+        _cellVolumes.clear();
+        _gridWidth = 0;
+        _gridHeight = 0;
+    }
+
+    bool RecastAreaConvexVolumes::IsEmpty() const
+    {
+        return _volumes.empty();
+    }
+
+    void RecastAreaConvexVolumes::Query(const float* bMin, const float* bMax, AZStd::vector<const RecastAreaConvexVolume*>& volumes) const
+    {
+        volumes.clear();
+
+        if (_gridWidth == 0 || _gridHeight == 0)
+            return;
+
+        const float gridMaxX = _gridMin[0] + aznumeric_cast<float>(_gridWidth) * _gridCellSize;
+        const float gridMaxY = _gridMin[1] + aznumeric_cast<float>(_gridHeight) * _gridCellSize;
+
+        if (bMax[0] < _gridMin[0] || bMin[0] > gridMaxX || bMax[2] < _gridMin[1] || bMin[2] > gridMaxY)
+            return;
+
+        const auto toCell = [this](const float v, const float min, const int size) -> int
+        {
+            return AZStd::clamp(aznumeric_cast<int>((v - min) / _gridCellSize), 0, size - 1);
+        };
+
+        const int x0 = toCell(bMin[0], _gridMin[0], _gridWidth), x1 = toCell(bMax[0], _gridMin[0], _gridWidth);
+        const int y0 = toCell(bMin[2], _gridMin[1], _gridHeight), y1 = toCell(bMax[2], _gridMin[1], _gridHeight);
+
+        AZStd::vector<AZ::u32> indices;
+
+        for (int y = y0; y <= y1; ++y)
+        {
+            for (int x = x0; x <= x1; ++x)
+            {
+                const int cell = y * _gridWidth + x;
+
+                for (AZ::u32 i = _cellStarts[cell]; i < _cellStarts[cell + 1]; ++i)
+                {
+                    const AZ::u32 index = _cellVolumes[i];
+                    if (Overlaps(_bounds[index], bMin, bMax))
+                        indices.push_back(index);
+                }
+            }
+        }
+
+        // Volumes spanning several cells are found more than once, and later volumes must be marked last.
+        AZStd::sort(indices.begin(), indices.end());
+        indices.erase(AZStd::unique(indices.begin(), indices.end()), indices.end());
+
+        volumes.reserve(indices.size());
+        for (const AZ::u32 index : indices)
+            volumes.push_back(&_volumes[index]);
+    }
+
+    AZ::u16 RecastAreaConvexVolumes::GetAreaFlags(const NavigationAreaId area) const
+    {
+        return _areaFlags[area];
+    }
+
+    bool RecastAreaConvexVolumes::Overlaps(const VolumeBounds& bounds, const float* bMin, const float* bMax)
+    {
+        return bounds.mMin[0] <= bMax[0] && bounds.mMax[0] >= bMin[0] && bounds.mMin[1] <= bMax[1] && bounds.mMax[1] >= bMin[1] &&
+            bounds.mMin[2] <= bMax[2] && bounds.mMax[2] >= bMin[2];
+    }
+} // namespace SparkyStudios::AI::Behave::Navigation
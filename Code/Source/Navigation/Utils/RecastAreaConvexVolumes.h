@@ -0,0 +1,99 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Navigation/Utils/RecastMath.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    /**
+     * @brief Stores the navigation area volumes gathered for a navigation mesh build.
+     *
+     * Volumes are indexed in a uniform 2D grid over their XZ bounds, so each tile only marks the
+     * volumes it intersects. The set also keeps the polygon flags of each registered navigation area.
+     */
+    class RecastAreaConvexVolumes
+    {
+    public:
+        RecastAreaConvexVolumes();
+
+        /**
+         * @brief Adds a volume to the set. The index is outdated until the next call to Build.
+         *
+         * @param volume The volume to add.
+         */
+        void Add(RecastAreaConvexVolume volume);
+
+        /**
+         * @brief Builds the spatial index of the volumes, and the table of the registered navigation areas flags.
+         *
+         * Navigation areas are fetched from the NavigationAreaProviderRequestBus, so this should be called
+         * from the main thread.
+         */
+        void Build();
+
+        /**
+         * @brief Removes all the volumes from the set.
+         */
+        void Clear();
+
+        /**
+         * @brief Checks if the set contains no volume.
+         */
+        [[nodiscard]] bool IsEmpty() const;
+
+        /**
+         * @brief Gets the volumes intersecting the given bounds, in the order they were added.
+         *
+         * @param bMin The minimum corner of the bounds, in Recast coordinates.
+         * @param bMax The maximum corner of the bounds, in Recast coordinates.
+         * @param volumes The vector receiving the intersecting volumes.
+         */
+        void Query(const float* bMin, const float* bMax, AZStd::vector<const RecastAreaConvexVolume*>& volumes) const;
+
+        /**
+         * @brief Gets the polygon flags of a navigation area, or 0 if the area is not registered.
+         *
+         * @param area The navigation area ID.
+         */
+        [[nodiscard]] AZ::u16 GetAreaFlags(NavigationAreaId area) const;
+
+    private:
+        struct VolumeBounds
+        {
+            float mMin[3];
+            float mMax[3];
+        };
+
+        [[nodiscard]] static bool Overlaps(const VolumeBounds& bounds, const float* bMin, const float* bMax);
+
+        AZStd::vector<RecastAreaConvexVolume> _volumes;
+        AZStd::vector<VolumeBounds> _bounds;
+
+        float _gridMin[2];
+        float _gridCellSize;
+        int _gridWidth;
+        int _gridHeight;
+
+        // Volumes of each grid cell, the volumes of the cell i are in [_cellStarts[i], _cellStarts[i + 1]).
+        AZStd::vector<AZ::u32> _cellStarts;
+        AZStd::vector<AZ::u32> _cellVolumes;
+
+        AZStd::array<AZ::u16, 256> _areaFlags;
+    };
+} // namespace SparkyStudios::AI::Behave::Navigation
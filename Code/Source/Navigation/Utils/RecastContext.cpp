@@ -0,0 +1,118 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Navigation/Utils/RecastContext.h>
+
+#include <RecastAlloc.h>
+
+#include <cstdlib>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    // Allocations are prefixed with their size, so freed memory can be accounted for.
+    static constexpr size_t kAllocationHeaderSize = 16;
+
+    // Builds run on a single thread, so memory is tracked per thread to isolate concurrent builds.
+    static thread_local AZ::s64 tCurrentMemory = 0;
+    static thread_local AZ::s64 tPeakMemory = 0;
+
+    static void* TrackedAlloc(const size_t size, [[maybe_unused]] const rcAllocHint hint)
+    {
+        auto* block = static_cast<AZ::u8*>(malloc(size + kAllocationHeaderSize));
+        if (block == nullptr)
+            return nullptr;
+
+        *reinterpret_cast<size_t*>(block) = size;
+
+        tCurrentMemory += aznumeric_cast<AZ::s64>(size);
+        tPeakMemory = AZStd::max(tPeakMemory, tCurrentMemory);
+
+        return block + kAllocationHeaderSize;
+    }
+
+    static void TrackedFree(void* ptr)
+    {
+        if (ptr == nullptr)
+            return;
+
+        // Memory may be freed from another thread than the one which allocated it. Only the peak is
+        // reported, relative to the baseline taken when the tracking starts, so this is fine.
+        auto* block = static_cast<AZ::u8*>(ptr) - kAllocationHeaderSize;
+        tCurrentMemory -= aznumeric_cast<AZ::s64>(*reinterpret_cast<size_t*>(block));
+
+        free(block);
+    }
+
+    void RecastContext::InstallAllocator()
+    {
+        static bool allocatorInstalled = false;
+        if (allocatorInstalled)
+            return;
+
+        rcAllocSetCustom(TrackedAlloc, TrackedFree);
+        allocatorInstalled = true;
+    }
+
+    RecastContext::RecastContext()
+    {
+        doResetTimers();
+    }
+
+    void RecastContext::ResetPeakMemory()
+    {
+        _memoryBaseline = tCurrentMemory;
+        tPeakMemory = tCurrentMemory;
+    }
+
+    AZ::u64 RecastContext::GetPeakMemory() const
+    {
+        return aznumeric_cast<AZ::u64>(AZStd::max<AZ::s64>(0, tPeakMemory - _memoryBaseline));
+    }
+
+    float RecastContext::GetAccumulatedTimeMs(const rcTimerLabel label) const
+    {
+        const int time = getAccumulatedTime(label);
+        return time > 0 ? aznumeric_cast<float>(time) / 1000.0f : 0.0f;
+    }
+
+    void RecastContext::doResetTimers()
+    {
+        for (AZ::s64& time : _accumulatedTimes)
+        {
+            time = -1;
+        }
+    }
+
+    void RecastContext::doStartTimer(const rcTimerLabel label)
+    {
+        _startTimes[label] = AZStd::chrono::steady_clock::now();
+    }
+
+    void RecastContext::doStopTimer(const rcTimerLabel label)
+    {
+        const auto elapsed =
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - _startTimes[label]).count();
+
+        if (_accumulatedTimes[label] < 0)
+            _accumulatedTimes[label] = elapsed;
+        else
+            _accumulatedTimes[label] += elapsed;
+    }
+
+    int RecastContext::doGetAccumulatedTime(const rcTimerLabel label) const
+    {
+        // Times are reported in microseconds.
+        return aznumeric_cast<int>(_accumulatedTimes[label]);
+    }
+} // namespace SparkyStudios::AI::Behave::Navigation
@@ -17,12 +17,41 @@
 #include <Recast.h>
 
 #include <AzCore/AzCoreModule.h>
+#include <AzCore/std/chrono/chrono.h>
 
 namespace SparkyStudios::AI::Behave::Navigation
 {
     class RecastContext final : public rcContext
     {
     public:
+        RecastContext();
+
+        /**
+         * @brief Installs the Recast allocator tracking the memory used by builds. Must be called from the main thread,
+         * before any Recast allocation made by the gem. It is never uninstalled, since memory allocated with it can't be
+         * freed by the default allocator.
+         */
+        static void InstallAllocator();
+
+        /**
+         * @brief Starts tracking the peak memory allocated by Recast from the calling thread.
+         */
+        void ResetPeakMemory();
+
+        /**
+         * @brief Gets the peak memory allocated by Recast from the calling thread since the last
+         * call to ResetPeakMemory, in bytes.
+         */
+        [[nodiscard]] AZ::u64 GetPeakMemory() const;
+
+        /**
+         * @brief Gets the accumulated time of a timer, in milliseconds.
+         *
+         * @param label The timer label.
+         */
+        [[nodiscard]] float GetAccumulatedTimeMs(rcTimerLabel label) const;
+
+    protected:
         void doLog(const rcLogCategory category, const char* message, const int) override
         {
             switch (category)
@@ -41,5 +70,15 @@ namespace SparkyStudios::AI::Behave::Navigation
                 break;
             }
         }
+
+        void doResetTimers() override;
+        void doStartTimer(rcTimerLabel label) override;
+        void doStopTimer(rcTimerLabel label) override;
+        [[nodiscard]] int doGetAccumulatedTime(rcTimerLabel label) const override;
+
+    private:
+        AZStd::chrono::steady_clock::time_point _startTimes[RC_MAX_TIMERS];
+        AZ::s64 _accumulatedTimes[RC_MAX_TIMERS];
+        AZ::s64 _memoryBaseline = 0;
     };
 } // namespace SparkyStudios::AI::Behave::Navigation
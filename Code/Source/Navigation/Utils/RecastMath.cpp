@@ -50,11 +50,12 @@ namespace SparkyStudios::AI::Behave::Navigation
 
         mVertices.clear();
         mIndices.clear();
+        mHeightfields.clear();
     }
 
     bool RecastNavigationMeshGeometry::IsEmpty() const
     {
-        return mVertices.empty();
+        return mVertices.empty() && mHeightfields.empty();
     }
 
     RecastAreaConvexVolume::RecastAreaConvexVolume()
@@ -19,6 +19,7 @@
 
 #include <Navigation/Utils/RecastChunkedGeometry.h>
 #include <Navigation/Utils/RecastSmartPointer.h>
+#include <Navigation/Utils/RecastTerrainHeightfield.h>
 
 #include <AzCore/Math/PolygonPrism.h>
 
@@ -105,15 +106,20 @@ namespace SparkyStudios::AI::Behave::Navigation
          */
         RecastPointer<rcChunkedGeometry> mChunkedGeometry = nullptr;
 
+        /**
+         * @brief The terrain heightfields, rasterized from their samples instead of the vertex and index buffers.
+         */
+        AZStd::vector<AZStd::shared_ptr<const RecastTerrainHeightfield>> mHeightfields;
+
         /**
          * @brief Clear the geometry data.
          */
         void Clear();
 
         /**
-         * @brief Checks if this tile is empty (has no vertices).
+         * @brief Checks if this tile is empty (has no vertices and no heightfields).
          *
-         * @returns true if the tile has no vertices, false otherwise.
+         * @returns true if the tile has no vertices and no heightfields, false otherwise.
          */
         [[nodiscard]] bool IsEmpty() const;
     };
@@ -15,11 +15,46 @@
 #include <Navigation/Utils/RecastNavMeshDebugDraw.h>
 #include <Navigation/Utils/RecastMath.h>
 
+#include <DetourDebugDraw.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+
 namespace SparkyStudios::AI::Behave::Navigation
 {
+    static AZ::u64 HashVertex(const AZ::Vector3& vertex)
+    {
+        size_t seed = 0;
+        AZStd::hash_combine(seed, vertex.GetX());
+        AZStd::hash_combine(seed, vertex.GetY());
+        AZStd::hash_combine(seed, vertex.GetZ());
+
+        return seed;
+    }
+
+    void RecastNavMeshDebugDraw::AddIndexedVertex(TrianglesBatch& batch, const AZ::Vector3& vertex)
+    {
+        const AZ::u64 key = HashVertex(vertex);
+
+        // Share vertices with the same position. On a hash collision, the vertex is simply duplicated.
+        if (const auto it = batch.mVerticesIndex.find(key); it != batch.mVerticesIndex.end() && batch.mVertices[it->second] == vertex)
+        {
+            batch.mIndices.push_back(it->second);
+            return;
+        }
+
+        const AZ::u32 index = aznumeric_cast<AZ::u32>(batch.mVertices.size());
+        batch.mVertices.push_back(vertex);
+        batch.mVerticesIndex[key] = index;
+        batch.mIndices.push_back(index);
+    }
+
     void RecastNavMeshDebugDraw::depthMask([[maybe_unused]] bool state)
     {
-        if (!m_depthTest)
+        // Retained tiles are drawn with a single depth state.
+        if (!m_depthTest || m_recordingTile != nullptr)
             return;
 
         if (state)
@@ -37,6 +72,12 @@ namespace SparkyStudios::AI::Behave::Navigation
 
     void RecastNavMeshDebugDraw::end()
     {
+        if (m_recordingTile != nullptr)
+        {
+            RecordPrimitives();
+            return;
+        }
+
         if (m_debugDisplay == nullptr)
             return;
 
@@ -112,4 +153,243 @@ namespace SparkyStudios::AI::Behave::Navigation
     {
         m_verticesToDraw.push_back(AZStd::make_pair(AZ::Vector3(x, z, y), color));
     }
+
+    void RecastNavMeshDebugDraw::UpdateNavigationMesh(
+        const dtNavMesh& navMesh, const AZ::u32 generation, const AZ::u8 flags, const int maxBakedTiles)
+    {
+        // The navigation mesh was swapped, tile references may be reused by the new one.
+        if (generation != m_generation)
+        {
+            Clear();
+            m_generation = generation;
+        }
+
+        // Detect the tiles added to or removed from the navigation mesh since the last update. The salt
+        // stored in the tile reference changes each time a tile is replaced.
+        AZStd::vector<AZStd::pair<int, int>> changedCells;
+
+        for (auto it = m_knownTiles.begin(); it != m_knownTiles.end();)
+        {
+            if (navMesh.getTileByRef(it->first) == nullptr)
+            {
+                changedCells.push_back(it->second);
+                m_tiles.erase(it->first);
+                it = m_knownTiles.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        for (int i = 0; i < navMesh.getMaxTiles(); ++i)
+        {
+            const dtMeshTile* tile = navMesh.getTile(i);
+            if (tile->header == nullptr)
+                continue;
+
+            if (const dtTileRef ref = navMesh.getTileRef(tile); m_knownTiles.find(ref) == m_knownTiles.end())
+            {
+                m_knownTiles.emplace(ref, AZStd::make_pair(tile->header->x, tile->header->y));
+                changedCells.push_back(AZStd::make_pair(tile->header->x, tile->header->y));
+            }
+        }
+
+        // Tile boundaries depend on the links with the neighbor tiles, so neighbors of changed tiles are baked again.
+        if (!changedCells.empty())
+        {
+            for (auto it = m_tiles.begin(); it != m_tiles.end();)
+            {
+                const TileBatch& batch = it->second;
+                const bool isNeighbor = AZStd::any_of(
+                    changedCells.begin(), changedCells.end(),
+                    [&batch](const AZStd::pair<int, int>& cell)
+                    {
+                        return AZ::GetAbs(cell.first - batch.mX) <= 1 && AZ::GetAbs(cell.second - batch.mY) <= 1;
+                    });
+
+                if (isNeighbor)
+                    it = m_tiles.erase(it);
+                else
+                    ++it;
+            }
+        }
+
+        // Bake the missing tiles, spreading the work over several frames when many tiles changed at once.
+        int bakedTiles = 0;
+        for (int i = 0; i < navMesh.getMaxTiles() && bakedTiles < maxBakedTiles; ++i)
+        {
+            const dtMeshTile* tile = navMesh.getTile(i);
+            if (tile->header == nullptr)
+                continue;
+
+            if (const dtTileRef ref = navMesh.getTileRef(tile); m_tiles.find(ref) == m_tiles.end())
+            {
+                BakeTile(navMesh, tile, flags, m_tiles[ref]);
+                ++bakedTiles;
+            }
+        }
+    }
+
+    void RecastNavMeshDebugDraw::DrawNavigationMesh(const AZ::Frustum* frustum, const AZ::Vector3& viewPosition, const float maxDistance)
+    {
+        if (m_debugDisplay == nullptr)
+            return;
+
+        if (m_depthTest)
+            m_debugDisplay->DepthTestOn();
+        else
+            m_debugDisplay->DepthTestOff();
+
+        for (const auto& [ref, batch] : m_tiles)
+        {
+            if (!batch.mBounds.IsValid())
+                continue;
+
+            if (maxDistance > 0.0f && batch.mBounds.GetDistance(viewPosition) > maxDistance)
+                continue;
+
+            if (frustum != nullptr && !AZ::ShapeIntersection::Overlaps(*frustum, batch.mBounds))
+                continue;
+
+            for (const TrianglesBatch& triangles : batch.mTriangles)
+            {
+                m_debugDisplay->DrawTrianglesIndexed(triangles.mVertices, triangles.mIndices, triangles.mColor);
+            }
+
+            for (const LinesBatch& lines : batch.mLines)
+            {
+                m_debugDisplay->SetLineWidth(lines.mWidth);
+                m_debugDisplay->DrawLines(lines.mVertices, lines.mColor);
+            }
+        }
+
+        if (!m_depthTest)
+            m_debugDisplay->DepthTestOn();
+    }
+
+    void RecastNavMeshDebugDraw::Clear()
+    {
+        m_knownTiles.clear();
+        m_tiles.clear();
+    }
+
+    void RecastNavMeshDebugDraw::BakeTile(const dtNavMesh& navMesh, const dtMeshTile* tile, const AZ::u8 flags, TileBatch& batch)
+    {
+        batch = {};
+        batch.mX = tile->header->x;
+        batch.mY = tile->header->y;
+
+        m_recordingTile = &batch;
+        m_recordingGroups.clear();
+
+        duDebugDrawNavMeshTile(this, navMesh, tile, flags);
+
+        m_recordingTile = nullptr;
+
+        // The vertices index is only needed while baking.
+        for (TrianglesBatch& triangles : batch.mTriangles)
+        {
+            triangles.mVerticesIndex = {};
+        }
+    }
+
+    void RecastNavMeshDebugDraw::RecordPrimitives()
+    {
+        for (const auto& [position, color] : m_verticesToDraw)
+        {
+            m_recordingTile->mBounds.AddPoint(position);
+        }
+
+        switch (m_currentPrim)
+        {
+        case DU_DRAW_POINTS:
+            {
+                // Points are recorded as small crosses, drawing thousands of balls is too expensive.
+                const float radius = m_currentSize / 100;
+                for (const auto& [position, color] : m_verticesToDraw)
+                {
+                    LinesBatch& lines = GetLinesBatch(color, 1.0f);
+                    lines.mVertices.push_back(position - AZ::Vector3::CreateAxisX(radius));
+                    lines.mVertices.push_back(position + AZ::Vector3::CreateAxisX(radius));
+                    lines.mVertices.push_back(position - AZ::Vector3::CreateAxisY(radius));
+                    lines.mVertices.push_back(position + AZ::Vector3::CreateAxisY(radius));
+                }
+            }
+            break;
+        case DU_DRAW_TRIS:
+            {
+                for (size_t i = 2, l = m_verticesToDraw.size(); i < l; i += 3)
+                {
+                    TrianglesBatch& triangles = GetTrianglesBatch(m_verticesToDraw[i - 2].second);
+                    AddIndexedVertex(triangles, m_verticesToDraw[i - 2].first);
+                    AddIndexedVertex(triangles, m_verticesToDraw[i - 1].first);
+                    AddIndexedVertex(triangles, m_verticesToDraw[i - 0].first);
+                }
+            }
+            break;
+        case DU_DRAW_QUADS:
+            {
+                for (size_t i = 3, l = m_verticesToDraw.size(); i < l; i += 4)
+                {
+                    TrianglesBatch& triangles = GetTrianglesBatch(m_verticesToDraw[i - 3].second);
+                    AddIndexedVertex(triangles, m_verticesToDraw[i - 3].first);
+                    AddIndexedVertex(triangles, m_verticesToDraw[i - 2].first);
+                    AddIndexedVertex(triangles, m_verticesToDraw[i - 1].first);
+                    AddIndexedVertex(triangles, m_verticesToDraw[i - 3].first);
+                    AddIndexedVertex(triangles, m_verticesToDraw[i - 1].first);
+                    AddIndexedVertex(triangles, m_verticesToDraw[i - 0].first);
+                }
+            }
+            break;
+        case DU_DRAW_LINES:
+            {
+                for (size_t i = 1, l = m_verticesToDraw.size(); i < l; i += 2)
+                {
+                    LinesBatch& lines = GetLinesBatch(m_verticesToDraw[i - 1].second, m_currentSize);
+                    lines.mVertices.push_back(m_verticesToDraw[i - 1].first);
+                    lines.mVertices.push_back(m_verticesToDraw[i - 0].first);
+                }
+            }
+            break;
+        }
+    }
+
+    RecastNavMeshDebugDraw::TrianglesBatch& RecastNavMeshDebugDraw::GetTrianglesBatch(const AZ::u32 color)
+    {
+        const AZ::u64 key = color;
+
+        if (const auto it = m_recordingGroups.find(key); it != m_recordingGroups.end())
+            return m_recordingTile->mTriangles[it->second];
+
+        m_recordingGroups.emplace(key, m_recordingTile->mTriangles.size());
+
+        m_recordingTile->mTriangles.emplace_back();
+
+        TrianglesBatch& triangles = m_recordingTile->mTriangles.back();
+        triangles.mColor.FromU32(color);
+
+        return triangles;
+    }
+
+    RecastNavMeshDebugDraw::LinesBatch& RecastNavMeshDebugDraw::GetLinesBatch(const AZ::u32 color, const float width)
+    {
+        // Lines batches are keyed by colour and width, the high bit avoiding collisions with triangles batches.
+        AZ::u32 widthBits;
+        memcpy(&widthBits, &width, sizeof(widthBits));
+        const AZ::u64 key = (1ull << 63) | (aznumeric_cast<AZ::u64>(widthBits & 0x7FFFFFFF) << 32) | color;
+
+        if (const auto it = m_recordingGroups.find(key); it != m_recordingGroups.end())
+            return m_recordingTile->mLines[it->second];
+
+        m_recordingGroups.emplace(key, m_recordingTile->mLines.size());
+
+        m_recordingTile->mLines.emplace_back();
+
+        LinesBatch& lines = m_recordingTile->mLines.back();
+        lines.mColor.FromU32(color);
+        lines.mWidth = width;
+
+        return lines;
+    }
 } // namespace SparkyStudios::AI::Behave::Navigation
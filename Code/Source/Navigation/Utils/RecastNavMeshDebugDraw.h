@@ -15,6 +15,11 @@
 #pragma once
 
 #include <DebugDraw.h>
+#include <DetourNavMesh.h>
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 
@@ -60,13 +65,77 @@ namespace SparkyStudios::AI::Behave::Navigation
         void SetDebugDisplayRequestsHandler(AzFramework::DebugDisplayRequests* debugDisplay);
         void SetEnableDepthTest(bool depthTest);
 
+        /**
+         * @brief Synchronizes the retained draw data with the tiles of the given navigation mesh.
+         *
+         * Each tile is baked once into vertex and index buffers grouped by colour, and kept until the tile,
+         * or one of its neighbors, is removed or replaced. At most maxBakedTiles tiles are baked per call.
+         *
+         * @param navMesh The navigation mesh to draw.
+         * @param generation The navigation mesh generation. All the tiles are baked again when it changes.
+         * @param flags The Detour debug draw flags (DrawNavMeshFlags).
+         * @param maxBakedTiles The maximum number of tiles to bake in this call.
+         */
+        void UpdateNavigationMesh(const dtNavMesh& navMesh, AZ::u32 generation, AZ::u8 flags, int maxBakedTiles);
+
+        /**
+         * @brief Draws the retained tiles visible from the given point of view.
+         *
+         * @param frustum The view frustum used to cull tiles, or nullptr to disable frustum culling.
+         * @param viewPosition The view position used for distance culling.
+         * @param maxDistance The maximum distance at which tiles are drawn, or 0 to disable distance culling.
+         */
+        void DrawNavigationMesh(const AZ::Frustum* frustum, const AZ::Vector3& viewPosition, float maxDistance);
+
+        /**
+         * @brief Releases the retained draw data.
+         */
+        void Clear();
+
     protected:
+        struct TrianglesBatch
+        {
+            AZ::Color mColor;
+            AZStd::vector<AZ::Vector3> mVertices;
+            AZStd::vector<AZ::u32> mIndices;
+            AZStd::unordered_map<AZ::u64, AZ::u32> mVerticesIndex;
+        };
+
+        struct LinesBatch
+        {
+            AZ::Color mColor;
+            float mWidth = 1.0f;
+            AZStd::vector<AZ::Vector3> mVertices;
+        };
+
+        struct TileBatch
+        {
+            int mX = 0;
+            int mY = 0;
+            AZ::Aabb mBounds = AZ::Aabb::CreateNull();
+            AZStd::vector<TrianglesBatch> mTriangles;
+            AZStd::vector<LinesBatch> mLines;
+        };
+
         void AddVertex(float x, float y, float z, unsigned int color);
 
+        static void AddIndexedVertex(TrianglesBatch& batch, const AZ::Vector3& vertex);
+
+        void BakeTile(const dtNavMesh& navMesh, const dtMeshTile* tile, AZ::u8 flags, TileBatch& batch);
+        void RecordPrimitives();
+        TrianglesBatch& GetTrianglesBatch(AZ::u32 color);
+        LinesBatch& GetLinesBatch(AZ::u32 color, float width);
+
         bool m_depthTest = false;
         duDebugDrawPrimitives m_currentPrim = DU_DRAW_QUADS;
         float m_currentSize = 1.0f;
         AZStd::vector<AZStd::pair<AZ::Vector3, AZ::u32>> m_verticesToDraw;
         AzFramework::DebugDisplayRequests* m_debugDisplay = nullptr;
+
+        AZStd::unordered_map<dtTileRef, AZStd::pair<int, int>> m_knownTiles;
+        AZStd::unordered_map<dtTileRef, TileBatch> m_tiles;
+        AZ::u32 m_generation = 0;
+        TileBatch* m_recordingTile = nullptr;
+        AZStd::unordered_map<AZ::u64, size_t> m_recordingGroups;
     };
 } // namespace SparkyStudios::AI::Behave::Navigation
@@ -17,20 +17,145 @@
 #include <DetourNavMeshBuilder.h>
 
 #include <Navigation/Assets/NavigationMeshSettingsAsset.h>
-#include <Navigation/NavigationAreaProviderRequestBus.h>
 #include <Navigation/Utils/Constants.h>
-#include <Navigation/Utils/RecastContext.h>
 #include <Navigation/Utils/RecastNavigationMesh.h>
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/JSON/prettywriter.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
 
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzFramework/Physics/HeightfieldProviderBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Shape.h>
 
 namespace SparkyStudios::AI::Behave::Navigation
 {
+    // Maximum number of tiles for which geometry is gathered and queued for a background build in a single streaming update.
+    static constexpr int kMaxStreamingTileRequestsPerUpdate = 4;
+
+    // Maximum number of outdated tiles for which geometry is gathered and queued for a background build in a single update.
+    static constexpr int kMaxDirtyTileRequestsPerUpdate = 4;
+
+    // Maximum number of jobs a raycast batch is split into, and minimum number of raycasts run by each job.
+    static constexpr AZ::u32 kMaxRaycastJobs = 8;
+    static constexpr AZ::u32 kMinRaycastsPerJob = 64;
+
+    // Size of the nodes pool of the navigation mesh query objects.
+    // TODO: Add CVars to control max nodes
+    static constexpr int kQueryMaxNodes = 2048;
+
+    // Raycasts don't search the graph, their query objects only need a minimal nodes pool.
+    static constexpr int kRaycastQueryMaxNodes = 64;
+
+    // Number of tiles built by streaming for which statistics are kept, the older ones are only in the aggregated statistics.
+    static constexpr AZ::u32 kMaxStreamedTileStatistics = 64;
+
+    using StatisticsWriter = rapidjson::PrettyWriter<rapidjson::StringBuffer>;
+
+    static AZ::u32 RaycastRange(
+        const dtNavMeshQuery* navMeshQuery, const NavigationRaycastBatch& batch, const AZ::u32 begin, const AZ::u32 end)
+    {
+        constexpr float halfExtents[3] = { 1.0f, 1.0f, 1.0f };
+        const dtQueryFilter filter;
+
+        AZ::u32 clearCount = 0;
+
+        for (AZ::u32 i = begin; i < end; ++i)
+        {
+            const RecastVector3 startRecast{ batch.mStarts[i] }, endRecast{ batch.mEnds[i] };
+
+            float hitParameter = 0.0f;
+            RecastVector3 hitNormal(0.0f, 0.0f, 0.0f);
+
+            dtPolyRef startPoly = 0;
+            RecastVector3 nearestStartPoint;
+
+            const dtStatus status =
+                navMeshQuery->findNearestPoly(startRecast.data(), halfExtents, &filter, &startPoly, nearestStartPoint.data());
+
+            if (dtStatusSucceed(status) && startPoly != 0)
+            {
+                int visitedCount = 0;
+                if (dtStatusFailed(navMeshQuery->raycast(
+                        startPoly, nearestStartPoint.data(), endRecast.data(), &filter, &hitParameter, hitNormal.data(), nullptr,
+                        &visitedCount, 0)))
+                {
+                    hitParameter = 0.0f;
+                }
+            }
+
+            batch.mHitParameters[i] = hitParameter;
+
+            if (batch.mHitNormals != nullptr)
+                batch.mHitNormals[i] = hitNormal.AsVector3();
+
+            if (batch.mHitPoints != nullptr)
+            {
+                // The hit parameter is relative to the start projected on the navigation mesh, not to the given one.
+                if (hitParameter == FLT_MAX)
+                    batch.mHitPoints[i] = batch.mEnds[i];
+                else if (startPoly == 0)
+                    batch.mHitPoints[i] = batch.mStarts[i];
+                else
+                    batch.mHitPoints[i] = nearestStartPoint.AsVector3().Lerp(batch.mEnds[i], hitParameter);
+            }
+
+            if (hitParameter == FLT_MAX)
+                ++clearCount;
+        }
+
+        return clearCount;
+    }
+
+    static void WriteTileStatistics(StatisticsWriter& writer, const NavigationMeshTileBuildStatistics& statistics)
+    {
+        writer.StartObject();
+
+        writer.Key("tileX");
+        writer.Int(statistics.mTileX);
+        writer.Key("tileY");
+        writer.Int(statistics.mTileY);
+
+        writer.Key("times");
+        writer.StartObject();
+        writer.Key("rasterize");
+        writer.Double(statistics.mRasterizeTime);
+        writer.Key("filter");
+        writer.Double(statistics.mFilterTime);
+        writer.Key("compact");
+        writer.Double(statistics.mCompactTime);
+        writer.Key("erode");
+        writer.Double(statistics.mErodeTime);
+        writer.Key("regions");
+        writer.Double(statistics.mRegionsTime);
+        writer.Key("contours");
+        writer.Double(statistics.mContoursTime);
+        writer.Key("polyMesh");
+        writer.Double(statistics.mPolyMeshTime);
+        writer.Key("detailMesh");
+        writer.Double(statistics.mDetailMeshTime);
+        writer.Key("total");
+        writer.Double(statistics.mTotalTime);
+        writer.EndObject();
+
+        writer.Key("triangles");
+        writer.Uint(statistics.mTrianglesCount);
+        writer.Key("spans");
+        writer.Uint(statistics.mSpansCount);
+        writer.Key("polygons");
+        writer.Uint(statistics.mPolygonsCount);
+        writer.Key("peakMemory");
+        writer.Uint64(statistics.mPeakMemory);
+
+        writer.EndObject();
+    }
+
     static unsigned int NextPow2(unsigned int v)
     {
         v--;
@@ -70,16 +195,135 @@ namespace SparkyStudios::AI::Behave::Navigation
         , _offMeshConnections()
     {
         _context = AZStd::make_unique<RecastContext>();
+
+        _readers[0] = 0;
+        _readers[1] = 0;
+    }
+
+    RecastNavigationMesh::~RecastNavigationMesh()
+    {
+        _queuedBuild = nullptr;
+        _cancelRequested = true;
+
+        while (_buildRunning)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        WaitForStreamingJob();
+
+        for (const StreamingTileData& tile : _streamedTiles)
+        {
+            dtFree(tile.mData);
+        }
+
+        for (const StreamingTileData& tile : _tileChanges)
+        {
+            dtFree(tile.mData);
+        }
+
+        _retiredData.clear();
+        delete _data.exchange(nullptr);
+    }
+
+    RecastNavigationMesh::QueryScope::QueryScope(const RecastNavigationMesh& navigationMesh)
+        : _navigationMesh(navigationMesh)
+    {
+        // Register as a reader of the current epoch. If the epoch changed in the meantime, the writer
+        // may not wait for us, so try again with the new one.
+        while (true)
+        {
+            _epoch = _navigationMesh._epoch.load();
+            _navigationMesh._readers[_epoch & 1].fetch_add(1);
+
+            if (_navigationMesh._epoch.load() == _epoch)
+                break;
+
+            _navigationMesh._readers[_epoch & 1].fetch_sub(1);
+        }
+
+        _data = _navigationMesh._data.load();
+    }
+
+    RecastNavigationMesh::QueryScope::~QueryScope()
+    {
+        _navigationMesh._readers[_epoch & 1].fetch_sub(1);
+    }
+
+    dtNavMesh* RecastNavigationMesh::QueryScope::GetNavigationMesh() const
+    {
+        return _data != nullptr ? _data->mNavMesh.get() : nullptr;
+    }
+
+    dtNavMeshQuery* RecastNavigationMesh::QueryScope::GetNavigationMeshQuery() const
+    {
+        return _data != nullptr ? _data->mNavQuery.get() : nullptr;
     }
 
     dtNavMesh* RecastNavigationMesh::GetNavigationMesh() const
     {
-        return _navMesh.get();
+        const NavigationMeshData* data = _data.load();
+        return data != nullptr ? data->mNavMesh.get() : nullptr;
     }
 
     dtNavMeshQuery* RecastNavigationMesh::GetNavigationMeshQuery() const
     {
-        return _navQuery.get();
+        const NavigationMeshData* data = _data.load();
+        return data != nullptr ? data->mNavQuery.get() : nullptr;
+    }
+
+    AZ::u32 RecastNavigationMesh::Raycast(const NavigationRaycastBatch& batch) const
+    {
+        if (batch.mCount == 0 || batch.mStarts == nullptr || batch.mEnds == nullptr || batch.mHitParameters == nullptr)
+            return 0;
+
+        // Keep the navigation mesh alive while querying, in case a rebuild swaps it.
+        const QueryScope scope(*this);
+
+        const NavigationMeshData* data = scope._data;
+        if (data == nullptr || data->mRaycastQueries.empty())
+        {
+            AZStd::fill(batch.mHitParameters, batch.mHitParameters + batch.mCount, 0.0f);
+
+            if (batch.mHitNormals != nullptr)
+                AZStd::fill(batch.mHitNormals, batch.mHitNormals + batch.mCount, AZ::Vector3::CreateZero());
+
+            if (batch.mHitPoints != nullptr)
+                AZStd::copy(batch.mStarts, batch.mStarts + batch.mCount, batch.mHitPoints);
+
+            return 0;
+        }
+
+        const AZ::u32 queriesCount = aznumeric_cast<AZ::u32>(data->mRaycastQueries.size());
+        const AZ::u32 jobsCount = AZStd::min(queriesCount, (batch.mCount + kMinRaycastsPerJob - 1) / kMinRaycastsPerJob);
+
+        // Small batches are not worth the jobs overhead.
+        if (jobsCount <= 1)
+            return RaycastRange(data->mRaycastQueries[0].get(), batch, 0, batch.mCount);
+
+        AZStd::atomic<AZ::u32> clearCount = 0;
+        AZ::JobCompletion completion;
+
+        for (AZ::u32 j = 0; j < jobsCount; ++j)
+        {
+            const AZ::u32 begin = aznumeric_cast<AZ::u32>(AZ::u64(batch.mCount) * j / jobsCount);
+            const AZ::u32 end = aznumeric_cast<AZ::u32>(AZ::u64(batch.mCount) * (j + 1) / jobsCount);
+            const dtNavMeshQuery* navMeshQuery = data->mRaycastQueries[j].get();
+
+            AZ::Job* job = AZ::CreateJobFunction(
+                [navMeshQuery, &batch, &clearCount, begin, end]()
+                {
+                    clearCount += RaycastRange(navMeshQuery, batch, begin, end);
+                },
+                true);
+
+            job->SetDependent(&completion);
+            job->Start();
+        }
+
+        completion.StartAndWaitForCompletion();
+
+        return clearCount.load();
     }
 
     bool RecastNavigationMesh::IsNavigationMeshReady() const
@@ -87,6 +331,94 @@ namespace SparkyStudios::AI::Behave::Navigation
         return _navMeshReady.load();
     }
 
+    AZ::u32 RecastNavigationMesh::GetGeneration() const
+    {
+        return _generation.load();
+    }
+
+    bool RecastNavigationMesh::IsStreamingEnabled() const
+    {
+        return _settings != nullptr && _settings->m_enableTiling && _settings->m_enableStreaming;
+    }
+
+    NavigationMeshTileStoreStatistics RecastNavigationMesh::GetTileStoreStatistics() const
+    {
+        return _bakedTiles.GetStatistics();
+    }
+
+    NavigationMeshBuildStatistics RecastNavigationMesh::GetBuildStatistics() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_statisticsMutex);
+
+        NavigationMeshBuildStatistics statistics = _statistics;
+
+        // The streamed tiles are stored in a ring buffer, put the oldest first.
+        const AZStd::size_t count = _statistics.mStreamedTiles.size();
+        for (AZStd::size_t i = 0; i < count; ++i)
+            statistics.mStreamedTiles[i] = _statistics.mStreamedTiles[(_streamedTileStatisticsNext + i) % count];
+
+        return statistics;
+    }
+
+    AZStd::string RecastNavigationMesh::DumpBuildStatistics(const bool includeTiles) const
+    {
+        const NavigationMeshBuildStatistics statistics = GetBuildStatistics();
+
+        rapidjson::StringBuffer buffer;
+        StatisticsWriter writer(buffer);
+
+        writer.StartObject();
+
+        writer.Key("buildTime");
+        writer.Double(statistics.mBuildTime);
+        writer.Key("tilesCount");
+        writer.Uint(aznumeric_cast<unsigned>(statistics.mTiles.size()));
+        writer.Key("skippedTilesCount");
+        writer.Uint(statistics.mSkippedTilesCount);
+
+        writer.Key("total");
+        WriteTileStatistics(writer, statistics.mTotal);
+
+        if (includeTiles)
+        {
+            writer.Key("tiles");
+            writer.StartArray();
+            for (const NavigationMeshTileBuildStatistics& tile : statistics.mTiles)
+            {
+                WriteTileStatistics(writer, tile);
+            }
+            writer.EndArray();
+        }
+
+        writer.Key("streamed");
+        writer.StartObject();
+        {
+            writer.Key("tilesCount");
+            writer.Uint(statistics.mStreamedTilesCount);
+            writer.Key("skippedTilesCount");
+            writer.Uint(statistics.mStreamedSkippedTilesCount);
+
+            writer.Key("total");
+            WriteTileStatistics(writer, statistics.mStreamedTotal);
+
+            if (includeTiles)
+            {
+                writer.Key("tiles");
+                writer.StartArray();
+                for (const NavigationMeshTileBuildStatistics& tile : statistics.mStreamedTiles)
+                {
+                    WriteTileStatistics(writer, tile);
+                }
+                writer.EndArray();
+            }
+        }
+        writer.EndObject();
+
+        writer.EndObject();
+
+        return buffer.GetString();
+    }
+
     RecastVector3 RecastNavigationMesh::GetPolyCenter(const dtNavMesh* navMesh, const dtPolyRef ref)
     {
         RecastVector3 center(0, 0, 0);
@@ -116,8 +448,64 @@ namespace SparkyStudios::AI::Behave::Navigation
         return center;
     }
 
+    AZ::u64 RecastNavigationMesh::GetTileKey(const int tileX, const int tileY)
+    {
+        return (aznumeric_cast<AZ::u64>(aznumeric_cast<AZ::u32>(tileX)) << 32) | aznumeric_cast<AZ::u32>(tileY);
+    }
+
+    bool RecastNavigationMesh::QueryColliders(const AZ::Aabb& aabb, AzPhysics::SceneQueryHits& results) const
+    {
+        AZ::Vector3 dimension = aabb.GetExtents();
+        AZ::Transform pose = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateIdentity(), aabb.GetCenter());
+
+        Physics::BoxShapeConfiguration shapeConfiguration;
+        shapeConfiguration.m_dimensions = dimension;
+
+        AzPhysics::SceneQuery::UnboundedOverlapHitCallback unboundedOverlapHitCallback =
+            [&results](AZStd::optional<AzPhysics::SceneQueryHit>&& hit) -> bool
+        {
+            if (hit && ((hit->m_resultFlags & AzPhysics::SceneQuery::EntityId) != 0))
+            {
+                const AzPhysics::SceneQueryHit& sceneQueryHit = *hit;
+                results.m_hits.push_back(sceneQueryHit);
+            }
+
+            return true;
+        };
+
+        AzPhysics::OverlapRequest request = AzPhysics::OverlapRequestHelpers::CreateBoxOverlapRequest(dimension, pose, nullptr);
+        request.m_queryType = AzPhysics::SceneQuery::QueryType::Static;
+        request.m_collisionGroup = AzPhysics::CollisionGroup::All;
+        // We need to use unbounded callback, otherwise the results will be limited to 32 or so objects.
+        request.m_unboundedOverlapHitCallback = unboundedOverlapHitCallback;
+
+        if (auto* const sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            AzPhysics::SceneHandle sceneHandle =
+                sceneInterface->GetSceneHandle(_isEditor ? AzPhysics::EditorPhysicsSceneName : AzPhysics::DefaultPhysicsSceneName);
+            sceneInterface->QueryScene(sceneHandle, &request);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    AZStd::shared_ptr<const RecastTerrainHeightfield> RecastNavigationMesh::GetTerrainHeightfield(const AZ::EntityId& entityId)
+    {
+        // Heightfield samples are fetched once, and shared by all the tiles built from them.
+        if (const auto it = _terrainHeightfields.find(entityId); it != _terrainHeightfields.end())
+            return it->second;
+
+        AZStd::shared_ptr<const RecastTerrainHeightfield> heightfield = RecastTerrainHeightfield::Create(entityId);
+        if (heightfield != nullptr)
+            _terrainHeightfields.emplace(entityId, heightfield);
+
+        return heightfield;
+    }
+
     RecastNavigationMeshGeometry RecastNavigationMesh::GetColliderGeometry(
-        const AZ::Aabb& aabb, const AzPhysics::SceneQueryHits& overlapHits)
+        const AZ::Aabb& aabb, const AzPhysics::SceneQueryHits& overlapHits, RecastAreaConvexVolumes& areaConvexVolumes)
     {
         RecastNavigationMeshGeometry geom{};
 
@@ -157,10 +545,30 @@ namespace SparkyStudios::AI::Behave::Navigation
                     area = RecastAreaConvexVolume(areaPolygon, t);
                     area.mArea = static_cast<AZ::u8>(areaSettings);
 
-                    _areaConvexVolumes.push_back(area);
+                    areaConvexVolumes.Add(AZStd::move(area));
                 }
                 else if (isWalkable)
                 {
+                    // Terrains are rasterized from their height samples, so their triangles are never generated.
+                    if (Physics::HeightfieldProviderRequestsBus::HasHandlers(hitEntityId))
+                    {
+                        if (auto heightfield = GetTerrainHeightfield(hitEntityId); heightfield != nullptr)
+                        {
+                            if (AZStd::find(geom.mHeightfields.begin(), geom.mHeightfields.end(), heightfield) ==
+                                geom.mHeightfields.end())
+                            {
+                                geom.mHeightfields.push_back(AZStd::move(heightfield));
+                            }
+
+                            continue;
+                        }
+
+                        AZ_Warning(
+                            "BehaveAI [Navigation]", false,
+                            "Unable to sample the heightfield of the entity %s, its triangles are used instead.",
+                            hitEntityId.ToString().c_str());
+                    }
+
                     // Most physics bodies just have world transforms, but some also have local transforms including terrain.
                     // We are not applying the local orientation because it causes terrain geometry to be oriented incorrectly
 
@@ -197,6 +605,11 @@ namespace SparkyStudios::AI::Behave::Navigation
             }
         }
 
+        areaConvexVolumes.Build();
+
+        if (geom.mVertices.empty())
+            return geom;
+
         if (_settings->m_enableTiling)
         {
             geom.mChunkedGeometry.reset(new rcChunkedGeometry());
@@ -222,108 +635,321 @@ namespace SparkyStudios::AI::Behave::Navigation
         return geom;
     }
 
-    bool RecastNavigationMesh::BuildNavigationMesh(const INavigationMesh* navMesh)
+    bool RecastNavigationMesh::BuildNavigationMesh(const INavigationMesh* navMesh, const BuildPriority priority)
     {
-        _navMeshReady = false;
-        _settings = navMesh->GetSettings();
-        _aabb = navMesh->GetBoundingBox();
+        if (navMesh == nullptr)
+            return false;
 
-        _offMeshConnections.Clear();
-        _geometry.Clear();
-        _areaConvexVolumes.clear();
+        if (_buildRunning)
+        {
+            // Requests made while building are coalesced into a single one, started by ProcessBuildQueue
+            // once the running build is done. The settings are read only at that time.
+            _queuedBuild = navMesh;
 
-        const auto& connections = navMesh->GetOffMeshConnections();
-        _offMeshConnections = RecastOffMeshConnections(connections);
+            if (priority == BuildPriority::High)
+                _cancelRequested = true;
 
-        AzPhysics::SceneQueryHits results{};
+            return true;
+        }
 
-        AZ::Vector3 dimension = _aabb.GetExtents();
-        AZ::Transform pose = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateIdentity(), _aabb.GetCenter());
+        _queuedBuild = nullptr;
+        return StartBuild(navMesh);
+    }
 
-        Physics::BoxShapeConfiguration shapeConfiguration;
-        shapeConfiguration.m_dimensions = dimension;
+    bool RecastNavigationMesh::BuildNavigationMesh(
+        const INavigationMesh* navMesh,
+        AZStd::shared_ptr<const RecastNavigationMeshGeometry> geometry,
+        AZStd::shared_ptr<const RecastAreaConvexVolumes> areaConvexVolumes)
+    {
+        if (navMesh == nullptr || navMesh->GetSettings() == nullptr || navMesh->GetSettings()->m_enableStreaming || geometry == nullptr ||
+            areaConvexVolumes == nullptr || _buildRunning)
+            return false;
 
-        AzPhysics::SceneQuery::UnboundedOverlapHitCallback unboundedOverlapHitCallback =
-            [&results](AZStd::optional<AzPhysics::SceneQueryHit>&& hit) -> bool
-        {
-            if (hit && ((hit->m_resultFlags & AzPhysics::SceneQuery::EntityId) != 0))
-            {
-                const AzPhysics::SceneQueryHit& sceneQueryHit = *hit;
-                results.m_hits.push_back(sceneQueryHit);
-            }
+        _queuedBuild = nullptr;
+        return StartBuild(navMesh, AZStd::move(geometry), AZStd::move(areaConvexVolumes));
+    }
 
-            return true;
-        };
+    bool RecastNavigationMesh::GatherGeometry(
+        const INavigationMesh* navMesh,
+        AZStd::shared_ptr<const RecastNavigationMeshGeometry>& geometry,
+        AZStd::shared_ptr<const RecastAreaConvexVolumes>& areaConvexVolumes)
+    {
+        if (navMesh == nullptr || navMesh->GetSettings() == nullptr || _buildRunning)
+            return false;
 
-        AzPhysics::OverlapRequest request = AzPhysics::OverlapRequestHelpers::CreateBoxOverlapRequest(dimension, pose, nullptr);
-        request.m_queryType = AzPhysics::SceneQuery::QueryType::Static;
-        request.m_collisionGroup = AzPhysics::CollisionGroup::All;
-        // We need to use unbounded callback, otherwise the results will be limited to 32 or so objects.
-        request.m_unboundedOverlapHitCallback = unboundedOverlapHitCallback;
+        // The settings are read while gathering, to chunk the geometry of tiled navigation meshes.
+        WaitForStreamingJob();
+        _settings = navMesh->GetSettings();
 
-        if (auto* const sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
-        {
-            AzPhysics::SceneHandle sceneHandle =
-                sceneInterface->GetSceneHandle(_isEditor ? AzPhysics::EditorPhysicsSceneName : AzPhysics::DefaultPhysicsSceneName);
-            sceneInterface->QueryScene(sceneHandle, &request);
+        return GatherGeometry(navMesh->GetBoundingBox(), geometry, areaConvexVolumes);
+    }
 
-            if (results.m_hits.empty())
-                return false;
+    bool RecastNavigationMesh::GatherGeometry(
+        const AZ::Aabb& aabb,
+        AZStd::shared_ptr<const RecastNavigationMeshGeometry>& geometry,
+        AZStd::shared_ptr<const RecastAreaConvexVolumes>& areaConvexVolumes)
+    {
+        AzPhysics::SceneQueryHits results{};
+
+        if (!QueryColliders(aabb, results) || results.m_hits.empty())
+            return false;
 
-            AZ_Printf("DynamicNavigationMeshComponent", "Found %llu physx meshes", results.m_hits.size());
+        AZ_Printf("DynamicNavigationMeshComponent", "Found %llu physx meshes", results.m_hits.size());
 
-            _geometry = GetColliderGeometry(_aabb, results);
+        auto volumes = AZStd::make_shared<RecastAreaConvexVolumes>();
+        geometry = AZStd::make_shared<RecastNavigationMeshGeometry>(GetColliderGeometry(aabb, results, *volumes));
+        areaConvexVolumes = AZStd::move(volumes);
 
-            auto* job = AZ::CreateJobFunction(
-                [this]() -> void
-                {
-                    if ((_navMeshReady = Build()))
-                    {
-                        EBUS_EVENT_ID(_entityId, NavigationMeshNotificationBus, OnNavigationMeshUpdated);
-                    }
-                },
-                true);
+        return true;
+    }
 
-            job->Start();
+    void RecastNavigationMesh::CancelBuild()
+    {
+        _queuedBuild = nullptr;
 
-            return true;
-        }
+        if (_buildRunning)
+            _cancelRequested = true;
+    }
 
-        return false;
+    bool RecastNavigationMesh::IsBuilding() const
+    {
+        return _buildRunning || _queuedBuild != nullptr;
     }
 
-    bool RecastNavigationMesh::Build()
+    void RecastNavigationMesh::ProcessBuildQueue()
     {
-        if (_geometry.mVertices.empty())
-            return false;
+        ReleaseRetiredData();
 
-        _navMesh.reset(dtAllocNavMesh());
-        if (!_navMesh)
+        if (_buildProgressUpdated.exchange(false))
         {
-            _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not create nav mesh.");
-            return false;
+            EBUS_EVENT_ID(
+                _entityId, NavigationMeshNotificationBus, OnNavigationMeshBuildProgress, _buildProgress.load(), _buildRemainingTime.load());
         }
 
-        _navQuery.reset(dtAllocNavMeshQuery());
-        if (!_navQuery)
+        switch (_buildStatus.exchange(BuildStatus::None))
         {
-            _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not create nav mesh query.");
-            return false;
+        case BuildStatus::Succeeded:
+            EBUS_EVENT_ID(_entityId, NavigationMeshNotificationBus, OnNavigationMeshUpdated);
+            break;
+        case BuildStatus::Failed:
+            AZ_Warning("BehaveAI [Navigation]", false, "The navigation mesh build failed, the current navigation mesh is kept.");
+            EBUS_EVENT_ID(_entityId, NavigationMeshNotificationBus, OnNavigationMeshBuildCancelled);
+            break;
+        case BuildStatus::Cancelled:
+            EBUS_EVENT_ID(_entityId, NavigationMeshNotificationBus, OnNavigationMeshBuildCancelled);
+            break;
+        case BuildStatus::None:
+            break;
         }
 
-        const RecastVector3 worldMin(_aabb.GetMin());
-        const RecastVector3 worldMax(_aabb.GetMax());
+        if (_queuedBuild == nullptr || _buildRunning)
+            return;
 
-        if (_settings->m_enableTiling)
-        {
-            int gw = 0, gh = 0;
-            rcCalcGridSize(worldMin.data(), worldMax.data(), _settings->m_cellSize, &gw, &gh);
-            const int tileSize = _settings->m_tileSize;
-            const int tileWidth = (gw + tileSize - 1) / tileSize;
-            const int tileHeight = (gh + tileSize - 1) / tileSize;
-            const float tileCellSize = _settings->m_tileSize * _settings->m_cellSize;
+        const INavigationMesh* navMesh = _queuedBuild;
+        _queuedBuild = nullptr;
 
-            int tileBits = rcMin(aznumeric_cast<int>(Log2(NextPow2(tileWidth * tileHeight))), 14);
+        if (!StartBuild(navMesh))
+        {
+            EBUS_EVENT_ID(_entityId, NavigationMeshNotificationBus, OnNavigationMeshBuildCancelled);
+        }
+    }
+
+    bool RecastNavigationMesh::StartBuild(
+        const INavigationMesh* navMesh,
+        AZStd::shared_ptr<const RecastNavigationMeshGeometry> geometry,
+        AZStd::shared_ptr<const RecastAreaConvexVolumes> areaConvexVolumes)
+    {
+        // Streamed tiles are built with the same settings and working buffers.
+        WaitForStreamingJob();
+
+        _settings = navMesh->GetSettings();
+        _aabb = navMesh->GetBoundingBox();
+
+        _offMeshConnections.Clear();
+        _geometry = AZStd::move(geometry);
+        _areaConvexVolumes = AZStd::move(areaConvexVolumes);
+
+        // The geometry is gathered again, so outdated tiles will be up to date in the new navigation mesh.
+        _dirtyTiles.clear();
+        _terrainHeightfields.clear();
+
+        const auto& connections = navMesh->GetOffMeshConnections();
+        _offMeshConnections = RecastOffMeshConnections(connections);
+
+        // When streaming, tiles geometry is gathered on demand around the streaming anchors.
+        if (!IsStreamingEnabled() && _geometry == nullptr && !GatherGeometry(_aabb, _geometry, _areaConvexVolumes))
+            return false;
+
+        _buildRunning = true;
+        _cancelRequested = false;
+        _buildProgress = 0.0f;
+        _buildRemainingTime = -1.0f;
+        _buildStartTime = AZStd::chrono::steady_clock::now();
+
+        // Notifications are sent from ProcessBuildQueue, so handlers are always called from the main thread.
+        auto* job = AZ::CreateJobFunction(
+            [this]() -> void
+            {
+                const bool built = Build();
+
+                if (built)
+                    _buildStatus = BuildStatus::Succeeded;
+                else
+                    _buildStatus = IsBuildCancelled() ? BuildStatus::Cancelled : BuildStatus::Failed;
+
+                _cancelRequested = false;
+                _buildRunning = false;
+            },
+            true);
+
+        job->Start();
+
+        return true;
+    }
+
+    const RecastNavigationMesh::NavigationMeshData* RecastNavigationMesh::GetCurrentData() const
+    {
+        // Retired navigation meshes are only released by the main thread, so it doesn't need a scope to read the current one.
+        return _data.load();
+    }
+
+    void RecastNavigationMesh::GetTileBounds(
+        const float tileCellSize, const int tileX, const int tileY, RecastVector3& bMin, RecastVector3& bMax) const
+    {
+        const RecastVector3 worldMin(_aabb.GetMin());
+        const RecastVector3 worldMax(_aabb.GetMax());
+
+        bMin = worldMin;
+        bMax = worldMax;
+
+        bMin.mXYZ[0] = worldMin.mXYZ[0] + aznumeric_cast<float>(tileX) * tileCellSize;
+        bMin.mXYZ[2] = worldMin.mXYZ[2] + aznumeric_cast<float>(tileY) * tileCellSize;
+
+        bMax.mXYZ[0] = worldMin.mXYZ[0] + aznumeric_cast<float>(tileX + 1) * tileCellSize;
+        bMax.mXYZ[2] = worldMin.mXYZ[2] + aznumeric_cast<float>(tileY + 1) * tileCellSize;
+    }
+
+    float RecastNavigationMesh::GetTileBorderSize() const
+    {
+        // The same border BuildTileEx adds around the tile build area.
+        return (AZStd::ceil(_settings->m_agent.GetRadius() / _settings->m_cellSize) + _settings->m_borderPadding) * _settings->m_cellSize;
+    }
+
+    bool RecastNavigationMesh::IsBuildCancelled() const
+    {
+        return _cancelRequested.load();
+    }
+
+    void RecastNavigationMesh::ReportBuildProgress(const float progress)
+    {
+        const float elapsed = AZStd::chrono::duration<float>(AZStd::chrono::steady_clock::now() - _buildStartTime).count();
+
+        // Estimate the remaining time from the average time spent per unit of progress so far.
+        _buildProgress = progress;
+        _buildRemainingTime = progress > 0.0f ? elapsed * (1.0f - progress) / progress : -1.0f;
+        _buildProgressUpdated = true;
+    }
+
+    void RecastNavigationMesh::RecordTileStatistics(NavigationMeshBuildStatistics& statistics, const bool built) const
+    {
+        if (!built)
+        {
+            ++statistics.mSkippedTilesCount;
+            return;
+        }
+
+        AccumulateTileStatistics(statistics.mTotal, _tileStatistics);
+        statistics.mTiles.push_back(_tileStatistics);
+    }
+
+    void RecastNavigationMesh::RecordStreamedTileStatistics(const bool built)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_statisticsMutex);
+
+        if (!built)
+        {
+            ++_statistics.mStreamedSkippedTilesCount;
+            return;
+        }
+
+        ++_statistics.mStreamedTilesCount;
+        AccumulateTileStatistics(_statistics.mStreamedTotal, _tileStatistics);
+
+        // Streaming never stops, keep only the last tiles so the statistics don't grow with the play session.
+        AZStd::vector<NavigationMeshTileBuildStatistics>& tiles = _statistics.mStreamedTiles;
+        if (tiles.size() < kMaxStreamedTileStatistics)
+        {
+            tiles.push_back(_tileStatistics);
+        }
+        else
+        {
+            tiles[_streamedTileStatisticsNext] = _tileStatistics;
+            _streamedTileStatisticsNext = (_streamedTileStatisticsNext + 1) % kMaxStreamedTileStatistics;
+        }
+    }
+
+    void RecastNavigationMesh::AccumulateTileStatistics(
+        NavigationMeshTileBuildStatistics& total, const NavigationMeshTileBuildStatistics& tile)
+    {
+        total.mRasterizeTime += tile.mRasterizeTime;
+        total.mFilterTime += tile.mFilterTime;
+        total.mCompactTime += tile.mCompactTime;
+        total.mErodeTime += tile.mErodeTime;
+        total.mRegionsTime += tile.mRegionsTime;
+        total.mContoursTime += tile.mContoursTime;
+        total.mPolyMeshTime += tile.mPolyMeshTime;
+        total.mDetailMeshTime += tile.mDetailMeshTime;
+        total.mTotalTime += tile.mTotalTime;
+        total.mTrianglesCount += tile.mTrianglesCount;
+        total.mSpansCount += tile.mSpansCount;
+        total.mPolygonsCount += tile.mPolygonsCount;
+        total.mPeakMemory = AZStd::max(total.mPeakMemory, tile.mPeakMemory);
+    }
+
+    bool RecastNavigationMesh::Build()
+    {
+        const bool streaming = IsStreamingEnabled();
+
+        if (!streaming && (_geometry == nullptr || _geometry->IsEmpty()))
+            return false;
+
+        _pendingStatistics = {};
+
+        // The new navigation mesh is built aside, while the current one keeps serving queries.
+        auto data = AZStd::make_unique<NavigationMeshData>();
+
+        data->mNavMesh.reset(dtAllocNavMesh());
+        if (!data->mNavMesh)
+        {
+            _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not create nav mesh.");
+            return false;
+        }
+
+        data->mNavQuery.reset(dtAllocNavMeshQuery());
+        if (!data->mNavQuery)
+        {
+            _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not create nav mesh query.");
+            return false;
+        }
+
+        const RecastVector3 worldMin(_aabb.GetMin());
+        const RecastVector3 worldMax(_aabb.GetMax());
+
+        if (_settings->m_enableTiling)
+        {
+            int gw = 0, gh = 0;
+            rcCalcGridSize(worldMin.data(), worldMax.data(), _settings->m_cellSize, &gw, &gh);
+            const int tileSize = _settings->m_tileSize;
+            // The layout is published with the navigation mesh, the main thread reads it from there.
+            const int tileWidth = (gw + tileSize - 1) / tileSize;
+            const int tileHeight = (gh + tileSize - 1) / tileSize;
+            const float tileCellSize = _settings->m_tileSize * _settings->m_cellSize;
+
+            data->mTileWidth = tileWidth;
+            data->mTileHeight = tileHeight;
+            data->mTileCellSize = tileCellSize;
+
+            int tileBits = rcMin(aznumeric_cast<int>(Log2(NextPow2(tileWidth * tileHeight))), 14);
 
             if (tileBits > 14)
                 tileBits = 14;
@@ -335,107 +961,120 @@ namespace SparkyStudios::AI::Behave::Navigation
 
             dtNavMeshParams params{};
             rcVcopy(params.orig, worldMin.data());
-            params.tileWidth = _settings->m_tileSize * _settings->m_cellSize;
-            params.tileHeight = _settings->m_tileSize * _settings->m_cellSize;
+            params.tileWidth = tileCellSize;
+            params.tileHeight = tileCellSize;
             params.maxTiles = maxTiles;
             params.maxPolys = maxPolysPerTile;
 
-            dtStatus status = _navMesh->init(&params);
+            dtStatus status = data->mNavMesh->init(&params);
             if (dtStatusFailed(status))
             {
                 _context->log(RC_LOG_ERROR, "buildTiledNavigation: Could not init nav mesh.");
                 return false;
             }
 
-            // TODO: Add CVars to control max nodes
-            status = _navQuery->init(_navMesh.get(), 2048);
+            status = data->mNavQuery->init(data->mNavMesh.get(), kQueryMaxNodes);
             if (dtStatusFailed(status))
             {
                 _context->log(RC_LOG_ERROR, "buildTiledNavigation: Could not init Detour nav mesh query");
                 return false;
             }
 
-            // Start the build process.
-            _context->startTimer(RC_TIMER_TEMP);
-
-            for (int y = 0; y < tileHeight; ++y)
+            // When streaming, tiles are loaded later around the streaming anchors.
+            if (!streaming)
             {
-                for (int x = 0; x < tileWidth; ++x)
+                const float tilesCount = aznumeric_cast<float>(tileWidth * tileHeight);
+
+                for (int y = 0; y < tileHeight; ++y)
                 {
-                    BuildTile(x, y, tileCellSize);
+                    for (int x = 0; x < tileWidth; ++x)
+                    {
+                        if (IsBuildCancelled())
+                            return false;
+
+                        BuildTile(data->mNavMesh.get(), tileCellSize, x, y);
+                        ReportBuildProgress(aznumeric_cast<float>(y * tileWidth + x + 1) / tilesCount);
+                    }
                 }
             }
         }
         else
         {
-            // Start the build process.
-            _context->startTimer(RC_TIMER_TEMP);
-
             int dataSize = 0;
-            AZ::u8* data;
+            AZ::u8* navData;
 
-            if (!BuildTileEx(0, 0, worldMin.data(), worldMax.data(), dataSize, data))
+            if (!BuildTileEx(0, 0, worldMin.data(), worldMax.data(), *_geometry, *_areaConvexVolumes, dataSize, navData))
             {
                 return false;
             }
 
-            dtStatus status = _navMesh->init(data, dataSize, DT_TILE_FREE_DATA);
+            RecordTileStatistics(_pendingStatistics, true);
+
+            dtStatus status = data->mNavMesh->init(navData, dataSize, DT_TILE_FREE_DATA);
             if (dtStatusFailed(status))
             {
-                dtFree(data);
+                dtFree(navData);
                 _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not init Detour nav mesh");
                 return false;
             }
 
-            // TODO: Add CVars to control max nodes
-            status = _navQuery->init(_navMesh.get(), 2048);
+            status = data->mNavQuery->init(data->mNavMesh.get(), kQueryMaxNodes);
             if (dtStatusFailed(status))
             {
                 _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not init Detour nav mesh query");
                 return false;
             }
+
+            ReportBuildProgress(1.0f);
         }
 
-        // Stop the build process.
-        _context->stopTimer(RC_TIMER_TEMP);
+        if (!InitRaycastQueries(*data))
+            return false;
+
+        _pendingStatistics.mBuildTime =
+            AZStd::chrono::duration<float, AZStd::milli>(AZStd::chrono::steady_clock::now() - _buildStartTime).count();
+
+        AZ_Printf(
+            "BehaveAI [Navigation]", "Navigation mesh built in %.2f ms (%zu tiles, %u triangles, %u polygons, %llu bytes peak memory).",
+            _pendingStatistics.mBuildTime, _pendingStatistics.mTiles.size(), _pendingStatistics.mTotal.mTrianglesCount,
+            _pendingStatistics.mTotal.mPolygonsCount, _pendingStatistics.mTotal.mPeakMemory);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(_statisticsMutex);
+            _statistics = AZStd::move(_pendingStatistics);
+            _streamedTileStatisticsNext = 0;
+        }
 
-        // TODO: Accumulated time
+        Publish(AZStd::move(data), true);
 
         return true;
     }
 
-    bool RecastNavigationMesh::BuildTile(const int tileX, const int tileY, const float tileCellSize)
+    bool RecastNavigationMesh::BuildTile(dtNavMesh* navMesh, const float tileCellSize, const int tileX, const int tileY)
     {
-        if (_geometry.mVertices.empty())
+        if (_geometry == nullptr || _geometry->IsEmpty())
             return false;
 
-        if (!_navMesh)
+        if (navMesh == nullptr)
             return false;
 
-        const RecastVector3 worldMin(_aabb.GetMin());
-        const RecastVector3 worldMax(_aabb.GetMax());
-
-        RecastVector3 bTileMin = worldMin;
-        RecastVector3 bTileMax = worldMax;
-
-        bTileMin.mXYZ[0] += tileX * tileCellSize;
-        bTileMin.mXYZ[2] += tileY * tileCellSize;
-
-        bTileMax.mXYZ[0] = bTileMin.mXYZ[0] + (tileX + 1.0f) * tileCellSize;
-        bTileMax.mXYZ[2] = bTileMin.mXYZ[2] + (tileY + 1.0f) * tileCellSize;
+        RecastVector3 bTileMin, bTileMax;
+        GetTileBounds(tileCellSize, tileX, tileY, bTileMin, bTileMax);
 
         int dataSize = 0;
         AZ::u8* data = nullptr;
 
-        BuildTileEx(tileX, tileY, bTileMin.data(), bTileMax.data(), dataSize, data);
+        const bool built =
+            BuildTileEx(tileX, tileY, bTileMin.data(), bTileMax.data(), *_geometry, *_areaConvexVolumes, dataSize, data);
+        RecordTileStatistics(_pendingStatistics, built);
 
         if (data != nullptr)
         {
             // Remove any previous data (the nav mesh owns and deletes the data).
-            _navMesh->removeTile(_navMesh->getTileRefAt(tileX, tileY, 0), 0, 0);
+            navMesh->removeTile(navMesh->getTileRefAt(tileX, tileY, 0), 0, 0);
 
             // Let the nav mesh own the data.
-            if (const dtStatus status = _navMesh->addTile(data, dataSize, DT_TILE_FREE_DATA, 0, 0); dtStatusFailed(status))
+            if (const dtStatus status = navMesh->addTile(data, dataSize, DT_TILE_FREE_DATA, 0, 0); dtStatusFailed(status))
             {
                 dtFree(data);
                 return false;
@@ -447,17 +1086,84 @@ namespace SparkyStudios::AI::Behave::Navigation
         return false;
     }
 
+    bool RecastNavigationMesh::InitRaycastQueries(NavigationMeshData& data) const
+    {
+        const AZ::u32 queriesCount = AZStd::clamp(AZStd::thread::hardware_concurrency(), 1u, kMaxRaycastJobs);
+
+        data.mRaycastQueries.clear();
+        data.mRaycastQueries.reserve(queriesCount);
+
+        for (AZ::u32 i = 0; i < queriesCount; ++i)
+        {
+            RecastPointer<dtNavMeshQuery> navMeshQuery(dtAllocNavMeshQuery());
+            if (!navMeshQuery || dtStatusFailed(navMeshQuery->init(data.mNavMesh.get(), kRaycastQueryMaxNodes)))
+            {
+                _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not init Detour raycast queries.");
+                return false;
+            }
+
+            data.mRaycastQueries.push_back(AZStd::move(navMeshQuery));
+        }
+
+        return true;
+    }
+
+    void RecastNavigationMesh::Publish(AZStd::unique_ptr<NavigationMeshData> data, const bool newGeneration)
+    {
+        AZStd::unique_ptr<NavigationMeshData> previous(_data.exchange(data.release()));
+
+        // Move to the next epoch, new readers will only see the new navigation mesh. Readers registered
+        // in the previous epochs may still use the previous one, so it is retired instead of released.
+        // This runs from a worker, which must not wait for readers blocked on other jobs.
+        const AZ::u64 epoch = _epoch.fetch_add(1);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(_retiredDataMutex);
+            _retiredData.push_back({ AZStd::move(previous), epoch });
+        }
+
+        if (newGeneration)
+            ++_generation;
+
+        _navMeshReady = true;
+    }
+
+    void RecastNavigationMesh::ReleaseRetiredData()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(_retiredDataMutex);
+
+        // Retired in order: the readers of an epoch can only use the navigation meshes retired in this epoch or later,
+        // so once the readers of the epochs of the previous entries have drained, only the ones of this epoch are left.
+        size_t releasedCount = 0;
+        for (const RetiredNavigationMeshData& retired : _retiredData)
+        {
+            if (_readers[retired.mEpoch & 1].load() != 0)
+                break;
+
+            ++releasedCount;
+        }
+
+        _retiredData.erase(_retiredData.begin(), _retiredData.begin() + releasedCount);
+    }
+
     bool RecastNavigationMesh::BuildTileEx(
-        const int tileX, const int tileY, const float* bMin, const float* bMax, int& dataSize, AZ::u8*& navData)
+        const int tileX,
+        const int tileY,
+        const float* bMin,
+        const float* bMax,
+        const RecastNavigationMeshGeometry& geometry,
+        const RecastAreaConvexVolumes& areaConvexVolumes,
+        int& dataSize,
+        AZ::u8*& navData)
     {
-        if (_geometry.mVertices.empty())
+        if (geometry.IsEmpty())
             return false;
 
-        const float* vertices = _geometry.mVertices.front().data();
-        const int verticesCount = static_cast<int>(_geometry.mVertices.size());
-        const int* triangleData = _geometry.mIndices.data();
-        const int triangleCount = static_cast<int>(_geometry.mIndices.size()) / 3;
-        const rcChunkedGeometry* chunkedGeometry = _geometry.mChunkedGeometry.get();
+        const float* vertices = geometry.mVertices.empty() ? nullptr : geometry.mVertices.front().data();
+        const int verticesCount = static_cast<int>(geometry.mVertices.size());
+        const int* triangleData = geometry.mIndices.data();
+        const int triangleCount = static_cast<int>(geometry.mIndices.size()) / 3;
+        const rcChunkedGeometry* chunkedGeometry = geometry.mChunkedGeometry.get();
 
         // Step 1. Initialize build config.
         // --------------------------------
@@ -502,8 +1208,20 @@ namespace SparkyStudios::AI::Behave::Navigation
             rcCalcGridSize(config.bmin, config.bmax, config.cs, &config.width, &config.height);
         }
 
-        // Reset build times gathering.
+        // Release the working buffers of the previous tile, so they are not accounted in this tile peak memory.
+        _solidHeightField.reset();
+        _compactHeightField.reset();
+        _contourSet.reset();
+        _polyMesh.reset();
+        _detailMesh.reset();
+
+        _tileStatistics = {};
+        _tileStatistics.mTileX = tileX;
+        _tileStatistics.mTileY = tileY;
+
+        // Reset build times and memory gathering.
         _context->resetTimers();
+        _context->ResetPeakMemory();
 
         // Start the build process.
         _context->startTimer(RC_TIMER_TOTAL);
@@ -512,6 +1230,9 @@ namespace SparkyStudios::AI::Behave::Navigation
         _context->log(RC_LOG_PROGRESS, " - %d x %d cells", config.width, config.height);
         _context->log(RC_LOG_PROGRESS, " - %d verts, %d triangles", verticesCount, triangleCount);
 
+        if (IsBuildCancelled())
+            return false;
+
         // Step 2. Rasterize input polygon soup.
         // -------------------------------------
 
@@ -534,7 +1255,7 @@ namespace SparkyStudios::AI::Behave::Navigation
         // Allocate array that can hold triangle area types.
         // If we have multiple meshes we need to process, allocate
         // an array which can hold the max number of triangles we need to process.
-        if (_settings->m_enableTiling)
+        if (_settings->m_enableTiling && chunkedGeometry != nullptr)
         {
             _trianglesArea.resize(chunkedGeometry->maxTrisPerChunk, 0);
 
@@ -546,25 +1267,26 @@ namespace SparkyStudios::AI::Behave::Navigation
 
             int chunkIds[512]; // TODO: Make grow when returning too many items.
             const int chunksCount = rcGetChunksOverlappingRect(chunkedGeometry, tileBMin, timeBMax, chunkIds, 512);
-            if (chunksCount == 0)
+            if (chunksCount == 0 && geometry.mHeightfields.empty())
                 return false;
 
-            // m_tileTriCount = 0;
-
             for (int i = 0; i < chunksCount; ++i)
             {
+                if (IsBuildCancelled())
+                    return false;
+
                 const rcChunkedGeometryNode& node = chunkedGeometry->nodes[chunkIds[i]];
                 const int* chunkIndices = &chunkedGeometry->tris[node.i * 3];
                 const int chunkIndicesCount = node.n;
 
-                // m_tileTriCount += nctris;
+                _tileStatistics.mTrianglesCount += aznumeric_cast<AZ::u32>(chunkIndicesCount);
 
                 memset(_trianglesArea.data(), 0, chunkIndicesCount * sizeof(unsigned char));
                 rcMarkWalkableTriangles(
                     _context.get(), config.walkableSlopeAngle, vertices, verticesCount, chunkIndices, chunkIndicesCount,
                     _trianglesArea.data());
 
-                if (!rcRasterizeTriangles(
+                if (!rcRasterizeTrianglesBatch(
                         _context.get(), vertices, verticesCount, chunkIndices, _trianglesArea.data(), chunkIndicesCount, *_solidHeightField,
                         config.walkableClimb))
                 {
@@ -573,9 +1295,10 @@ namespace SparkyStudios::AI::Behave::Navigation
                 }
             }
         }
-        else
+        else if (triangleCount > 0)
         {
             _trianglesArea.resize(triangleCount, 0);
+            _tileStatistics.mTrianglesCount = aznumeric_cast<AZ::u32>(triangleCount);
 
             // Find triangles which are walkable based on their slope and rasterize them.
             // If our input data is multiple meshes, you can transform them here, calculate
@@ -583,7 +1306,7 @@ namespace SparkyStudios::AI::Behave::Navigation
             rcMarkWalkableTriangles(
                 _context.get(), config.walkableSlopeAngle, vertices, verticesCount, triangleData, triangleCount, _trianglesArea.data());
 
-            if (!rcRasterizeTriangles(
+            if (!rcRasterizeTrianglesBatch(
                     _context.get(), vertices, verticesCount, triangleData, _trianglesArea.data(), triangleCount, *_solidHeightField,
                     config.walkableClimb))
             {
@@ -594,6 +1317,22 @@ namespace SparkyStudios::AI::Behave::Navigation
 
         _trianglesArea.clear();
 
+        // Terrain heightfields are rasterized straight from their samples, without being triangulated.
+        for (const auto& heightfield : geometry.mHeightfields)
+        {
+            if (IsBuildCancelled())
+                return false;
+
+            if (!heightfield->Rasterize(_context.get(), *_solidHeightField, config.walkableSlopeAngle, config.walkableClimb))
+            {
+                _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not rasterize terrain heightfield.");
+                return false;
+            }
+        }
+
+        if (IsBuildCancelled())
+            return false;
+
         // Step 3. Filter walkable surfaces.
         // ---------------------------------
 
@@ -609,6 +1348,15 @@ namespace SparkyStudios::AI::Behave::Navigation
         if (_settings->m_filterWalkableLowHeightSpans)
             rcFilterWalkableLowHeightSpans(_context.get(), config.walkableHeight, *_solidHeightField);
 
+        for (int i = 0; i < _solidHeightField->width * _solidHeightField->height; ++i)
+        {
+            for (const rcSpan* span = _solidHeightField->spans[i]; span != nullptr; span = span->next)
+                ++_tileStatistics.mSpansCount;
+        }
+
+        if (IsBuildCancelled())
+            return false;
+
         // Step 4. Partition walkable surface to simple regions.
         // -----------------------------------------------------
 
@@ -637,14 +1385,18 @@ namespace SparkyStudios::AI::Behave::Navigation
             return false;
         }
 
-        // Mark navigation mesh areas.
-        for (const auto& v : _areaConvexVolumes)
+        // Mark navigation mesh areas. Only the volumes overlapping the tile build area are marked.
+        areaConvexVolumes.Query(config.bmin, config.bmax, _tileAreaConvexVolumes);
+
+        for (const RecastAreaConvexVolume* v : _tileAreaConvexVolumes)
         {
             rcMarkConvexPolyArea(
-                _context.get(), v.mVertices.front().data(), static_cast<int>(v.mVertices.size()), v.mHMin, v.mHMax, v.mArea,
+                _context.get(), v->mVertices.front().data(), static_cast<int>(v->mVertices.size()), v->mHMin, v->mHMax, v->mArea,
                 *_compactHeightField);
         }
 
+        _tileAreaConvexVolumes.clear();
+
         if (_settings->m_partitionType == NavigationMeshPartitionType::Watershed)
         {
             // Prepare for region partitioning, by calculating distance field along the walkable surface.
@@ -682,6 +1434,9 @@ namespace SparkyStudios::AI::Behave::Navigation
             }
         }
 
+        if (IsBuildCancelled())
+            return false;
+
         // Step 5. Trace and simplify region contours.
         // -------------------------------------------
 
@@ -705,6 +1460,9 @@ namespace SparkyStudios::AI::Behave::Navigation
             return false;
         }
 
+        if (IsBuildCancelled())
+            return false;
+
         // Step 6. Build polygons mesh from contours.
         // ------------------------------------------
 
@@ -723,6 +1481,9 @@ namespace SparkyStudios::AI::Behave::Navigation
             return false;
         }
 
+        if (IsBuildCancelled())
+            return false;
+
         // Step 7. Create detail mesh which allows to access approximate height on each polygon.
         // -------------------------------------------------------------------------------------
 
@@ -741,6 +1502,9 @@ namespace SparkyStudios::AI::Behave::Navigation
             return false;
         }
 
+        if (IsBuildCancelled())
+            return false;
+
         // Step 8. Create Detour data from Recast poly mesh.
         // -------------------------------------------------
 
@@ -755,24 +1519,9 @@ namespace SparkyStudios::AI::Behave::Navigation
                 return false;
             }
 
-            BehaveNavigationMeshAreaVector areas;
-            EBUS_EVENT(NavigationAreaProviderRequestBus, GetRegisteredNavigationAreas, areas);
-
             // Update poly flags from navigation mesh areas.
-            if (!areas.empty())
-            {
-                for (int i = 0; i < _polyMesh->npolys; ++i)
-                {
-                    for (const auto& area : areas)
-                    {
-                        if (_polyMesh->areas[i] == area.GetId())
-                        {
-                            _polyMesh->flags[i] = area.GetFlags();
-                            break;
-                        }
-                    }
-                }
-            }
+            for (int i = 0; i < _polyMesh->npolys; ++i)
+                _polyMesh->flags[i] = areaConvexVolumes.GetAreaFlags(_polyMesh->areas[i]);
 
             dtNavMeshCreateParams params{};
 
@@ -834,9 +1583,577 @@ namespace SparkyStudios::AI::Behave::Navigation
 
             _context->stopTimer(RC_TIMER_TOTAL);
 
+            _tileStatistics.mPolygonsCount = aznumeric_cast<AZ::u32>(_polyMesh->npolys);
+            _tileStatistics.mRasterizeTime = _context->GetAccumulatedTimeMs(RC_TIMER_RASTERIZE_TRIANGLES);
+            _tileStatistics.mFilterTime = _context->GetAccumulatedTimeMs(RC_TIMER_FILTER_LOW_OBSTACLES) +
+                _context->GetAccumulatedTimeMs(RC_TIMER_FILTER_BORDER) + _context->GetAccumulatedTimeMs(RC_TIMER_FILTER_WALKABLE);
+            _tileStatistics.mCompactTime = _context->GetAccumulatedTimeMs(RC_TIMER_BUILD_COMPACTHEIGHTFIELD);
+            _tileStatistics.mErodeTime =
+                _context->GetAccumulatedTimeMs(RC_TIMER_ERODE_AREA) + _context->GetAccumulatedTimeMs(RC_TIMER_MARK_CONVEXPOLY_AREA);
+            _tileStatistics.mRegionsTime =
+                _context->GetAccumulatedTimeMs(RC_TIMER_BUILD_DISTANCEFIELD) + _context->GetAccumulatedTimeMs(RC_TIMER_BUILD_REGIONS);
+            _tileStatistics.mContoursTime = _context->GetAccumulatedTimeMs(RC_TIMER_BUILD_CONTOURS);
+            _tileStatistics.mPolyMeshTime = _context->GetAccumulatedTimeMs(RC_TIMER_BUILD_POLYMESH);
+            _tileStatistics.mDetailMeshTime = _context->GetAccumulatedTimeMs(RC_TIMER_BUILD_POLYMESHDETAIL);
+            _tileStatistics.mTotalTime = _context->GetAccumulatedTimeMs(RC_TIMER_TOTAL);
+            _tileStatistics.mPeakMemory = _context->GetPeakMemory();
+
             return true;
         }
 
         return false;
     }
+
+    void RecastNavigationMesh::UpdateStreaming(const AZStd::vector<AZ::Vector3>& anchors)
+    {
+        // Streaming is paused while the navigation mesh is rebuilt.
+        if (!IsStreamingEnabled() || !IsNavigationMeshReady() || _buildRunning)
+            return;
+
+        // The navigation mesh was swapped, tiles will be loaded again in the new one.
+        if (const AZ::u32 generation = _generation.load(); generation != _streamingGeneration)
+        {
+            ResetStreaming();
+            _streamingGeneration = generation;
+        }
+
+        IntegrateStreamedTiles();
+
+        const NavigationMeshData* current = GetCurrentData();
+        if (current->mTileCellSize <= 0.0f)
+            return;
+
+        const int tileWidth = current->mTileWidth;
+        const int tileHeight = current->mTileHeight;
+        const float tileCellSize = current->mTileCellSize;
+
+        const RecastVector3 worldMin(_aabb.GetMin());
+        const float radius = _settings->m_streamingRadius;
+        const float radiusSq = radius * radius;
+        const AZStd::size_t budget = aznumeric_cast<AZStd::size_t>(_settings->m_streamingMemoryBudget) * 1024 * 1024;
+
+        // Collect the tiles overlapping the streaming radius of at least one anchor, with their distance to the closest anchor.
+        AZStd::unordered_map<AZ::u64, float> desiredTiles;
+        for (const AZ::Vector3& anchor : anchors)
+        {
+            const RecastVector3 position(anchor);
+            const float px = position.mXYZ[0] - worldMin.mXYZ[0];
+            const float pz = position.mXYZ[2] - worldMin.mXYZ[2];
+
+            const int minX = AZStd::clamp(aznumeric_cast<int>(AZStd::floor((px - radius) / tileCellSize)), 0, tileWidth - 1);
+            const int maxX = AZStd::clamp(aznumeric_cast<int>(AZStd::floor((px + radius) / tileCellSize)), 0, tileWidth - 1);
+            const int minY = AZStd::clamp(aznumeric_cast<int>(AZStd::floor((pz - radius) / tileCellSize)), 0, tileHeight - 1);
+            const int maxY = AZStd::clamp(aznumeric_cast<int>(AZStd::floor((pz + radius) / tileCellSize)), 0, tileHeight - 1);
+
+            for (int y = minY; y <= maxY; ++y)
+            {
+                for (int x = minX; x <= maxX; ++x)
+                {
+                    // Distance from the anchor to the closest point of the tile.
+                    const float dx = AZStd::max(0.0f, AZStd::max(x * tileCellSize - px, px - (x + 1) * tileCellSize));
+                    const float dz = AZStd::max(0.0f, AZStd::max(y * tileCellSize - pz, pz - (y + 1) * tileCellSize));
+                    const float distanceSq = dx * dx + dz * dz;
+
+                    if (distanceSq > radiusSq)
+                        continue;
+
+                    const AZ::u64 key = GetTileKey(x, y);
+                    if (auto it = desiredTiles.find(key); it != desiredTiles.end())
+                        it->second = AZStd::min(it->second, distanceSq);
+                    else
+                        desiredTiles.emplace(key, distanceSq);
+                }
+            }
+        }
+
+        // Evict tiles out of range, then the farthest ones while we exceed the memory budget.
+        AZStd::vector<AZ::u64> outOfRangeTiles;
+        AZStd::vector<AZStd::pair<float, AZ::u64>> inRangeTiles;
+        for (const auto& [key, size] : _residentTiles)
+        {
+            if (auto it = desiredTiles.find(key); it != desiredTiles.end())
+                inRangeTiles.emplace_back(it->second, key);
+            else
+                outOfRangeTiles.push_back(key);
+        }
+
+        for (const AZ::u64 key : outOfRangeTiles)
+        {
+            EvictStreamingTile(key);
+        }
+
+        if (_residentTilesSize > budget)
+        {
+            AZStd::sort(
+                inRangeTiles.begin(), inRangeTiles.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first > rhs.first;
+                });
+
+            for (const auto& [distanceSq, key] : inRangeTiles)
+            {
+                if (_residentTilesSize <= budget)
+                    break;
+
+                EvictStreamingTile(key);
+            }
+        }
+
+        // Load the missing tiles, nearest first.
+        AZStd::vector<AZStd::pair<float, AZ::u64>> missingTiles;
+        for (const auto& [key, distanceSq] : desiredTiles)
+        {
+            if (_residentTiles.find(key) == _residentTiles.end() && _pendingTiles.find(key) == _pendingTiles.end())
+                missingTiles.emplace_back(distanceSq, key);
+        }
+
+        AZStd::sort(
+            missingTiles.begin(), missingTiles.end(),
+            [](const auto& lhs, const auto& rhs)
+            {
+                return lhs.first < rhs.first;
+            });
+
+        int requestsCount = 0;
+        for (const auto& [distanceSq, key] : missingTiles)
+        {
+            const int tileX = aznumeric_cast<AZ::s32>(key >> 32);
+            const int tileY = aznumeric_cast<AZ::s32>(key & 0xFFFFFFFF);
+
+            if (_bakedTiles.Contains(key))
+            {
+                if (_residentTilesSize + _bakedTiles.GetUncompressedSize(key) <= budget)
+                    LoadBakedTile(key, tileX, tileY);
+
+                continue;
+            }
+
+            if (_residentTilesSize >= budget || requestsCount >= kMaxStreamingTileRequestsPerUpdate)
+                continue;
+
+            if (RequestStreamingTile(tileX, tileY))
+                ++requestsCount;
+        }
+
+        // Resident tiles and the baked tiles cache share the budget. The cache only gets what the resident tiles leave,
+        // since its tiles can be built again.
+        _bakedTiles.Trim(budget - AZStd::min(_residentTilesSize, budget));
+
+        ProcessStreamingRequests();
+        CommitTileChanges();
+    }
+
+    bool RecastNavigationMesh::InvalidateTiles(const AZ::Aabb& bounds)
+    {
+        const NavigationMeshData* current = GetCurrentData();
+        if (_settings == nullptr || !_settings->m_enableTiling || current == nullptr || current->mTileCellSize <= 0.0f)
+            return false;
+
+        const int tileWidth = current->mTileWidth;
+        const int tileHeight = current->mTileHeight;
+        const float tileCellSize = current->mTileCellSize;
+
+        if (!bounds.IsValid() || !bounds.Overlaps(_aabb))
+            return true;
+
+        // Terrains changed in the bounds are fetched again when their tiles are rebuilt.
+        for (auto it = _terrainHeightfields.begin(); it != _terrainHeightfields.end();)
+        {
+            if (it->second->mBounds.Overlaps(bounds))
+                it = _terrainHeightfields.erase(it);
+            else
+                ++it;
+        }
+
+        const RecastVector3 worldMin(_aabb.GetMin());
+        const RecastVector3 bMin(bounds.GetMin()), bMax(bounds.GetMax());
+
+        // Tiles are built with a border, so geometry near a tile edge also affects the neighbor tiles.
+        const float border = GetTileBorderSize();
+
+        const int minX = AZStd::clamp(
+            aznumeric_cast<int>(AZStd::floor((bMin.mXYZ[0] - border - worldMin.mXYZ[0]) / tileCellSize)), 0, tileWidth - 1);
+        const int maxX = AZStd::clamp(
+            aznumeric_cast<int>(AZStd::floor((bMax.mXYZ[0] + border - worldMin.mXYZ[0]) / tileCellSize)), 0, tileWidth - 1);
+        const int minY = AZStd::clamp(
+            aznumeric_cast<int>(AZStd::floor((bMin.mXYZ[2] - border - worldMin.mXYZ[2]) / tileCellSize)), 0, tileHeight - 1);
+        const int maxY = AZStd::clamp(
+            aznumeric_cast<int>(AZStd::floor((bMax.mXYZ[2] + border - worldMin.mXYZ[2]) / tileCellSize)), 0, tileHeight - 1);
+
+        for (int y = minY; y <= maxY; ++y)
+        {
+            for (int x = minX; x <= maxX; ++x)
+            {
+                _dirtyTiles.insert(GetTileKey(x, y));
+            }
+        }
+
+        return true;
+    }
+
+    void RecastNavigationMesh::UpdateDirtyTiles()
+    {
+        // Outdated tiles are kept while the navigation mesh is rebuilt, and processed once the build completes.
+        if (!IsNavigationMeshReady() || _buildRunning || _settings == nullptr || !_settings->m_enableTiling)
+            return;
+
+        // The navigation mesh was swapped, drop the tiles built for the previous one.
+        if (const AZ::u32 generation = _generation.load(); generation != _streamingGeneration)
+        {
+            ResetStreaming();
+            _streamingGeneration = generation;
+        }
+
+        IntegrateStreamedTiles();
+
+        const bool streaming = IsStreamingEnabled();
+
+        int requestsCount = 0;
+        for (auto it = _dirtyTiles.begin(); it != _dirtyTiles.end() && requestsCount < kMaxDirtyTileRequestsPerUpdate;)
+        {
+            const AZ::u64 key = *it;
+
+            // The tile is being built with outdated geometry, build it again once it is integrated.
+            if (_pendingTiles.find(key) != _pendingTiles.end())
+            {
+                ++it;
+                continue;
+            }
+
+            // Streamed out tiles are built again when they are loaded, only drop their outdated baked copy.
+            if (streaming && _residentTiles.find(key) == _residentTiles.end())
+            {
+                _bakedTiles.Remove(key);
+                it = _dirtyTiles.erase(it);
+                continue;
+            }
+
+            const int tileX = aznumeric_cast<AZ::s32>(key >> 32);
+            const int tileY = aznumeric_cast<AZ::s32>(key & 0xFFFFFFFF);
+
+            // Dirty tiles are built through the streaming requests, which replace the tile once built.
+            if (RequestStreamingTile(tileX, tileY))
+                ++requestsCount;
+
+            it = _dirtyTiles.erase(it);
+        }
+
+        ProcessStreamingRequests();
+        CommitTileChanges();
+    }
+
+    bool RecastNavigationMesh::RequestStreamingTile(const int tileX, const int tileY)
+    {
+        const AZ::u64 key = GetTileKey(tileX, tileY);
+
+        RecastVector3 bMin, bMax;
+        GetTileBounds(GetCurrentData()->mTileCellSize, tileX, tileY, bMin, bMax);
+
+        StreamingTileBuildRequest request;
+        request.mTileX = tileX;
+        request.mTileY = tileY;
+        request.mBoundsMin = bMin;
+        request.mBoundsMax = bMax;
+
+        // Include the tile border, the same way BuildTileEx expands the build area.
+        const float border = GetTileBorderSize();
+        bMin.mXYZ[0] -= border;
+        bMin.mXYZ[2] -= border;
+        bMax.mXYZ[0] += border;
+        bMax.mXYZ[2] += border;
+
+        const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(bMin.AsVector3(), bMax.AsVector3());
+
+        AzPhysics::SceneQueryHits results{};
+        if (!QueryColliders(bounds, results))
+            return false;
+
+        request.mGeometry = GetColliderGeometry(bounds, results, request.mAreaConvexVolumes);
+        request.mGeometry.mTileX = tileX;
+        request.mGeometry.mTileY = tileY;
+
+        if (request.mGeometry.IsEmpty())
+        {
+            // Nothing to build there, remember the tile as an empty resident tile. An outdated tile may still be there.
+            if (const auto it = _residentTiles.find(key); it != _residentTiles.end())
+                _residentTilesSize -= it->second;
+
+            _tileChanges.push_back({ tileX, tileY, nullptr, 0 });
+
+            _bakedTiles.Remove(key);
+            _residentTiles[key] = 0;
+            return true;
+        }
+
+        _pendingTiles.insert(key);
+        _streamingRequests.push_back(AZStd::move(request));
+
+        return true;
+    }
+
+    bool RecastNavigationMesh::LoadBakedTile(const AZ::u64 key, const int tileX, const int tileY)
+    {
+        const AZStd::vector<AZ::u8>* bakedTile = _bakedTiles.Acquire(key);
+        if (bakedTile == nullptr)
+            return false;
+
+        const int dataSize = aznumeric_cast<int>(bakedTile->size());
+
+        auto* data = static_cast<AZ::u8*>(dtAlloc(dataSize, DT_ALLOC_PERM));
+        if (data == nullptr)
+        {
+            _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Out of memory while loading baked tile (%d, %d).", tileX, tileY);
+            return false;
+        }
+
+        memcpy(data, bakedTile->data(), dataSize);
+
+        _tileChanges.push_back({ tileX, tileY, data, dataSize });
+
+        _residentTiles[key] = dataSize;
+        _residentTilesSize += dataSize;
+
+        return true;
+    }
+
+    void RecastNavigationMesh::EvictStreamingTile(const AZ::u64 key)
+    {
+        const auto it = _residentTiles.find(key);
+        if (it == _residentTiles.end())
+            return;
+
+        const int tileX = aznumeric_cast<AZ::s32>(key >> 32);
+        const int tileY = aznumeric_cast<AZ::s32>(key & 0xFFFFFFFF);
+
+        if (it->second > 0)
+        {
+            // Keep a compressed copy of the tile data, so it is not rebuilt when an anchor gets back in range.
+            // Tiles loaded from the store are left unchanged, so there is no need to compress them again.
+            int dataSize = 0;
+            if (const AZ::u8* data = FindTileData(tileX, tileY, dataSize); data != nullptr && !_bakedTiles.Contains(key))
+                _bakedTiles.Store(key, data, dataSize);
+
+            _tileChanges.push_back({ tileX, tileY, nullptr, 0 });
+            _residentTilesSize -= it->second;
+        }
+
+        _residentTiles.erase(it);
+    }
+
+    void RecastNavigationMesh::IntegrateStreamedTiles()
+    {
+        AZStd::vector<StreamingTileData> tiles;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(_streamedTilesMutex);
+            tiles.swap(_streamedTiles);
+        }
+
+        for (const StreamingTileData& tile : tiles)
+        {
+            const AZ::u64 key = GetTileKey(tile.mTileX, tile.mTileY);
+            _pendingTiles.erase(key);
+
+            // The tile was built again, drop any stale baked copy.
+            _bakedTiles.Remove(key);
+
+            // Replace the outdated tile, if any. A tile with no data only removes it.
+            if (const auto it = _residentTiles.find(key); it != _residentTiles.end())
+                _residentTilesSize -= it->second;
+
+            _tileChanges.push_back(tile);
+
+            _residentTiles[key] = tile.mDataSize;
+            _residentTilesSize += tile.mDataSize;
+        }
+    }
+
+    bool RecastNavigationMesh::CopyTiles(const dtNavMesh& source, dtNavMesh& destination)
+    {
+        const dtNavMesh& constDestination = destination;
+
+        for (int i = 0; i < source.getMaxTiles(); ++i)
+        {
+            const dtMeshTile* tile = source.getTile(i);
+
+            // Tiles are copied at the same index with the same salt, so their references stay valid. The salt of the
+            // empty slots is kept as well, so the references of the removed tiles are not reused. Detour has no API
+            // to set it, but the slots of the destination are not shared yet.
+            const_cast<dtMeshTile*>(constDestination.getTile(i))->salt = tile->salt;
+
+            if (tile->header == nullptr)
+                continue;
+
+            auto* data = static_cast<AZ::u8*>(dtAlloc(tile->dataSize, DT_ALLOC_PERM));
+            if (data == nullptr)
+                return false;
+
+            memcpy(data, tile->data, tile->dataSize);
+
+            if (const dtStatus status = destination.addTile(data, tile->dataSize, DT_TILE_FREE_DATA, source.getTileRef(tile), nullptr);
+                dtStatusFailed(status))
+            {
+                dtFree(data);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    const AZ::u8* RecastNavigationMesh::FindTileData(const int tileX, const int tileY, int& dataSize) const
+    {
+        // The last queued change of the tile is the most recent data.
+        for (auto it = _tileChanges.rbegin(); it != _tileChanges.rend(); ++it)
+        {
+            if (it->mTileX == tileX && it->mTileY == tileY)
+            {
+                dataSize = it->mDataSize;
+                return it->mData;
+            }
+        }
+
+        const NavigationMeshData* current = GetCurrentData();
+        const dtNavMesh* navMesh = current != nullptr ? current->mNavMesh.get() : nullptr;
+        const dtMeshTile* tile = navMesh != nullptr ? navMesh->getTileAt(tileX, tileY, 0) : nullptr;
+        if (tile == nullptr || tile->header == nullptr)
+            return nullptr;
+
+        dataSize = tile->dataSize;
+        return tile->data;
+    }
+
+    bool RecastNavigationMesh::CommitTileChanges()
+    {
+        if (_tileChanges.empty())
+            return true;
+
+        const NavigationMeshData* current = GetCurrentData();
+        if (current == nullptr)
+            return false;
+
+        const dtNavMesh* source = current->mNavMesh.get();
+
+        auto data = AZStd::make_unique<NavigationMeshData>();
+        data->mTileWidth = current->mTileWidth;
+        data->mTileHeight = current->mTileHeight;
+        data->mTileCellSize = current->mTileCellSize;
+        data->mNavMesh.reset(dtAllocNavMesh());
+        data->mNavQuery.reset(dtAllocNavMeshQuery());
+
+        // On failure, the changes are kept for the next update.
+        if (!data->mNavMesh || !data->mNavQuery || dtStatusFailed(data->mNavMesh->init(source->getParams())) ||
+            !CopyTiles(*source, *data->mNavMesh) || dtStatusFailed(data->mNavQuery->init(data->mNavMesh.get(), kQueryMaxNodes)) ||
+            !InitRaycastQueries(*data))
+        {
+            _context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not copy the navigation mesh to update its tiles.");
+            return false;
+        }
+
+        dtNavMesh* navMesh = data->mNavMesh.get();
+
+        for (const StreamingTileData& change : _tileChanges)
+        {
+            navMesh->removeTile(navMesh->getTileRefAt(change.mTileX, change.mTileY, 0), nullptr, nullptr);
+
+            if (change.mData == nullptr)
+                continue;
+
+            if (const dtStatus status = navMesh->addTile(change.mData, change.mDataSize, DT_TILE_FREE_DATA, 0, nullptr);
+                dtStatusFailed(status))
+            {
+                dtFree(change.mData);
+
+                // The tile is not resident anymore, unless a later change replaced it.
+                const AZ::u64 key = GetTileKey(change.mTileX, change.mTileY);
+                if (const auto it = _residentTiles.find(key); it != _residentTiles.end() && it->second == change.mDataSize)
+                {
+                    _residentTilesSize -= it->second;
+                    _residentTiles.erase(it);
+                }
+            }
+        }
+
+        _tileChanges.clear();
+
+        Publish(AZStd::move(data), false);
+
+        return true;
+    }
+
+    void RecastNavigationMesh::ProcessStreamingRequests()
+    {
+        if (_streamingRequests.empty() || _streamingJobRunning)
+            return;
+
+        _streamingJobRunning = true;
+        _cancelRequested = false;
+        _streamingRequestsInFlight.swap(_streamingRequests);
+
+        auto* job = AZ::CreateJobFunction(
+            [this]() -> void
+            {
+                for (const StreamingTileBuildRequest& request : _streamingRequestsInFlight)
+                {
+                    StreamingTileData tile;
+                    tile.mTileX = request.mTileX;
+                    tile.mTileY = request.mTileY;
+
+                    const bool built = BuildTileEx(
+                        request.mTileX, request.mTileY, request.mBoundsMin.data(), request.mBoundsMax.data(), request.mGeometry,
+                        request.mAreaConvexVolumes,
+                        tile.mDataSize, tile.mData);
+
+                    if (!built)
+                    {
+                        tile.mData = nullptr;
+                        tile.mDataSize = 0;
+                    }
+
+                    RecordStreamedTileStatistics(built);
+
+                    AZStd::lock_guard<AZStd::mutex> lock(_streamedTilesMutex);
+                    _streamedTiles.push_back(tile);
+                }
+
+                _streamingRequestsInFlight.clear();
+                _streamingJobRunning = false;
+            },
+            true);
+
+        job->Start();
+    }
+
+    void RecastNavigationMesh::ResetStreaming()
+    {
+        _residentTiles.clear();
+        _residentTilesSize = 0;
+        _pendingTiles.clear();
+        _bakedTiles.Clear();
+        _bakedTiles.SetHotSetBudget(aznumeric_cast<AZStd::size_t>(_settings->m_streamingHotSetBudget) * 1024 * 1024);
+        _streamingRequests.clear();
+
+        for (const StreamingTileData& tile : _tileChanges)
+        {
+            dtFree(tile.mData);
+        }
+
+        _tileChanges.clear();
+
+        AZStd::lock_guard<AZStd::mutex> lock(_streamedTilesMutex);
+        for (const StreamingTileData& tile : _streamedTiles)
+        {
+            dtFree(tile.mData);
+        }
+
+        _streamedTiles.clear();
+    }
+
+    void RecastNavigationMesh::WaitForStreamingJob() const
+    {
+        while (_streamingJobRunning)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
 } // namespace SparkyStudios::AI::Behave::Navigation
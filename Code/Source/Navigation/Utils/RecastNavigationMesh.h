@@ -15,15 +15,23 @@
 #pragma once
 
 #include <SparkyStudios/AI/Behave/Navigation/INavigationMesh.h>
+#include <SparkyStudios/AI/Behave/Navigation/NavigationMeshStatisticsBus.h>
 
+#include <Navigation/Utils/RecastAreaConvexVolumes.h>
+#include <Navigation/Utils/RecastContext.h>
 #include <Navigation/Utils/RecastMath.h>
 #include <Navigation/Utils/RecastSmartPointer.h>
+#include <Navigation/Utils/RecastTileStore.h>
 
 #include <DetourNavMesh.h>
 #include <DetourNavMeshQuery.h>
 #include <Recast.h>
 
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <AzFramework/Physics/PhysicsScene.h>
 
@@ -34,24 +42,333 @@ namespace SparkyStudios::AI::Behave::Navigation
         friend class DynamicNavigationMeshEditorComponent;
         friend class DynamicNavigationMeshComponent;
 
+        struct NavigationMeshData
+        {
+            RecastPointer<dtNavMesh> mNavMesh;
+            RecastPointer<dtNavMeshQuery> mNavQuery;
+
+            // Query objects reserved to batched raycasts, one per worker job.
+            AZStd::vector<RecastPointer<dtNavMeshQuery>> mRaycastQueries;
+
+            // The tiles grid, published with the navigation mesh built with it. Empty when not tiled.
+            int mTileWidth = 0;
+            int mTileHeight = 0;
+            float mTileCellSize = 0.0f;
+        };
+
     public:
+        /**
+         * @brief The priority of a navigation mesh build request.
+         */
+        enum class BuildPriority
+        {
+            /**
+             * @brief The request waits for the running build to complete.
+             */
+            Normal,
+
+            /**
+             * @brief The request cancels the running build, its result being outdated.
+             */
+            High,
+        };
+
+        /**
+         * @brief Keeps the current navigation mesh alive while in scope.
+         *
+         * Navigation meshes are rebuilt in the background and swapped once ready. A scope registers
+         * the caller as a reader of the current epoch. Swapped navigation meshes are retired, and only
+         * released by ProcessBuildQueue once every reader which may still use them has left its scope.
+         *
+         * A published navigation mesh is never modified. Tiles loaded, evicted or rebuilt afterwards are applied
+         * to a copy of it, which is swapped in the same way.
+         *
+         * Scopes are meant to be short lived, they should not be kept across frames.
+         */
+        class QueryScope
+        {
+            friend class RecastNavigationMesh;
+
+        public:
+            explicit QueryScope(const RecastNavigationMesh& navigationMesh);
+            ~QueryScope();
+
+            QueryScope(const QueryScope&) = delete;
+            QueryScope& operator=(const QueryScope&) = delete;
+
+            /**
+             * @brief Gets the navigation mesh, or nullptr if it is not built yet.
+             */
+            [[nodiscard]] dtNavMesh* GetNavigationMesh() const;
+
+            /**
+             * @brief Gets the navigation mesh query object, or nullptr if the navigation mesh is not built yet.
+             */
+            [[nodiscard]] dtNavMeshQuery* GetNavigationMeshQuery() const;
+
+        private:
+            const RecastNavigationMesh& _navigationMesh;
+            AZ::u64 _epoch;
+            NavigationMeshData* _data;
+        };
+
         RecastNavigationMesh(AZ::EntityId navigationMeshEntityId, bool isEditor = false);
+        ~RecastNavigationMesh();
+
+        /**
+         * @brief Builds the navigation mesh in the background.
+         *
+         * The current navigation mesh keeps serving queries during the build, and is swapped
+         * with the new one once it is ready. NavigationMeshNotifications::OnNavigationMeshUpdated
+         * is sent after the swap, from ProcessBuildQueue.
+         *
+         * When a build is already running, the request is queued. Queued requests are coalesced,
+         * so only one build is started once the running one completes, with the latest settings.
+         *
+         * @param navMesh The navigation mesh component providing the build settings.
+         * @param priority The request priority. High priority requests cancel the running build.
+         *
+         * @return true if the build was started or queued, false otherwise.
+         */
+        bool BuildNavigationMesh(const INavigationMesh* navMesh, BuildPriority priority = BuildPriority::Normal);
+
+        /**
+         * @brief Starts a full navigation mesh build from already gathered geometry, e.g. to build the same level
+         * with different settings. The geometry is shared, and kept alive until the next build.
+         *
+         * Streaming is not supported, and the request is not queued when a build is already running.
+         *
+         * @param navMesh The navigation mesh component providing the build settings.
+         * @param geometry The geometry gathered with GatherGeometry.
+         * @param areaConvexVolumes The navigation area volumes gathered with GatherGeometry.
+         *
+         * @return true if the build was started, false otherwise.
+         */
+        bool BuildNavigationMesh(
+            const INavigationMesh* navMesh,
+            AZStd::shared_ptr<const RecastNavigationMeshGeometry> geometry,
+            AZStd::shared_ptr<const RecastAreaConvexVolumes> areaConvexVolumes);
+
+        /**
+         * @brief Gathers the walkable geometry and the navigation area volumes of a navigation mesh, the same way
+         * builds do. Must be called from the main thread, while no build is running.
+         *
+         * @param navMesh The navigation mesh component providing the settings and the bounds.
+         * @param geometry Receives the walkable geometry.
+         * @param areaConvexVolumes Receives the navigation area volumes.
+         *
+         * @return false if no collider was found in the navigation mesh bounds.
+         */
+        bool GatherGeometry(
+            const INavigationMesh* navMesh,
+            AZStd::shared_ptr<const RecastNavigationMeshGeometry>& geometry,
+            AZStd::shared_ptr<const RecastAreaConvexVolumes>& areaConvexVolumes);
+
+        /**
+         * @brief Cancels the running navigation mesh build, and drops the queued request if any.
+         *
+         * The current navigation mesh is kept. NavigationMeshNotifications::OnNavigationMeshBuildCancelled
+         * is sent once the running build has stopped.
+         */
+        void CancelBuild();
+
+        /**
+         * @brief Checks if a navigation mesh build is running or queued.
+         */
+        [[nodiscard]] bool IsBuilding() const;
+
+        /**
+         * @brief Sends the pending build notifications, releases the retired navigation meshes no reader
+         * uses anymore, and starts the queued build request when the running one has completed.
+         *
+         * This method must be called regularly from the main thread, usually on tick.
+         */
+        void ProcessBuildQueue();
+
+        /**
+         * @brief Loads and evicts tiles according to the given streaming anchors positions.
+         *
+         * Tiles overlapping the streaming radius of an anchor are loaded from the baked tiles cache, or built
+         * in the background when not available. Resident tiles outside of every anchor radius, or the farthest
+         * ones when the memory budget is exceeded, are evicted into the baked tiles cache.
+         *
+         * The memory budget covers both the resident tiles and the baked tiles cache. Resident tiles have the
+         * priority, the cache only gets the part of the budget they leave unused.
+         *
+         * The tile changes are applied to a copy of the current navigation mesh, including all its resident tiles,
+         * which is swapped in at the end of the update. The generation is kept, so the tile and polygon references
+         * of the tiles left unchanged stay valid. Queries running concurrently keep using the previous copy.
+         *
+         * This method must be called from the main thread, the one calling ProcessBuildQueue.
+         *
+         * @param anchors The world positions of the streaming anchors.
+         */
+        void UpdateStreaming(const AZStd::vector<AZ::Vector3>& anchors);
+
+        /**
+         * @brief Marks the navigation mesh tiles overlapping the given world bounds as outdated.
+         *
+         * Marked tiles are rebuilt in the background by UpdateDirtyTiles. Tiles marked while a full build
+         * is running are rebuilt once it completes.
+         *
+         * @param bounds The world bounds in which the navigation mesh is outdated.
+         *
+         * @return false if the navigation mesh is not tiled, in which case it must be fully rebuilt.
+         */
+        bool InvalidateTiles(const AZ::Aabb& bounds);
+
+        /**
+         * @brief Rebuilds a limited number of the tiles marked by InvalidateTiles, and integrates the rebuilt ones.
+         *
+         * Rebuilt tiles are swapped in with a copy of the navigation mesh, the same way as UpdateStreaming does.
+         * This method must be called from the main thread, the one calling ProcessBuildQueue, on tick.
+         */
+        void UpdateDirtyTiles();
 
-        bool BuildNavigationMesh(const INavigationMesh* navMesh);
+        /**
+         * @brief Checks if the navigation mesh is built with tiles streamed around anchors.
+         */
+        [[nodiscard]] bool IsStreamingEnabled() const;
 
+        /**
+         * @brief Gets the usage statistics of the compressed store holding the tiles evicted by streaming.
+         */
+        [[nodiscard]] NavigationMeshTileStoreStatistics GetTileStoreStatistics() const;
+
+        /**
+         * @brief Gets the statistics of the last navigation mesh build, including the tiles built since by streaming.
+         */
+        [[nodiscard]] NavigationMeshBuildStatistics GetBuildStatistics() const;
+
+        /**
+         * @brief Gets the statistics of the last navigation mesh build as a JSON document.
+         *
+         * @param includeTiles Whether to include the statistics of each tile, or only the aggregated ones.
+         */
+        [[nodiscard]] AZStd::string DumpBuildStatistics(bool includeTiles) const;
+
+        /**
+         * @brief Gets the current navigation mesh.
+         *
+         * The returned pointer may be released by a concurrent rebuild, use a QueryScope to access it safely.
+         */
         dtNavMesh* GetNavigationMesh() const;
+
+        /**
+         * @brief Gets the current navigation mesh query object.
+         *
+         * The returned pointer may be released by a concurrent rebuild, use a QueryScope to access it safely.
+         */
         dtNavMeshQuery* GetNavigationMeshQuery() const;
 
         bool IsNavigationMeshReady() const;
 
+        /**
+         * @brief Gets the navigation mesh generation, incremented each time a newly built navigation mesh is swapped in.
+         * Copies swapped in by UpdateStreaming and UpdateDirtyTiles keep the generation.
+         */
+        [[nodiscard]] AZ::u32 GetGeneration() const;
+
+        /**
+         * @brief Casts a batch of rays along the navigation mesh surface.
+         *
+         * Large batches are split into jobs running on worker threads, each one using its own query object.
+         * The call blocks until all the raycasts are done. This method must be called from the thread issuing
+         * navigation queries, usually the main thread.
+         *
+         * @param batch The segments to cast, and the arrays receiving the results.
+         *
+         * @return The number of segments reaching their end without hitting a wall.
+         */
+        AZ::u32 Raycast(const NavigationRaycastBatch& batch) const;
+
         static RecastVector3 GetPolyCenter(const dtNavMesh* navMesh, dtPolyRef ref);
 
     private:
-        RecastNavigationMeshGeometry GetColliderGeometry(const AZ::Aabb& aabb, const AzPhysics::SceneQueryHits& overlapHits);
+        enum class BuildStatus
+        {
+            None,
+            Succeeded,
+            Failed,
+            Cancelled,
+        };
+
+        struct StreamingTileBuildRequest
+        {
+            int mTileX = 0;
+            int mTileY = 0;
+            RecastVector3 mBoundsMin;
+            RecastVector3 mBoundsMax;
+            RecastNavigationMeshGeometry mGeometry;
+            RecastAreaConvexVolumes mAreaConvexVolumes;
+        };
+
+        struct RetiredNavigationMeshData
+        {
+            AZStd::unique_ptr<NavigationMeshData> mData;
+            AZ::u64 mEpoch = 0;
+        };
+
+        struct StreamingTileData
+        {
+            int mTileX = 0;
+            int mTileY = 0;
+            AZ::u8* mData = nullptr;
+            int mDataSize = 0;
+        };
+
+        static AZ::u64 GetTileKey(int tileX, int tileY);
 
+        bool QueryColliders(const AZ::Aabb& aabb, AzPhysics::SceneQueryHits& results) const;
+        AZStd::shared_ptr<const RecastTerrainHeightfield> GetTerrainHeightfield(const AZ::EntityId& entityId);
+        RecastNavigationMeshGeometry GetColliderGeometry(
+            const AZ::Aabb& aabb,
+            const AzPhysics::SceneQueryHits& overlapHits,
+            RecastAreaConvexVolumes& areaConvexVolumes);
+
+        [[nodiscard]] const NavigationMeshData* GetCurrentData() const;
+        void GetTileBounds(float tileCellSize, int tileX, int tileY, RecastVector3& bMin, RecastVector3& bMax) const;
+        [[nodiscard]] float GetTileBorderSize() const;
+
+        bool GatherGeometry(
+            const AZ::Aabb& aabb,
+            AZStd::shared_ptr<const RecastNavigationMeshGeometry>& geometry,
+            AZStd::shared_ptr<const RecastAreaConvexVolumes>& areaConvexVolumes);
+        bool StartBuild(
+            const INavigationMesh* navMesh,
+            AZStd::shared_ptr<const RecastNavigationMeshGeometry> geometry = nullptr,
+            AZStd::shared_ptr<const RecastAreaConvexVolumes> areaConvexVolumes = nullptr);
         bool Build();
-        bool BuildTile(int tileX, int tileY, float tileCellSize);
-        bool BuildTileEx(int tileX, int tileY, const float* bMin, const float* bMax, int& dataSize, AZ::u8*& navData);
+        [[nodiscard]] bool IsBuildCancelled() const;
+        void ReportBuildProgress(float progress);
+        void RecordTileStatistics(NavigationMeshBuildStatistics& statistics, bool built) const;
+        void RecordStreamedTileStatistics(bool built);
+        static void AccumulateTileStatistics(NavigationMeshTileBuildStatistics& total, const NavigationMeshTileBuildStatistics& tile);
+        bool BuildTile(dtNavMesh* navMesh, float tileCellSize, int tileX, int tileY);
+        bool InitRaycastQueries(NavigationMeshData& data) const;
+        void Publish(AZStd::unique_ptr<NavigationMeshData> data, bool newGeneration);
+        void ReleaseRetiredData();
+        bool BuildTileEx(
+            int tileX,
+            int tileY,
+            const float* bMin,
+            const float* bMax,
+            const RecastNavigationMeshGeometry& geometry,
+            const RecastAreaConvexVolumes& areaConvexVolumes,
+            int& dataSize,
+            AZ::u8*& navData);
+
+        static bool CopyTiles(const dtNavMesh& source, dtNavMesh& destination);
+        const AZ::u8* FindTileData(int tileX, int tileY, int& dataSize) const;
+        bool CommitTileChanges();
+
+        bool RequestStreamingTile(int tileX, int tileY);
+        bool LoadBakedTile(AZ::u64 key, int tileX, int tileY);
+        void EvictStreamingTile(AZ::u64 key);
+        void IntegrateStreamedTiles();
+        void ProcessStreamingRequests();
+        void ResetStreaming();
+        void WaitForStreamingJob() const;
 
         AZ::EntityId _entityId;
         bool _isEditor;
@@ -61,19 +378,57 @@ namespace SparkyStudios::AI::Behave::Navigation
 
         AZStd::atomic<bool> _navMeshReady = false;
 
-        RecastNavigationMeshGeometry _geometry;
-        AZStd::vector<RecastAreaConvexVolume> _areaConvexVolumes;
+        // Shared, so several builds can use the same gathered geometry.
+        AZStd::shared_ptr<const RecastNavigationMeshGeometry> _geometry;
+        AZStd::shared_ptr<const RecastAreaConvexVolumes> _areaConvexVolumes;
+        AZStd::unordered_map<AZ::EntityId, AZStd::shared_ptr<const RecastTerrainHeightfield>> _terrainHeightfields;
         RecastOffMeshConnections _offMeshConnections;
 
-        AZStd::unique_ptr<rcContext> _context;
+        AZStd::unique_ptr<RecastContext> _context;
         AZStd::vector<AZ::u8> _trianglesArea;
+        AZStd::vector<const RecastAreaConvexVolume*> _tileAreaConvexVolumes;
 
         RecastPointer<rcHeightfield> _solidHeightField;
         RecastPointer<rcCompactHeightfield> _compactHeightField;
         RecastPointer<rcContourSet> _contourSet;
         RecastPointer<rcPolyMesh> _polyMesh;
         RecastPointer<rcPolyMeshDetail> _detailMesh;
-        RecastPointer<dtNavMesh> _navMesh;
-        RecastPointer<dtNavMeshQuery> _navQuery;
+
+        NavigationMeshTileBuildStatistics _tileStatistics;
+        NavigationMeshBuildStatistics _pendingStatistics;
+        NavigationMeshBuildStatistics _statistics;
+        AZ::u32 _streamedTileStatisticsNext = 0;
+        mutable AZStd::mutex _statisticsMutex;
+
+        AZStd::atomic<NavigationMeshData*> _data = nullptr;
+        AZStd::atomic<AZ::u32> _generation = 0;
+        AZStd::atomic<bool> _buildRunning = false;
+        AZStd::atomic<bool> _cancelRequested = false;
+        AZStd::atomic<BuildStatus> _buildStatus = BuildStatus::None;
+        AZStd::atomic<float> _buildProgress = 0.0f;
+        AZStd::atomic<float> _buildRemainingTime = 0.0f;
+        AZStd::atomic<bool> _buildProgressUpdated = false;
+        AZStd::chrono::steady_clock::time_point _buildStartTime;
+        const INavigationMesh* _queuedBuild = nullptr;
+        mutable AZStd::atomic<AZ::u64> _epoch = 0;
+        mutable AZStd::atomic<AZ::u32> _readers[2];
+        AZStd::vector<RetiredNavigationMeshData> _retiredData;
+        AZStd::mutex _retiredDataMutex;
+
+        AZStd::unordered_map<AZ::u64, int> _residentTiles;
+        AZStd::size_t _residentTilesSize = 0;
+        AZStd::unordered_set<AZ::u64> _pendingTiles;
+        AZStd::unordered_set<AZ::u64> _dirtyTiles;
+        RecastTileStore _bakedTiles;
+        AZ::u32 _streamingGeneration = 0;
+
+        AZStd::vector<StreamingTileBuildRequest> _streamingRequests;
+        AZStd::vector<StreamingTileBuildRequest> _streamingRequestsInFlight;
+        AZStd::vector<StreamingTileData> _streamedTiles;
+
+        // Tiles to add, or to remove when they have no data, in the next copy of the navigation mesh.
+        AZStd::vector<StreamingTileData> _tileChanges;
+        AZStd::mutex _streamedTilesMutex;
+        AZStd::atomic<bool> _streamingJobRunning = false;
     };
 } // namespace SparkyStudios::AI::Behave::Navigation
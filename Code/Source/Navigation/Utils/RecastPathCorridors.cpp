@@ -0,0 +1,190 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Navigation/Utils/RecastPathCorridors.h>
+
+#include <DetourCommon.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    // Maximum number of polygons in a corridor, and of corners returned by an update.
+    static constexpr int kMaxCorridorLength = 256;
+    static constexpr int kMaxCorners = 256;
+
+    // Number of polygons ahead of the agent checked for validity on each update.
+    static constexpr int kValidityLookAhead = 16;
+
+    // Number of updates between two local optimizations of the corridor topology.
+    static constexpr AZ::u32 kTopologyOptimizationInterval = 8;
+
+    // Maximum horizontal distance between the agent and the corridor start before a new path is searched.
+    static constexpr float kMaxPositionDrift = 1.0f;
+
+    NavigationPathResult RecastPathCorridors::Update(
+        const RecastNavigationMesh::QueryScope& scope,
+        const AZ::u32 generation,
+        const AZ::EntityId& agent,
+        const AZ::Vector3& from,
+        const AZ::Vector3& target,
+        NavigationPathBuffer& path)
+    {
+        NavigationPathResult result;
+
+        dtNavMeshQuery* navMeshQuery = scope.GetNavigationMeshQuery();
+        if (navMeshQuery == nullptr || path.mCorners == nullptr || path.mCapacity == 0)
+            return result;
+
+        AZStd::unique_ptr<Corridor>& entry = _corridors[agent];
+        if (!entry)
+        {
+            entry = AZStd::make_unique<Corridor>();
+
+            if (!entry->mCorridor.init(kMaxCorridorLength))
+            {
+                _corridors.erase(agent);
+                return result;
+            }
+        }
+
+        Corridor& corridor = *entry;
+
+        const RecastVector3 startRecast{ from }, targetRecast{ target };
+        constexpr float halfExtents[3] = { 1.0f, 1.0f, 1.0f };
+
+        const dtQueryFilter filter;
+
+        dtPolyRef targetPoly = 0;
+        RecastVector3 nearestTargetPoint;
+
+        dtStatus status = navMeshQuery->findNearestPoly(targetRecast.data(), halfExtents, &filter, &targetPoly, nearestTargetPoint.data());
+        if (dtStatusFailed(status) || targetPoly == 0)
+            return result;
+
+        // Polygon references of a previous navigation mesh are meaningless, even if they are still valid.
+        bool replan = !corridor.mValid || corridor.mGeneration != generation;
+
+        if (!replan)
+        {
+            // Slide the corridor ends along the navigation mesh surface. This fails when the polygons are no longer valid.
+            replan = !corridor.mCorridor.movePosition(startRecast.data(), navMeshQuery, &filter) ||
+                !corridor.mCorridor.moveTargetPosition(nearestTargetPoint.data(), navMeshQuery, &filter) ||
+                !corridor.mCorridor.isValid(kValidityLookAhead, navMeshQuery, &filter);
+        }
+
+        if (!replan)
+        {
+            // The agent was moved outside of the corridor, by a teleport or a physics push.
+            replan = dtVdist2DSqr(corridor.mCorridor.getPos(), startRecast.data()) > kMaxPositionDrift * kMaxPositionDrift;
+        }
+
+        if (!replan && corridor.mCorridor.getLastPoly() != targetPoly)
+        {
+            // The target moved out of the reach of the corridor. Partial paths are kept while the target stays
+            // in the same unreachable polygon, so they are not searched again on each update.
+            replan = !corridor.mPartial || corridor.mTargetPoly != targetPoly;
+        }
+
+        if (replan)
+        {
+            dtPolyRef startPoly = 0;
+            RecastVector3 nearestStartPoint;
+
+            corridor.mValid = false;
+
+            status = navMeshQuery->findNearestPoly(startRecast.data(), halfExtents, &filter, &startPoly, nearestStartPoint.data());
+            if (dtStatusFailed(status) || startPoly == 0)
+                return result;
+
+            if (!Replan(corridor, navMeshQuery, filter, startPoly, nearestStartPoint.data(), targetPoly, nearestTargetPoint.data()))
+                return result;
+
+            corridor.mValid = true;
+            corridor.mGeneration = generation;
+            corridor.mTargetPoly = targetPoly;
+            corridor.mUpdatesCount = 0;
+        }
+        else if (++corridor.mUpdatesCount % kTopologyOptimizationInterval == 0)
+        {
+            corridor.mCorridor.optimizePathTopology(navMeshQuery, &filter);
+        }
+
+        // Corners are written on the stack, then converted into the caller buffers.
+        RecastVector3 corners[kMaxCorners];
+        AZ::u8 cornersFlags[kMaxCorners];
+        dtPolyRef cornersPolygons[kMaxCorners];
+
+        const int maxCorners = aznumeric_cast<int>(AZStd::min<AZ::u32>(path.mCapacity, kMaxCorners));
+        const int cornersCount =
+            corridor.mCorridor.findCorners(corners[0].data(), cornersFlags, cornersPolygons, maxCorners, navMeshQuery, &filter);
+
+        for (int i = 0; i < cornersCount; ++i)
+        {
+            path.mCorners[i] = corners[i].AsVector3();
+
+            if (path.mFlags != nullptr)
+                path.mFlags[i] = cornersFlags[i];
+
+            if (path.mPolygons != nullptr)
+                path.mPolygons[i] = cornersPolygons[i];
+        }
+
+        result.mCornersCount = aznumeric_cast<AZ::u32>(cornersCount);
+        result.mFound = true;
+        result.mPartial = corridor.mPartial;
+        result.mTruncated = cornersCount > 0 && (cornersFlags[cornersCount - 1] & DT_STRAIGHTPATH_END) == 0;
+
+        return result;
+    }
+
+    void RecastPathCorridors::Release(const AZ::EntityId& agent)
+    {
+        _corridors.erase(agent);
+    }
+
+    void RecastPathCorridors::Clear()
+    {
+        _corridors.clear();
+    }
+
+    bool RecastPathCorridors::Replan(
+        Corridor& corridor,
+        dtNavMeshQuery* navMeshQuery,
+        const dtQueryFilter& filter,
+        const dtPolyRef startPoly,
+        const float* startPosition,
+        const dtPolyRef targetPoly,
+        const float* targetPosition)
+    {
+        dtPolyRef polygons[kMaxCorridorLength];
+        int polygonsCount = 0;
+
+        const dtStatus status = navMeshQuery->findPath(
+            startPoly, targetPoly, startPosition, targetPosition, &filter, polygons, &polygonsCount, kMaxCorridorLength);
+
+        if (dtStatusFailed(status) || polygonsCount == 0)
+            return false;
+
+        RecastVector3 end{ targetPosition };
+
+        // When the target can't be reached, end the corridor on the closest point of the last polygon.
+        corridor.mPartial = polygons[polygonsCount - 1] != targetPoly;
+        if (corridor.mPartial)
+            navMeshQuery->closestPointOnPoly(polygons[polygonsCount - 1], targetPosition, end.data(), nullptr);
+
+        corridor.mCorridor.reset(startPoly, startPosition);
+        corridor.mCorridor.setCorridor(end.data(), polygons, polygonsCount);
+
+        return true;
+    }
+} // namespace SparkyStudios::AI::Behave::Navigation
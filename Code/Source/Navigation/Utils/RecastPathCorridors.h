@@ -0,0 +1,100 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <SparkyStudios/AI/Behave/Navigation/NavigationMeshBus.h>
+
+#include <Navigation/Utils/RecastNavigationMesh.h>
+
+#include <DetourPathCorridor.h>
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    /**
+     * @brief Keeps a persistent path corridor per agent, so paths toward moving targets are adjusted
+     * incrementally instead of being searched again from scratch.
+     *
+     * Each update moves the corridor start and end along the navigation mesh surface, and periodically
+     * optimizes the corridor with a local search. A full path search is only done when the corridor
+     * becomes invalid, when the target leaves the reach of the corridor, or when the navigation mesh is rebuilt.
+     *
+     * This class is not thread safe, and must be used from the thread issuing navigation queries.
+     */
+    class RecastPathCorridors
+    {
+    public:
+        RecastPathCorridors() = default;
+
+        /**
+         * @brief Updates the path corridor of an agent, and writes the path corners ahead of the agent into caller owned buffers.
+         *
+         * The corridor is created on the first update of the agent.
+         *
+         * @param scope The query scope keeping the navigation mesh alive.
+         * @param generation The generation of the navigation mesh in the scope.
+         * @param agent The agent owning the corridor.
+         * @param from The current agent position.
+         * @param target The current target position.
+         * @param path The buffers receiving the path corners.
+         *
+         * @return The number of corners written, and whether the path is partial or truncated.
+         */
+        NavigationPathResult Update(
+            const RecastNavigationMesh::QueryScope& scope,
+            AZ::u32 generation,
+            const AZ::EntityId& agent,
+            const AZ::Vector3& from,
+            const AZ::Vector3& target,
+            NavigationPathBuffer& path);
+
+        /**
+         * @brief Releases the path corridor of an agent.
+         *
+         * @param agent The agent owning the corridor.
+         */
+        void Release(const AZ::EntityId& agent);
+
+        /**
+         * @brief Releases all the path corridors.
+         */
+        void Clear();
+
+    private:
+        struct Corridor
+        {
+            dtPathCorridor mCorridor;
+            AZ::u32 mGeneration = 0;
+            dtPolyRef mTargetPoly = 0;
+            AZ::u32 mUpdatesCount = 0;
+            bool mValid = false;
+            bool mPartial = false;
+        };
+
+        static bool Replan(
+            Corridor& corridor,
+            dtNavMeshQuery* navMeshQuery,
+            const dtQueryFilter& filter,
+            dtPolyRef startPoly,
+            const float* startPosition,
+            dtPolyRef targetPoly,
+            const float* targetPosition);
+
+        AZStd::unordered_map<AZ::EntityId, AZStd::unique_ptr<Corridor>> _corridors;
+    };
+} // namespace SparkyStudios::AI::Behave::Navigation
@@ -0,0 +1,305 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Navigation/Utils/RecastTerrainHeightfield.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <AzFramework/Physics/HeightfieldProviderBus.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    // Maximum number of jobs computing the spans of a height field.
+    static constexpr AZ::u32 kMaxRasterizationJobs = 8;
+
+    // Minimum number of height field rows computed by a single job.
+    static constexpr int kMinRowsPerJob = 16;
+
+    struct RecastTerrainSpan
+    {
+        unsigned short mMin = 0;
+        unsigned short mMax = 0;
+        AZ::u8 mArea = RC_NULL_AREA;
+        bool mValid = false;
+    };
+
+    static void ComputeSpans(
+        const RecastTerrainHeightfield& heightfield,
+        const rcHeightfield& heightField,
+        const float walkableThreshold,
+        const int beginRow,
+        const int endRow,
+        AZStd::vector<RecastTerrainSpan>& spans)
+    {
+        const float cs = heightField.cs;
+        const float ich = 1.0f / heightField.ch;
+        const float by = heightField.bmax[1] - heightField.bmin[1];
+
+        for (int y = beginRow; y < endRow; ++y)
+        {
+            const float z0 = heightField.bmin[2] + aznumeric_cast<float>(y) * cs;
+            const float z1 = z0 + cs;
+
+            // Samples rows inside the cell.
+            const int r0 = AZStd::max(0, aznumeric_cast<int>(AZStd::ceil((z0 - heightfield.mOrigin[1]) / heightfield.mSpacing[1])));
+            const int r1 = AZStd::min(
+                heightfield.mRowsCount - 1, aznumeric_cast<int>(AZStd::floor((z1 - heightfield.mOrigin[1]) / heightfield.mSpacing[1])));
+
+            for (int x = 0; x < heightField.width; ++x)
+            {
+                const float x0 = heightField.bmin[0] + aznumeric_cast<float>(x) * cs;
+                const float x1 = x0 + cs;
+
+                // The cell walkable flag is given by the surface at its center, as triangles are rasterized in the cells they cover.
+                float height, normalY;
+                if (!heightfield.SampleSurface(x0 + cs * 0.5f, z0 + cs * 0.5f, height, normalY))
+                    continue;
+
+                const AZ::u8 area = normalY > walkableThreshold ? RC_WALKABLE_AREA : RC_NULL_AREA;
+                float minHeight = height, maxHeight = height;
+
+                // The surface is linear between samples, so its extents in the cell are at the cell corners or on the samples.
+                const float corners[4][2] = { { x0, z0 }, { x1, z0 }, { x0, z1 }, { x1, z1 } };
+                for (const auto& corner : corners)
+                {
+                    float cornerNormalY;
+                    if (heightfield.SampleSurface(corner[0], corner[1], height, cornerNormalY))
+                    {
+                        minHeight = AZStd::min(minHeight, height);
+                        maxHeight = AZStd::max(maxHeight, height);
+                    }
+                }
+
+                const int c0 = AZStd::max(0, aznumeric_cast<int>(AZStd::ceil((x0 - heightfield.mOrigin[0]) / heightfield.mSpacing[0])));
+                const int c1 = AZStd::min(
+                    heightfield.mColumnsCount - 1,
+                    aznumeric_cast<int>(AZStd::floor((x1 - heightfield.mOrigin[0]) / heightfield.mSpacing[0])));
+
+                for (int r = r0; r <= r1; ++r)
+                {
+                    for (int c = c0; c <= c1; ++c)
+                    {
+                        height = heightfield.mBaseHeight + heightfield.mHeights[r * heightfield.mColumnsCount + c];
+                        minHeight = AZStd::min(minHeight, height);
+                        maxHeight = AZStd::max(maxHeight, height);
+                    }
+                }
+
+                // Clip the span to the height field bounds, the same way triangles are clipped.
+                float smin = minHeight - heightField.bmin[1];
+                float smax = maxHeight - heightField.bmin[1];
+
+                if (smax < 0.0f || smin > by)
+                    continue;
+
+                smin = AZStd::max(smin, 0.0f);
+                smax = AZStd::min(smax, by);
+
+                // Keep room for a non-empty span below the maximum height, so the clamp bounds of ismax stay ordered.
+                const int ismin = AZStd::clamp(aznumeric_cast<int>(AZStd::floor(smin * ich)), 0, RC_SPAN_MAX_HEIGHT - 1);
+                const int ismax = AZStd::clamp(aznumeric_cast<int>(AZStd::ceil(smax * ich)), ismin + 1, RC_SPAN_MAX_HEIGHT);
+
+                RecastTerrainSpan& span = spans[y * heightField.width + x];
+                span.mMin = aznumeric_cast<unsigned short>(ismin);
+                span.mMax = aznumeric_cast<unsigned short>(ismax);
+                span.mArea = area;
+                span.mValid = true;
+            }
+        }
+    }
+
+    AZStd::shared_ptr<RecastTerrainHeightfield> RecastTerrainHeightfield::Create(const AZ::EntityId& entityId)
+    {
+        size_t columnsCount = 0, rowsCount = 0;
+        Physics::HeightfieldProviderRequestsBus::Event(
+            entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSize, columnsCount, rowsCount);
+
+        if (columnsCount < 2 || rowsCount < 2)
+            return nullptr;
+
+        AZStd::vector<Physics::HeightMaterialPoint> samples;
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            samples, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightsAndMaterials);
+
+        if (samples.size() != columnsCount * rowsCount)
+            return nullptr;
+
+        AZ::Vector2 spacing = AZ::Vector2::CreateOne();
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            spacing, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSpacing);
+
+        AZ::Transform transform = AZ::Transform::CreateIdentity();
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            transform, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
+
+        auto heightfield = AZStd::make_shared<RecastTerrainHeightfield>();
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            heightfield->mBounds, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldAabb);
+
+        if (!heightfield->mBounds.IsValid() || spacing.GetX() <= 0.0f || spacing.GetY() <= 0.0f)
+            return nullptr;
+
+        // O3DE +Y axis is the Recast +Z axis, samples are stored row by row from the heightfield minimum corner.
+        heightfield->mOrigin[0] = heightfield->mBounds.GetMin().GetX();
+        heightfield->mOrigin[1] = heightfield->mBounds.GetMin().GetY();
+        heightfield->mSpacing[0] = spacing.GetX();
+        heightfield->mSpacing[1] = spacing.GetY();
+        heightfield->mBaseHeight = transform.GetTranslation().GetZ();
+        heightfield->mColumnsCount = aznumeric_cast<int>(columnsCount);
+        heightfield->mRowsCount = aznumeric_cast<int>(rowsCount);
+
+        heightfield->mHeights.reserve(samples.size());
+        heightfield->mQuadTypes.reserve(samples.size());
+
+        for (const auto& sample : samples)
+        {
+            heightfield->mHeights.push_back(sample.m_height);
+            heightfield->mQuadTypes.push_back(static_cast<AZ::u8>(sample.m_quadMeshType));
+        }
+
+        return heightfield;
+    }
+
+    bool RecastTerrainHeightfield::SampleSurface(const float x, const float z, float& height, float& normalY) const
+    {
+        const float fx = (x - mOrigin[0]) / mSpacing[0];
+        const float fz = (z - mOrigin[1]) / mSpacing[1];
+
+        if (fx < 0.0f || fz < 0.0f || fx > aznumeric_cast<float>(mColumnsCount - 1) || fz > aznumeric_cast<float>(mRowsCount - 1))
+            return false;
+
+        const int c = AZStd::min(aznumeric_cast<int>(fx), mColumnsCount - 2);
+        const int r = AZStd::min(aznumeric_cast<int>(fz), mRowsCount - 2);
+        const float u = fx - aznumeric_cast<float>(c);
+        const float v = fz - aznumeric_cast<float>(r);
+
+        const int i = r * mColumnsCount + c;
+        const auto quadType = static_cast<Physics::QuadMeshType>(mQuadTypes[i]);
+
+        if (quadType == Physics::QuadMeshType::Hole)
+            return false;
+
+        const float h00 = mHeights[i];
+        const float h10 = mHeights[i + 1];
+        const float h01 = mHeights[i + mColumnsCount];
+        const float h11 = mHeights[i + mColumnsCount + 1];
+
+        // Height gradients of the triangle containing the position, per sample.
+        float du, dv;
+
+        if (quadType == Physics::QuadMeshType::SubdivideUpperLeftToBottomRight)
+        {
+            if (u >= v)
+            {
+                du = h10 - h00;
+                dv = h11 - h10;
+            }
+            else
+            {
+                du = h11 - h01;
+                dv = h01 - h00;
+            }
+
+            height = h00 + u * du + v * dv;
+        }
+        else
+        {
+            if (u + v <= 1.0f)
+            {
+                du = h10 - h00;
+                dv = h01 - h00;
+                height = h00 + u * du + v * dv;
+            }
+            else
+            {
+                du = h11 - h01;
+                dv = h11 - h10;
+                height = h11 - (1.0f - u) * du - (1.0f - v) * dv;
+            }
+        }
+
+        height += mBaseHeight;
+
+        const float gx = du / mSpacing[0];
+        const float gz = dv / mSpacing[1];
+        normalY = 1.0f / AZStd::sqrt(1.0f + gx * gx + gz * gz);
+
+        return true;
+    }
+
+    bool RecastTerrainHeightfield::Rasterize(
+        rcContext* context, rcHeightfield& heightField, const float walkableSlopeAngle, const int flagMergeThreshold) const
+    {
+        rcScopedTimer timer(context, RC_TIMER_RASTERIZE_TRIANGLES);
+
+        if (heightField.width <= 0 || heightField.height <= 0)
+            return true;
+
+        const float walkableThreshold = AZStd::cos(walkableSlopeAngle / 180.0f * RC_PI);
+
+        AZStd::vector<RecastTerrainSpan> spans(heightField.width * heightField.height);
+
+        const AZ::u32 jobsCount = AZStd::clamp(
+            AZStd::min(AZStd::thread::hardware_concurrency(), aznumeric_cast<AZ::u32>(heightField.height / kMinRowsPerJob)), 1u,
+            kMaxRasterizationJobs);
+
+        if (jobsCount == 1)
+        {
+            ComputeSpans(*this, heightField, walkableThreshold, 0, heightField.height, spans);
+        }
+        else
+        {
+            AZ::JobCompletion completion;
+
+            for (AZ::u32 j = 0; j < jobsCount; ++j)
+            {
+                const int begin = aznumeric_cast<int>(AZ::u64(heightField.height) * j / jobsCount);
+                const int end = aznumeric_cast<int>(AZ::u64(heightField.height) * (j + 1) / jobsCount);
+
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [this, &heightField, &spans, walkableThreshold, begin, end]()
+                    {
+                        ComputeSpans(*this, heightField, walkableThreshold, begin, end, spans);
+                    },
+                    true);
+
+                job->SetDependent(&completion);
+                job->Start();
+            }
+
+            completion.StartAndWaitForCompletion();
+        }
+
+        // Spans are allocated from the height field pools, so they are added from a single thread.
+        for (int y = 0; y < heightField.height; ++y)
+        {
+            for (int x = 0; x < heightField.width; ++x)
+            {
+                const RecastTerrainSpan& span = spans[y * heightField.width + x];
+                if (!span.mValid)
+                    continue;
+
+                if (!rcAddSpan(context, heightField, x, y, span.mMin, span.mMax, span.mArea, flagMergeThreshold))
+                {
+                    context->log(RC_LOG_ERROR, "Navigation Mesh Builder: Could not add terrain span.");
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+} // namespace SparkyStudios::AI::Behave::Navigation
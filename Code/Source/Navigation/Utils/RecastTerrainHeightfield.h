@@ -0,0 +1,111 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Recast.h>
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    /**
+     * @brief Stores the height samples of a terrain heightfield collider, in Recast coordinate space (+Y up).
+     *
+     * Heightfields are rasterized straight from their samples into the Recast height field columns, instead of
+     * being triangulated and rasterized triangle by triangle.
+     */
+    struct RecastTerrainHeightfield
+    {
+        /**
+         * @brief Creates a heightfield from the provider connected to the given entity.
+         *
+         * Heightfields are expected to be axis aligned, which is the case of terrains.
+         *
+         * @param entityId The entity providing the heightfield.
+         *
+         * @return The heightfield, or nullptr if the entity provides no valid heightfield.
+         */
+        static AZStd::shared_ptr<RecastTerrainHeightfield> Create(const AZ::EntityId& entityId);
+
+        /**
+         * @brief Gets the terrain surface height and slope at the given position.
+         *
+         * @param x The position over the Recast X-axis.
+         * @param z The position over the Recast Z-axis.
+         * @param height The surface height at the given position.
+         * @param normalY The Y component of the surface normal at the given position.
+         *
+         * @return true if the position is on the terrain surface, false if the position is outside the heightfield or in a hole.
+         */
+        bool SampleSurface(float x, float z, float& height, float& normalY) const;
+
+        /**
+         * @brief Rasterizes the heightfield into the given Recast height field.
+         *
+         * Spans are computed in parallel for each column of the height field, then added to it.
+         *
+         * @param context The Recast context.
+         * @param heightField The height field to rasterize into.
+         * @param walkableSlopeAngle The maximum walkable slope angle, in degrees.
+         * @param flagMergeThreshold The distance where the walkable flag is favored over the non-walkable flag, in voxels.
+         *
+         * @return true if the heightfield was rasterized, false otherwise.
+         */
+        bool Rasterize(rcContext* context, rcHeightfield& heightField, float walkableSlopeAngle, int flagMergeThreshold) const;
+
+        /**
+         * @brief The heightfield bounds, in O3DE coordinate space.
+         */
+        AZ::Aabb mBounds = AZ::Aabb::CreateNull();
+
+        /**
+         * @brief The position of the first sample over the Recast X and Z axes.
+         */
+        float mOrigin[2] = { 0.0f, 0.0f };
+
+        /**
+         * @brief The distance between two samples over the Recast X and Z axes.
+         */
+        float mSpacing[2] = { 1.0f, 1.0f };
+
+        /**
+         * @brief The height the samples are relative to.
+         */
+        float mBaseHeight = 0.0f;
+
+        /**
+         * @brief The number of samples over the Recast X-axis.
+         */
+        int mColumnsCount = 0;
+
+        /**
+         * @brief The number of samples over the Recast Z-axis.
+         */
+        int mRowsCount = 0;
+
+        /**
+         * @brief The samples heights, row by row.
+         */
+        AZStd::vector<float> mHeights;
+
+        /**
+         * @brief The type of each quad, stored in the sample of its first corner.
+         */
+        AZStd::vector<AZ::u8> mQuadTypes;
+    };
+} // namespace SparkyStudios::AI::Behave::Navigation
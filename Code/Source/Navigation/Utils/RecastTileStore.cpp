@@ -0,0 +1,331 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Navigation/Utils/RecastTileStore.h>
+
+#include <AzCore/std/containers/array.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    // The codec is a byte oriented LZ77 variant (similar to LZ4): each sequence is made of a token, literals, and an
+    // optional back reference. Tiles data is made of many repeated floats, shorts and zeroes, so it compresses well.
+    static constexpr AZ::u32 kHashBits = 12;
+    static constexpr AZStd::size_t kMinMatch = 4;
+    static constexpr AZStd::size_t kMaxOffset = 0xFFFF;
+
+    static AZ::u32 ReadU32(const AZ::u8* p)
+    {
+        AZ::u32 v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static void WriteLength(AZStd::vector<AZ::u8>& out, AZStd::size_t length)
+    {
+        while (length >= 255)
+        {
+            out.push_back(255);
+            length -= 255;
+        }
+
+        out.push_back(aznumeric_cast<AZ::u8>(length));
+    }
+
+    static bool ReadLength(const AZ::u8* in, const AZStd::size_t inSize, AZStd::size_t& ip, AZStd::size_t& length)
+    {
+        AZ::u8 b;
+        do
+        {
+            if (ip >= inSize)
+                return false;
+
+            b = in[ip++];
+            length += b;
+        } while (b == 255);
+
+        return true;
+    }
+
+    static void WriteSequence(
+        AZStd::vector<AZ::u8>& out,
+        const AZ::u8* literals,
+        const AZStd::size_t literalsCount,
+        const AZStd::size_t offset,
+        const AZStd::size_t matchLength)
+    {
+        const AZStd::size_t matchCode = matchLength > 0 ? matchLength - kMinMatch : 0;
+
+        const AZStd::size_t token = (AZStd::min<AZStd::size_t>(literalsCount, 15) << 4) | AZStd::min<AZStd::size_t>(matchCode, 15);
+        out.push_back(aznumeric_cast<AZ::u8>(token));
+
+        if (literalsCount >= 15)
+            WriteLength(out, literalsCount - 15);
+
+        out.insert(out.end(), literals, literals + literalsCount);
+
+        if (matchLength == 0)
+            return;
+
+        out.push_back(aznumeric_cast<AZ::u8>(offset & 0xFF));
+        out.push_back(aznumeric_cast<AZ::u8>((offset >> 8) & 0xFF));
+
+        if (matchCode >= 15)
+            WriteLength(out, matchCode - 15);
+    }
+
+    void RecastTileStore::Compress(const AZ::u8* data, const AZStd::size_t dataSize, AZStd::vector<AZ::u8>& compressed)
+    {
+        compressed.clear();
+        compressed.reserve(dataSize + dataSize / 255 + 16);
+
+        AZStd::array<AZ::s64, 1 << kHashBits> table;
+        table.fill(-1);
+
+        AZStd::size_t anchor = 0;
+        AZStd::size_t i = 0;
+
+        while (i + kMinMatch <= dataSize)
+        {
+            const AZ::u32 sequence = ReadU32(data + i);
+            const AZ::u32 hash = (sequence * 2654435761u) >> (32 - kHashBits);
+
+            const AZ::s64 previous = table[hash];
+            table[hash] = aznumeric_cast<AZ::s64>(i);
+
+            const AZStd::size_t candidate = aznumeric_cast<AZStd::size_t>(previous);
+            if (previous >= 0 && i - candidate <= kMaxOffset && ReadU32(data + candidate) == sequence)
+            {
+                AZStd::size_t matchLength = kMinMatch;
+                while (i + matchLength < dataSize && data[candidate + matchLength] == data[i + matchLength])
+                    ++matchLength;
+
+                WriteSequence(compressed, data + anchor, i - anchor, i - candidate, matchLength);
+
+                i += matchLength;
+                anchor = i;
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        // The last sequence only contains literals, and marks the end of the stream.
+        WriteSequence(compressed, data + anchor, dataSize - anchor, 0, 0);
+    }
+
+    bool RecastTileStore::Decompress(
+        const AZ::u8* compressed, const AZStd::size_t compressedSize, AZ::u8* data, const AZStd::size_t dataSize)
+    {
+        AZStd::size_t ip = 0;
+        AZStd::size_t op = 0;
+
+        while (ip < compressedSize)
+        {
+            const AZ::u8 token = compressed[ip++];
+
+            AZStd::size_t literalsCount = token >> 4;
+            if (literalsCount == 15 && !ReadLength(compressed, compressedSize, ip, literalsCount))
+                return false;
+
+            if (ip + literalsCount > compressedSize || op + literalsCount > dataSize)
+                return false;
+
+            memcpy(data + op, compressed + ip, literalsCount);
+            ip += literalsCount;
+            op += literalsCount;
+
+            // The last sequence has no match.
+            if (ip >= compressedSize)
+                break;
+
+            if (ip + 2 > compressedSize)
+                return false;
+
+            const AZStd::size_t offset = compressed[ip] | (compressed[ip + 1] << 8);
+            ip += 2;
+
+            if (offset == 0 || offset > op)
+                return false;
+
+            AZStd::size_t matchLength = token & 0xF;
+            if (matchLength == 15 && !ReadLength(compressed, compressedSize, ip, matchLength))
+                return false;
+
+            matchLength += kMinMatch;
+
+            if (op + matchLength > dataSize)
+                return false;
+
+            // The match may overlap the output, copy byte per byte.
+            const AZ::u8* match = data + op - offset;
+            for (AZStd::size_t j = 0; j < matchLength; ++j)
+                data[op + j] = match[j];
+
+            op += matchLength;
+        }
+
+        return op == dataSize;
+    }
+
+    void RecastTileStore::SetHotSetBudget(const AZStd::size_t budget)
+    {
+        _hotSetBudget = budget;
+        TrimHotSet();
+    }
+
+    void RecastTileStore::Store(const AZ::u64 key, const AZ::u8* data, const int dataSize)
+    {
+        Remove(key);
+
+        ColdTile& tile = _coldTiles[key];
+        Compress(data, aznumeric_cast<AZStd::size_t>(dataSize), tile.mCompressed);
+        tile.mCompressed.shrink_to_fit();
+        tile.mUncompressedSize = aznumeric_cast<AZStd::size_t>(dataSize);
+        tile.mSequence = ++_sequence;
+
+        _coldTilesOrder.emplace_back(key, tile.mSequence);
+        _compressedSize += tile.mCompressed.size();
+        _uncompressedSize += tile.mUncompressedSize;
+    }
+
+    const AZStd::vector<AZ::u8>* RecastTileStore::Acquire(const AZ::u64 key)
+    {
+        if (const auto it = _hotTiles.find(key); it != _hotTiles.end())
+        {
+            ++_hits;
+
+            // Move the tile at the front of the LRU list.
+            _hotTilesOrder.splice(_hotTilesOrder.begin(), _hotTilesOrder, it->second.mOrder);
+            return &it->second.mData;
+        }
+
+        const auto coldIt = _coldTiles.find(key);
+        if (coldIt == _coldTiles.end())
+            return nullptr;
+
+        ++_misses;
+
+        const ColdTile& coldTile = coldIt->second;
+
+        HotTile hotTile;
+        hotTile.mData.resize_no_construct(coldTile.mUncompressedSize);
+
+        if (!Decompress(coldTile.mCompressed.data(), coldTile.mCompressed.size(), hotTile.mData.data(), hotTile.mData.size()))
+        {
+            AZ_Error("BehaveAI [Navigation]", false, "Unable to decompress navigation mesh tile data. The tile will be dropped.");
+            Remove(key);
+            return nullptr;
+        }
+
+        _hotTilesOrder.push_front(key);
+        hotTile.mOrder = _hotTilesOrder.begin();
+        _hotSetSize += hotTile.mData.size();
+
+        auto [hotIt, inserted] = _hotTiles.emplace(key, AZStd::move(hotTile));
+        TrimHotSet();
+
+        return &hotIt->second.mData;
+    }
+
+    bool RecastTileStore::Contains(const AZ::u64 key) const
+    {
+        return _coldTiles.find(key) != _coldTiles.end();
+    }
+
+    AZStd::size_t RecastTileStore::GetUncompressedSize(const AZ::u64 key) const
+    {
+        const auto it = _coldTiles.find(key);
+        return it != _coldTiles.end() ? it->second.mUncompressedSize : 0;
+    }
+
+    void RecastTileStore::Remove(const AZ::u64 key)
+    {
+        RemoveHotTile(key);
+
+        if (const auto it = _coldTiles.find(key); it != _coldTiles.end())
+        {
+            _compressedSize -= it->second.mCompressed.size();
+            _uncompressedSize -= it->second.mUncompressedSize;
+            _coldTiles.erase(it);
+        }
+    }
+
+    void RecastTileStore::Trim(const AZStd::size_t budget)
+    {
+        // Drop the oldest tiles first, they will be built again on demand.
+        while (_compressedSize > budget && !_coldTilesOrder.empty())
+        {
+            const auto [key, sequence] = _coldTilesOrder.front();
+            _coldTilesOrder.pop_front();
+
+            // Skip entries of tiles which were removed or stored again since.
+            if (const auto it = _coldTiles.find(key); it != _coldTiles.end() && it->second.mSequence == sequence)
+            {
+                Remove(key);
+                ++_evictions;
+            }
+        }
+    }
+
+    void RecastTileStore::Clear()
+    {
+        _coldTiles.clear();
+        _coldTilesOrder.clear();
+        _compressedSize = 0;
+        _uncompressedSize = 0;
+
+        _hotTiles.clear();
+        _hotTilesOrder.clear();
+        _hotSetSize = 0;
+
+        _hits = 0;
+        _misses = 0;
+        _evictions = 0;
+    }
+
+    NavigationMeshTileStoreStatistics RecastTileStore::GetStatistics() const
+    {
+        NavigationMeshTileStoreStatistics statistics;
+        statistics.mTilesCount = aznumeric_cast<AZ::u32>(_coldTiles.size());
+        statistics.mHotTilesCount = aznumeric_cast<AZ::u32>(_hotTiles.size());
+        statistics.mCompressedSize = _compressedSize;
+        statistics.mUncompressedSize = _uncompressedSize;
+        statistics.mHotSetSize = _hotSetSize;
+        statistics.mHits = _hits;
+        statistics.mMisses = _misses;
+        statistics.mEvictions = _evictions;
+
+        return statistics;
+    }
+
+    void RecastTileStore::RemoveHotTile(const AZ::u64 key)
+    {
+        if (const auto it = _hotTiles.find(key); it != _hotTiles.end())
+        {
+            _hotSetSize -= it->second.mData.size();
+            _hotTilesOrder.erase(it->second.mOrder);
+            _hotTiles.erase(it);
+        }
+    }
+
+    void RecastTileStore::TrimHotSet()
+    {
+        // Always keep the most recently used tile, so the data returned by Acquire stays valid.
+        while (_hotSetSize > _hotSetBudget && _hotTilesOrder.size() > 1)
+        {
+            RemoveHotTile(_hotTilesOrder.back());
+        }
+    }
+} // namespace SparkyStudios::AI::Behave::Navigation
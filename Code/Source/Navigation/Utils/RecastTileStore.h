@@ -0,0 +1,156 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <SparkyStudios/AI/Behave/Navigation/NavigationMeshBus.h>
+
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace SparkyStudios::AI::Behave::Navigation
+{
+    /**
+     * @brief Stores navigation mesh tiles data which are not resident in the Detour navigation mesh.
+     *
+     * Tiles are kept compressed with a LZ77 codec (cold tiles). When a tile is accessed, it is decompressed
+     * into a bounded hot set, so tiles frequently going in and out of the navigation mesh are not
+     * decompressed again on each access.
+     */
+    class RecastTileStore
+    {
+    public:
+        RecastTileStore() = default;
+
+        /**
+         * @brief Sets the maximum amount of memory used by decompressed tiles in the hot set.
+         *
+         * @param budget The hot set budget, in bytes.
+         */
+        void SetHotSetBudget(AZStd::size_t budget);
+
+        /**
+         * @brief Compresses and stores the given tile data. Any previously stored data for the same tile is replaced.
+         *
+         * @param key The tile key.
+         * @param data The tile data, as created by dtCreateNavMeshData.
+         * @param dataSize The size of the tile data.
+         */
+        void Store(AZ::u64 key, const AZ::u8* data, int dataSize);
+
+        /**
+         * @brief Gets the decompressed data of a stored tile.
+         *
+         * The returned pointer stays valid until the next call to a non-const method of the store.
+         *
+         * @param key The tile key.
+         *
+         * @return The tile data, or nullptr if the tile is not stored or can't be decompressed.
+         */
+        const AZStd::vector<AZ::u8>* Acquire(AZ::u64 key);
+
+        /**
+         * @brief Checks if a tile is stored.
+         *
+         * @param key The tile key.
+         */
+        [[nodiscard]] bool Contains(AZ::u64 key) const;
+
+        /**
+         * @brief Gets the decompressed size of a stored tile, or 0 if the tile is not stored.
+         *
+         * @param key The tile key.
+         */
+        [[nodiscard]] AZStd::size_t GetUncompressedSize(AZ::u64 key) const;
+
+        /**
+         * @brief Removes a tile from the store.
+         *
+         * @param key The tile key.
+         */
+        void Remove(AZ::u64 key);
+
+        /**
+         * @brief Drops the oldest stored tiles until the compressed data fits in the given budget.
+         *
+         * @param budget The compressed data budget, in bytes.
+         */
+        void Trim(AZStd::size_t budget);
+
+        /**
+         * @brief Removes all the stored tiles and resets the statistics.
+         */
+        void Clear();
+
+        /**
+         * @brief Gets the store usage statistics.
+         */
+        [[nodiscard]] NavigationMeshTileStoreStatistics GetStatistics() const;
+
+        /**
+         * @brief Compresses a buffer with the store codec.
+         *
+         * @param data The data to compress.
+         * @param dataSize The size of the data to compress.
+         * @param compressed The buffer receiving the compressed data.
+         */
+        static void Compress(const AZ::u8* data, AZStd::size_t dataSize, AZStd::vector<AZ::u8>& compressed);
+
+        /**
+         * @brief Decompresses a buffer compressed with the store codec.
+         *
+         * @param compressed The compressed data.
+         * @param compressedSize The size of the compressed data.
+         * @param data The buffer receiving the decompressed data.
+         * @param dataSize The expected size of the decompressed data.
+         *
+         * @return true if the data was successfully decompressed, false otherwise.
+         */
+        static bool Decompress(const AZ::u8* compressed, AZStd::size_t compressedSize, AZ::u8* data, AZStd::size_t dataSize);
+
+    private:
+        struct ColdTile
+        {
+            AZStd::vector<AZ::u8> mCompressed;
+            AZStd::size_t mUncompressedSize = 0;
+            AZ::u64 mSequence = 0;
+        };
+
+        struct HotTile
+        {
+            AZStd::vector<AZ::u8> mData;
+            AZStd::list<AZ::u64>::iterator mOrder;
+        };
+
+        void RemoveHotTile(AZ::u64 key);
+        void TrimHotSet();
+
+        AZStd::unordered_map<AZ::u64, ColdTile> _coldTiles;
+        AZStd::deque<AZStd::pair<AZ::u64, AZ::u64>> _coldTilesOrder;
+        AZ::u64 _sequence = 0;
+        AZStd::size_t _compressedSize = 0;
+        AZStd::size_t _uncompressedSize = 0;
+
+        AZStd::unordered_map<AZ::u64, HotTile> _hotTiles;
+        AZStd::list<AZ::u64> _hotTilesOrder;
+        AZStd::size_t _hotSetSize = 0;
+        AZStd::size_t _hotSetBudget = 0;
+
+        AZ::u64 _hits = 0;
+        AZ::u64 _misses = 0;
+        AZ::u64 _evictions = 0;
+    };
+} // namespace SparkyStudios::AI::Behave::Navigation
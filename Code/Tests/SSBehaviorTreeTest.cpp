@@ -14,4 +14,399 @@
 
 #include <AzTest/AzTest.h>
 
+#include <SparkyStudios/AI/Behave/BehaviorTree/BehaveBehaviorTreeBus.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/AsyncNode.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Core/TreeInstancePool.h>
+#include <SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/CooldownNode.h>
+
+#include <Recast.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <random>
+
+namespace SparkyStudios::AI::Behave::Tests
+{
+    class RecastRasterizationTest : public ::testing::TestWithParam<int>
+    {
+    protected:
+        struct Mesh
+        {
+            AZStd::vector<float> mVertices;
+            AZStd::vector<int> mIndices;
+            AZStd::vector<unsigned char> mAreas;
+        };
+
+        static Mesh CreateRandomMesh(std::mt19937& rng, const int verticesCount, const int trianglesCount, const bool snapToGrid)
+        {
+            std::uniform_real_distribution<float> horizontal(-10.0f, 50.0f);
+            std::uniform_real_distribution<float> vertical(-5.0f, 25.0f);
+
+            Mesh mesh;
+
+            for (int i = 0; i < verticesCount; ++i)
+            {
+                float x = horizontal(rng), z = horizontal(rng);
+
+                // Vertices on the cells boundaries exercise the clipping edge cases.
+                if (snapToGrid)
+                {
+                    x = AZStd::floor(x * 2.0f) * 0.5f;
+                    z = AZStd::floor(z * 2.0f) * 0.5f;
+                }
+
+                mesh.mVertices.push_back(x);
+                mesh.mVertices.push_back(vertical(rng));
+                mesh.mVertices.push_back(z);
+            }
+
+            for (int i = 0; i < trianglesCount; ++i)
+            {
+                const int a = aznumeric_cast<int>(rng() % verticesCount);
+                mesh.mIndices.push_back(a);
+                mesh.mIndices.push_back(aznumeric_cast<int>((a + 1 + rng() % 20) % verticesCount));
+                mesh.mIndices.push_back(aznumeric_cast<int>((a + 2 + rng() % 30) % verticesCount));
+                mesh.mAreas.push_back(aznumeric_cast<unsigned char>(rng() % (RC_WALKABLE_AREA + 1)));
+            }
+
+            return mesh;
+        }
+
+        static void ExpectSameHeightfields(const rcHeightfield& expected, const rcHeightfield& actual)
+        {
+            ASSERT_EQ(expected.width, actual.width);
+            ASSERT_EQ(expected.height, actual.height);
+
+            for (int i = 0; i < expected.width * expected.height; ++i)
+            {
+                const rcSpan* e = expected.spans[i];
+                const rcSpan* a = actual.spans[i];
+
+                for (; e != nullptr && a != nullptr; e = e->next, a = a->next)
+                {
+                    ASSERT_EQ(e->smin, a->smin) << "column " << i;
+                    ASSERT_EQ(e->smax, a->smax) << "column " << i;
+                    ASSERT_EQ(e->area, a->area) << "column " << i;
+                }
+
+                ASSERT_EQ(e, nullptr) << "column " << i;
+                ASSERT_EQ(a, nullptr) << "column " << i;
+            }
+        }
+
+        static void RasterizeAndCompare(const Mesh& mesh, const float cellHeight, const int flagMergeThreshold)
+        {
+            rcContext context(false);
+
+            const float bMin[3] = { 0.0f, 0.0f, 0.0f };
+            const float bMax[3] = { 40.0f, 15.0f, 40.0f };
+            const float cellSize = 0.5f;
+
+            int width, height;
+            rcCalcGridSize(bMin, bMax, cellSize, &width, &height);
+
+            rcHeightfield* expected = rcAllocHeightfield();
+            rcHeightfield* actual = rcAllocHeightfield();
+            ASSERT_TRUE(rcCreateHeightfield(&context, *expected, width, height, bMin, bMax, cellSize, cellHeight));
+            ASSERT_TRUE(rcCreateHeightfield(&context, *actual, width, height, bMin, bMax, cellSize, cellHeight));
+
+            const int verticesCount = aznumeric_cast<int>(mesh.mVertices.size() / 3);
+            const int trianglesCount = aznumeric_cast<int>(mesh.mAreas.size());
+
+            EXPECT_TRUE(rcRasterizeTriangles(
+                &context, mesh.mVertices.data(), verticesCount, mesh.mIndices.data(), mesh.mAreas.data(), trianglesCount, *expected,
+                flagMergeThreshold));
+            EXPECT_TRUE(rcRasterizeTrianglesBatch(
+                &context, mesh.mVertices.data(), verticesCount, mesh.mIndices.data(), mesh.mAreas.data(), trianglesCount, *actual,
+                flagMergeThreshold));
+
+            ExpectSameHeightfields(*expected, *actual);
+
+            rcFreeHeightField(expected);
+            rcFreeHeightField(actual);
+        }
+    };
+
+    TEST_P(RecastRasterizationTest, BatchRasterizationMatchesScalarRasterization)
+    {
+        std::mt19937 rng(GetParam());
+
+        for (int flagMergeThreshold = 0; flagMergeThreshold <= 4; ++flagMergeThreshold)
+        {
+            RasterizeAndCompare(CreateRandomMesh(rng, 300, 200, false), 0.2f, flagMergeThreshold);
+            RasterizeAndCompare(CreateRandomMesh(rng, 300, 200, true), 0.2f, flagMergeThreshold);
+        }
+    }
+
+    TEST_P(RecastRasterizationTest, BatchRasterizationMatchesScalarRasterizationAtMaximumSpanHeight)
+    {
+        std::mt19937 rng(GetParam());
+
+        // With a tiny cell height, spans are clamped to the maximum span height.
+        RasterizeAndCompare(CreateRandomMesh(rng, 300, 200, false), 0.001f, 1);
+    }
+
+    TEST_P(RecastRasterizationTest, BatchRasterizationMatchesScalarRasterizationWithFewTriangles)
+    {
+        std::mt19937 rng(GetParam());
+
+        // Less triangles than a SIMD batch, so only the scalar fallback is used.
+        for (int trianglesCount = 0; trianglesCount < 9; ++trianglesCount)
+            RasterizeAndCompare(CreateRandomMesh(rng, 30, trianglesCount, false), 0.2f, 1);
+    }
+
+    INSTANTIATE_TEST_CASE_P(RecastRasterization, RecastRasterizationTest, ::testing::Range(0, 16));
+
+    class TreeInstancePoolTest : public UnitTest::AllocatorsTestFixture
+    {
+    protected:
+        // Provides the timer wheel used by the cooldown nodes.
+        class BehaviorTreeRequests : public BehaviorTree::BehaveBehaviorTreeRequests
+        {
+        public:
+            const BehaviorTree::Core::Factory& GetFactory() const override
+            {
+                return mFactory;
+            }
+
+            BehaviorTree::Core::TimerWheel& GetTimerWheel() override
+            {
+                return mTimerWheel;
+            }
+
+            BehaviorTree::Core::TreeInstancePool& GetTreeInstancePool() override
+            {
+                return mTreeInstancePool;
+            }
+
+            BehaviorTree::Blackboard::SharedBlackboardRegistry& GetSharedBlackboards() override
+            {
+                return mSharedBlackboards;
+            }
+
+            BehaviorTree::Core::Factory mFactory;
+            BehaviorTree::Core::TimerWheel mTimerWheel;
+            BehaviorTree::Core::TreeInstancePool mTreeInstancePool;
+            BehaviorTree::Blackboard::SharedBlackboardRegistry mSharedBlackboards;
+        };
+
+        static constexpr const char* kTreeXml = R"(
+            <root main_tree_to_execute="MainTree">
+                <BehaviorTree ID="MainTree">
+                    <Sequence>
+                        <Cooldown seconds="10">
+                            <SubTreePlus ID="Greet" message="hello" />
+                        </Cooldown>
+                        <SetBlackboard output_key="runtime" value="written" />
+                    </Sequence>
+                </BehaviorTree>
+                <BehaviorTree ID="Greet">
+                    <Sequence>
+                        <RecordMessage message="{message}" />
+                        <SetBlackboard output_key="message" value="overwritten" />
+                    </Sequence>
+                </BehaviorTree>
+            </root>)";
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsTestFixture::SetUp();
+
+            _requests = AZStd::make_unique<BehaviorTreeRequests>();
+            BehaviorTree::BehaveBehaviorTreeInterface::Register(_requests.get());
+
+            _factory.registerNodeType<BehaviorTree::Nodes::Common::CooldownNode>(
+                BehaviorTree::Nodes::Common::CooldownNode::NODE_NAME);
+            _factory.registerSimpleAction(
+                "RecordMessage",
+                [this](BT::TreeNode& node)
+                {
+                    _messages.push_back(node.getInput<std::string>("message").value_or("<missing>"));
+                    return BT::NodeStatus::SUCCESS;
+                },
+                { BT::InputPort<std::string>("message") });
+        }
+
+        void TearDown() override
+        {
+            BehaviorTree::BehaveBehaviorTreeInterface::Unregister(_requests.get());
+            _requests.reset();
+
+            UnitTest::AllocatorsTestFixture::TearDown();
+        }
+
+        AZStd::unique_ptr<BehaviorTreeRequests> _requests;
+        BT::BehaviorTreeFactory _factory;
+        std::vector<std::string> _messages;
+    };
+
+    TEST_F(TreeInstancePoolTest, PooledTreeBehavesLikeNewTree)
+    {
+        const AZ::Data::AssetId assetId(AZ::Uuid::CreateRandom(), 0);
+        BehaviorTree::Core::TreeInstancePool pool;
+
+        BT::Tree tree = _factory.createTreeFromText(kTreeXml);
+        EXPECT_EQ(tree.tickRoot(), BT::NodeStatus::SUCCESS);
+        EXPECT_EQ(_requests->mTimerWheel.GetPendingCount(), 1u);
+
+        ASSERT_TRUE(pool.Release(assetId, AZStd::move(tree)));
+
+        // The cooldown started by the previous owner is cancelled, so the pooled tree runs the subtree again.
+        EXPECT_EQ(_requests->mTimerWheel.GetPendingCount(), 0u);
+
+        BT::Tree pooledTree;
+        ASSERT_TRUE(pool.Acquire(assetId, false, pooledTree));
+
+        // Values written while running are gone, the constants given to the subtree are back.
+        const BT::Any* runtime = std::as_const(*pooledTree.rootBlackboard()).getAny("runtime");
+        EXPECT_TRUE(runtime == nullptr || runtime->empty());
+
+        EXPECT_EQ(pooledTree.tickRoot(), BT::NodeStatus::SUCCESS);
+
+        BT::Tree newTree = _factory.createTreeFromText(kTreeXml);
+        EXPECT_EQ(newTree.tickRoot(), BT::NodeStatus::SUCCESS);
+
+        ASSERT_EQ(_messages.size(), 3u);
+        EXPECT_EQ(_messages[0], "hello");
+        EXPECT_EQ(_messages[1], "hello");
+        EXPECT_EQ(_messages[2], "hello");
+    }
+
+    TEST_F(TreeInstancePoolTest, PooledTreesAreKeyedBySingleOwnerMode)
+    {
+        const AZ::Data::AssetId assetId(AZ::Uuid::CreateRandom(), 0);
+        BehaviorTree::Core::TreeInstancePool pool;
+
+        ASSERT_TRUE(pool.Release(assetId, _factory.createTreeFromText(kTreeXml)));
+        EXPECT_EQ(pool.GetPooledCount(assetId, false), 1u);
+        EXPECT_EQ(pool.GetPooledCount(assetId, true), 0u);
+
+        BT::Tree pooledTree;
+        EXPECT_FALSE(pool.Acquire(assetId, true, pooledTree));
+
+        // The subtree blackboard keeps the mode it inherited, so the tree can't be pooled as a single owner one.
+        BT::Tree tree = _factory.createTreeFromText(kTreeXml);
+        tree.rootBlackboard()->setSingleOwner(true);
+
+        EXPECT_FALSE(pool.Release(assetId, AZStd::move(tree)));
+        EXPECT_EQ(pool.GetPooledCount(assetId, true), 0u);
+    }
+
+    class AsyncNodeTest : public UnitTest::AllocatorsTestFixture
+    {
+    protected:
+        // Shared between the test and the work of a node, which runs until the gate is opened.
+        struct Gate
+        {
+            AZStd::atomic<bool> mOpen = false;
+            AZStd::atomic<bool> mDone = false;
+            AZStd::atomic<bool> mCancelRequested = false;
+        };
+
+        class GatedNode : public BehaviorTree::Core::AsyncNode
+        {
+        public:
+            AZ_RTTI(GatedNode, "{6A0C1E52-8F3B-4D7A-9E21-B54C0D8F7A13}", BehaviorTree::Core::AsyncNode);
+
+            GatedNode(
+                const std::string& name, const BehaviorTree::Core::BehaviorTreeNodeConfiguration& config, AZStd::shared_ptr<Gate> gate)
+                : AsyncNode(name, config)
+                , _gate(AZStd::move(gate))
+            {
+            }
+
+        protected:
+            Work CreateWork() override
+            {
+                return [gate = _gate](const AZStd::atomic<bool>& cancelRequested)
+                {
+                    while (!gate->mOpen)
+                    {
+                        AZStd::this_thread::yield();
+                    }
+
+                    gate->mCancelRequested = cancelRequested.load();
+                    gate->mDone = true;
+
+                    return BehaviorTree::Core::BehaviorTreeNodeStatus::SUCCESS;
+                };
+            }
+
+        private:
+            AZStd::shared_ptr<Gate> _gate;
+        };
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsTestFixture::SetUp();
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc desc;
+            desc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+
+            _jobManager = aznew AZ::JobManager(desc);
+            _jobContext = aznew AZ::JobContext(*_jobManager);
+            AZ::JobContext::SetGlobalContext(_jobContext);
+
+            _gate = AZStd::make_shared<Gate>();
+            _factory.registerBuilder<GatedNode>(
+                "Gated",
+                [gate = _gate](const std::string& name, const BT::NodeConfiguration& config)
+                {
+                    return std::make_unique<GatedNode>(name, config, gate);
+                });
+        }
+
+        void TearDown() override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete _jobContext;
+            delete _jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            UnitTest::AllocatorsTestFixture::TearDown();
+        }
+
+        AZ::JobManager* _jobManager = nullptr;
+        AZ::JobContext* _jobContext = nullptr;
+        AZStd::shared_ptr<Gate> _gate;
+        BT::BehaviorTreeFactory _factory;
+    };
+
+    TEST_F(AsyncNodeTest, HaltedNodeCanBeDestroyedWhileItsJobIsRunning)
+    {
+        {
+            BT::Tree tree = _factory.createTreeFromText(R"(
+                <root main_tree_to_execute="MainTree">
+                    <BehaviorTree ID="MainTree">
+                        <Gated />
+                    </BehaviorTree>
+                </root>)");
+
+            EXPECT_EQ(tree.tickRoot(), BT::NodeStatus::RUNNING);
+
+            tree.haltTree();
+        }
+
+        // The node is gone, the job may not even have started yet.
+        _gate->mOpen = true;
+
+        while (!_gate->mDone)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        EXPECT_TRUE(_gate->mCancelRequested);
+    }
+} // namespace SparkyStudios::AI::Behave::Tests
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
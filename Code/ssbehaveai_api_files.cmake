@@ -18,10 +18,16 @@ set(FILES
 
     Include/SparkyStudios/AI/Behave/BehaviorTree/Blackboard/Blackboard.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Blackboard/BlackboardProperty.h
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Blackboard/SharedBlackboard.h
 
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Core/AsyncNode.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Core/Factory.h
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Core/FlatTree.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Core/Node.h
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Core/NodeArena.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Core/Registry.h
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Core/TimerWheel.h
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Core/TreeInstancePool.h
 
     Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Animation/AnimGraphGetNamedParameterBoolNode.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Animation/AnimGraphGetNamedParameterFloatNode.h
@@ -55,13 +61,18 @@ set(FILES
     Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Animation/SimpleMotionSetPlayTimeNode.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Animation/SimpleMotionSetRetargetMotionNode.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Animation/SimpleMotionSetReverseMotionNode.h
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/CooldownNode.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/DebugMessageNode.h
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/GameDelayNode.h
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/GameTimeoutNode.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Common/WaitNode.h
     Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Navigation/NavigationFindPathToEntityNode.h
+    Include/SparkyStudios/AI/Behave/BehaviorTree/Nodes/Navigation/NavigationRaycastNode.h
 
     Include/SparkyStudios/AI/Behave/Navigation/NavigationArea.h
     Include/SparkyStudios/AI/Behave/Navigation/NavigationAgent.h
     Include/SparkyStudios/AI/Behave/Navigation/NavigationMeshBus.h
+    Include/SparkyStudios/AI/Behave/Navigation/NavigationMeshStatisticsBus.h
     Include/SparkyStudios/AI/Behave/Navigation/INavigationMesh.h
     Include/SparkyStudios/AI/Behave/Navigation/OffMeshConnection.h
 
@@ -26,6 +26,8 @@ set(FILES
 
     Source/Navigation/NavigationEditorSystemComponent.h
     Source/Navigation/NavigationEditorSystemComponent.cpp
+    Source/Navigation/NavigationMeshSettingsTuner.h
+    Source/Navigation/NavigationMeshSettingsTuner.cpp
 
     Source/Navigation/Components/DynamicNavigationMeshEditorComponent.h
     Source/Navigation/Components/DynamicNavigationMeshEditorComponent.cpp
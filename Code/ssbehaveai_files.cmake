@@ -21,10 +21,16 @@ set(FILES
 
     Source/BehaviorTree/Blackboard/Blackboard.cpp
     Source/BehaviorTree/Blackboard/BlackboardProperty.cpp
+    Source/BehaviorTree/Blackboard/SharedBlackboard.cpp
 
+    Source/BehaviorTree/Core/AsyncNode.cpp
     Source/BehaviorTree/Core/Factory.cpp
+    Source/BehaviorTree/Core/FlatTree.cpp
     Source/BehaviorTree/Core/Node.cpp
+    Source/BehaviorTree/Core/NodeArena.cpp
     Source/BehaviorTree/Core/Registry.cpp
+    Source/BehaviorTree/Core/TimerWheel.cpp
+    Source/BehaviorTree/Core/TreeInstancePool.cpp
 
     Source/BehaviorTree/Nodes/Animation/AnimGraphGetNamedParameterBoolNode.cpp
     Source/BehaviorTree/Nodes/Animation/AnimGraphGetNamedParameterFloatNode.cpp
@@ -56,9 +62,13 @@ set(FILES
     Source/BehaviorTree/Nodes/Animation/SimpleMotionSetPlayTimeNode.cpp
     Source/BehaviorTree/Nodes/Animation/SimpleMotionSetRetargetMotionNode.cpp
     Source/BehaviorTree/Nodes/Animation/SimpleMotionSetReverseMotionNode.cpp
+    Source/BehaviorTree/Nodes/Common/CooldownNode.cpp
     Source/BehaviorTree/Nodes/Common/DebugMessageNode.cpp
+    Source/BehaviorTree/Nodes/Common/GameDelayNode.cpp
+    Source/BehaviorTree/Nodes/Common/GameTimeoutNode.cpp
     Source/BehaviorTree/Nodes/Common/WaitNode.cpp
     Source/BehaviorTree/Nodes/Navigation/NavigationFindPathToEntityNode.cpp
+    Source/BehaviorTree/Nodes/Navigation/NavigationRaycastNode.cpp
 
     Source/BehaviorTree/BehaviorTreeComponent.h
     Source/BehaviorTree/BehaviorTreeComponent.cpp
@@ -76,6 +86,10 @@ set(FILES
     Source/Navigation/NavigationArea.cpp
     Source/Navigation/NavigationAreaProviderRequestBus.h
     Source/Navigation/NavigationAgentProviderRequestBus.h
+    Source/Navigation/NavigationMeshChangeTracker.h
+    Source/Navigation/NavigationMeshChangeTracker.cpp
+    Source/Navigation/NavigationMeshRegistry.h
+    Source/Navigation/NavigationMeshRegistry.cpp
     Source/Navigation/NavigationSystemComponent.h
     Source/Navigation/NavigationSystemComponent.cpp
     Source/Navigation/OffMeshConnection.cpp
@@ -87,13 +101,23 @@ set(FILES
     Source/Navigation/Components/WalkableComponent.h
     Source/Navigation/Components/WalkableComponent.cpp
 
+    Source/Navigation/Utils/RecastAreaConvexVolumes.h
+    Source/Navigation/Utils/RecastAreaConvexVolumes.cpp
+    Source/Navigation/Utils/RecastContext.h
+    Source/Navigation/Utils/RecastContext.cpp
     Source/Navigation/Utils/RecastMath.h
     Source/Navigation/Utils/RecastMath.cpp
     Source/Navigation/Utils/RecastSmartPointer.h
     Source/Navigation/Utils/RecastNavigationMesh.h
     Source/Navigation/Utils/RecastNavigationMesh.cpp
+    Source/Navigation/Utils/RecastPathCorridors.h
+    Source/Navigation/Utils/RecastPathCorridors.cpp
     Source/Navigation/Utils/RecastChunkedGeometry.h
     Source/Navigation/Utils/RecastChunkedGeometry.cpp
+    Source/Navigation/Utils/RecastTerrainHeightfield.h
+    Source/Navigation/Utils/RecastTerrainHeightfield.cpp
+    Source/Navigation/Utils/RecastTileStore.h
+    Source/Navigation/Utils/RecastTileStore.cpp
 
     # Recast Navigation SDK
     # ==============================
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <mutex>
 #include <sstream>
+#include <functional>
 
 #include "behaviortree_cpp_v3/basic_types.h"
 #include "behaviortree_cpp_v3/utils/safe_any.hpp"
@@ -27,7 +28,7 @@ class Blackboard
 
   protected:
     // This is intentionally protected. Use Blackboard::create instead
-    Blackboard(Blackboard::Ptr parent): parent_bb_(parent)
+    Blackboard(Blackboard::Ptr parent): parent_bb_(parent), single_owner_(parent && parent->single_owner_)
     {}
 
   public:
@@ -42,6 +43,25 @@ class Blackboard
 
     virtual ~Blackboard() = default;
 
+    struct Entry{
+
+        Any value;
+        const PortInfo port_info;
+
+        // Incremented each time the value is written. 0 until the first write.
+        uint64_t sequence_id = 0;
+
+        Entry( const PortInfo& info ):
+          port_info(info)
+        {}
+
+        Entry(Any&& other_any, const PortInfo& info):
+          value(std::move(other_any)),
+          port_info(info),
+          sequence_id(1)
+        {}
+    };
+
     /**
      * @brief The method getAny allow the user to access directly the type
      * erased value.
@@ -50,23 +70,33 @@ class Blackboard
      */
     const Any* getAny(const std::string& key) const
     {
-        std::unique_lock<std::mutex> lock(mutex_);
+        auto lock = lockStorage();
 
         if( auto parent = parent_bb_.lock())
         {
             auto remapping_it = internal_to_external_.find(key);
             if( remapping_it != internal_to_external_.end())
             {
-                return parent->getAny( remapping_it->second );
+                const Blackboard& parent_bb = *parent;
+                return parent_bb.getAny( remapping_it->second );
             }
         }
         auto it = storage_.find(key);
-        return ( it == storage_.end()) ? nullptr : &(it->second.value);
+        const Entry* entry = ( it == storage_.end()) ? nullptr : &(it->second);
+        if( !entry || entry->value.empty() )
+        {
+            // Entries declared by the ports are empty until written: they don't hide the shared ones.
+            if( const Entry* shared_entry = findSharedEntry(key) )
+            {
+                return &(shared_entry->value);
+            }
+        }
+        return entry ? &(entry->value) : nullptr;
     }
 
     Any* getAny(const std::string& key)
     {
-        std::unique_lock<std::mutex> lock(mutex_);
+        auto lock = lockStorage();
 
         if( auto parent = parent_bb_.lock())
         {
@@ -80,6 +110,87 @@ class Blackboard
         return ( it == storage_.end()) ? nullptr : &(it->second.value);
     }
 
+    /** Return the entry with the given key, following the subtree remappings, or
+     *  nullptr if it doesn't exist. Entries are never removed, except by clear().
+     */
+    Entry* getEntry(const std::string& key)
+    {
+        auto lock = lockStorage();
+
+        if( auto parent = parent_bb_.lock())
+        {
+            auto remapping_it = internal_to_external_.find(key);
+            if( remapping_it != internal_to_external_.end())
+            {
+                return parent->getEntry( remapping_it->second );
+            }
+        }
+        auto it = storage_.find(key);
+        return ( it == storage_.end()) ? nullptr : &(it->second);
+    }
+
+    /// Flag set in the sequence ids of the shared entries, so they never match the ones
+    /// of the local entries.
+    static constexpr uint64_t SHARED_SEQUENCE_ID_FLAG = uint64_t(1) << 63;
+
+    /** Return the sequence id of the value with the given key, or 0 if there is no value.
+     *  It changes each time the value is written, so it tells whether a value changed
+     *  since it was last read.
+     */
+    uint64_t getSequenceId(const std::string& key)
+    {
+        auto entry_lock = lockEntry();
+        return getSequenceId(key, getEntry(key));
+    }
+
+    /** Same as getSequenceId(key), with the local entry already found by getEntry(key),
+     *  or nullptr. The local value is used when it is set, then the shared one.
+     *  The entry lock is not taken.
+     */
+    uint64_t getSequenceId(const std::string& key, const Entry* entry) const
+    {
+        if( entry && !entry->value.empty() )
+        {
+            return entry->sequence_id;
+        }
+        if( const Entry* shared_entry = findSharedEntry(key) )
+        {
+            return shared_entry->sequence_id | SHARED_SEQUENCE_ID_FLAG;
+        }
+        return 0;
+    }
+
+    /** Function looking up the entries shared with other blackboards. The returned entry
+     *  is read only, and must stay valid until the end of the current tick.
+     */
+    using SharedEntryLookup = std::function<const Entry*(const std::string& key)>;
+
+    /** Set the lookup used to read the keys which are not remapped to the parent, and have
+     *  no value in this blackboard. Only the const getAny() and getSequenceId() use it, so
+     *  shared entries are never written through this blackboard: set() writes a local
+     *  value which hides the shared one. Blackboards created with this one as parent
+     *  use it as well. It must be set from the thread owning the blackboard.
+     */
+    void setSharedEntryLookup(SharedEntryLookup lookup)
+    {
+        auto lock = lockStorage();
+        shared_entry_lookup_ = std::move(lookup);
+    }
+
+    /// Return the shared entry with the given key, or nullptr if there is none.
+    const Entry* findSharedEntry(const std::string& key) const
+    {
+        if( shared_entry_lookup_ )
+        {
+            return shared_entry_lookup_(key);
+        }
+        if( auto parent = parent_bb_.lock())
+        {
+            return parent->findSharedEntry(key);
+        }
+        return nullptr;
+    }
+
     /** Return true if the entry with the given key was found.
      *  Note that this method may throw an exception if the cast to T failed.
      */
@@ -116,8 +227,8 @@ class Blackboard
     template <typename T>
     void set(const std::string& key, const T& value)
     {
-        std::unique_lock<std::mutex> lock_entry(entry_mutex_);
-        std::unique_lock<std::mutex> lock(mutex_);
+        auto lock_entry = lockEntry();
+        auto lock = lockStorage();
         auto it = storage_.find(key);
 
         if( auto parent = parent_bb_.lock())
@@ -173,6 +284,7 @@ class Blackboard
                 }
             }
             previous_any = std::move(temp);
+            it->second.sequence_id++;
         }
         else{ // create for the first time without any info
             storage_.emplace( key, Entry( Any(value), PortInfo() ) );
@@ -192,11 +304,43 @@ class Blackboard
 
     void clear()
     {
-        std::unique_lock<std::mutex> lock(mutex_);
+        auto lock = lockStorage();
         storage_.clear();
         internal_to_external_.clear();
     }
 
+    /** Empty the values of all the entries, keeping the entries, their port info and
+     *  the subtree remappings. Pointers to the entries stay valid. The values recorded
+     *  by saveInitialValues() are restored instead of being emptied.
+     */
+    void resetValues()
+    {
+        auto lock = lockStorage();
+        auto entry_lock = lockEntry();
+        for (auto& it : storage_)
+        {
+            const auto initial_it = initial_values_.find(it.first);
+            it.second.value = initial_it != initial_values_.end() ? initial_it->second : Any();
+            it.second.sequence_id++;
+        }
+    }
+
+    /** Record the current values as the ones restored by resetValues(), e.g. the
+     *  constant values given to the ports of a SubTreePlus when the tree is created.
+     */
+    void saveInitialValues()
+    {
+        auto lock = lockStorage();
+        initial_values_.clear();
+        for (const auto& it : storage_)
+        {
+            if (!it.second.value.empty())
+            {
+                initial_values_.emplace(it.first, it.second.value);
+            }
+        }
+    }
+
     // Lock this mutex before using get() and getAny() and unlock it while you have
     // done using the value.
     std::mutex& entryMutex()
@@ -204,28 +348,43 @@ class Blackboard
       return entry_mutex_;
     }
 
-  private:
-
-    struct Entry{
+    /** When the blackboard has a single owner, only the thread owning it reads and writes
+     *  its entries, and the mutexes are not locked. Blackboards created with this one as
+     *  parent inherit the mode. It must be set before the blackboard is shared.
+     */
+    void setSingleOwner(bool single_owner)
+    {
+      single_owner_ = single_owner;
+    }
 
-        Any value;
-        const PortInfo port_info;
+    bool isSingleOwner() const
+    {
+      return single_owner_;
+    }
 
-        Entry( const PortInfo& info ):
-          port_info(info)
-        {}
+    // Lock the entry mutex, unless the blackboard has a single owner.
+    std::unique_lock<std::mutex> lockEntry() const
+    {
+      return single_owner_ ? std::unique_lock<std::mutex>(entry_mutex_, std::defer_lock)
+                           : std::unique_lock<std::mutex>(entry_mutex_);
+    }
 
-        Entry(Any&& other_any, const PortInfo& info):
-          value(std::move(other_any)),
-          port_info(info)
-        {}
-    };
+  private:
 
     mutable std::mutex mutex_;
     mutable std::mutex entry_mutex_;
     std::unordered_map<std::string, Entry> storage_;
     std::weak_ptr<Blackboard> parent_bb_;
+    bool single_owner_ = false;
     std::unordered_map<std::string,std::string> internal_to_external_;
+    std::unordered_map<std::string, Any> initial_values_;
+    SharedEntryLookup shared_entry_lookup_;
+
+    std::unique_lock<std::mutex> lockStorage() const
+    {
+      return single_owner_ ? std::unique_lock<std::mutex>(mutex_, std::defer_lock)
+                           : std::unique_lock<std::mutex>(mutex_);
+    }
 
 };
 
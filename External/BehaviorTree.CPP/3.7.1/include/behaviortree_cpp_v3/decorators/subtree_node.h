@@ -2,6 +2,10 @@
 #define DECORATOR_SUBTREE_NODE_H
 
 #include "behaviortree_cpp_v3/decorator_node.h"
+#include "behaviortree_cpp_v3/blackboard.h"
+
+#include <functional>
+#include <vector>
 
 namespace BT
 {
@@ -101,6 +105,63 @@ private:
 
 
 
+
+/**
+ * @brief The LazySubtreeNode wraps a Subtree which is instantiated only the first
+ * time the node is ticked, instead of when the tree is created.
+ *
+ * It is created for <SubTree> and <SubTreePlus> elements with the attribute
+ * __lazy="true". The remapping rules of the element are applied when the Subtree
+ * is instantiated. Until then, the node only keeps a reference to the parsed XML.
+ *
+ * The attribute __release_after="seconds" tells how long the Subtree may stay idle
+ * before its owner calls release(). A negative value (default) keeps it forever.
+ *
+ * <SubTreePlus ID="CombatReaction" __lazy="true" __release_after="30" target="{enemy}" />
+ */
+class LazySubtreeNode : public DecoratorNode
+{
+public:
+  /// Creates the nodes and the blackboards of the Subtree. The first node is the root.
+  using Instantiator = std::function<void(std::vector<TreeNode::Ptr>& nodes,
+                                          std::vector<Blackboard::Ptr>& blackboards)>;
+
+  LazySubtreeNode(const std::string& name, const std::string& registration_ID,
+                  Instantiator instantiator, double release_after);
+
+  virtual ~LazySubtreeNode() override = default;
+
+  bool isInstantiated() const
+  {
+    return child_node_ != nullptr;
+  }
+
+  /// Instantiates the Subtree, if it is not already.
+  void instantiate();
+
+  /// Halts and destroys the Subtree. It is instantiated again on the next tick.
+  void release();
+
+  double releaseAfter() const
+  {
+    return release_after_;
+  }
+
+  virtual NodeType type() const override final
+  {
+    return NodeType::SUBTREE;
+  }
+
+private:
+  virtual BT::NodeStatus tick() override;
+
+  Instantiator instantiator_;
+  double release_after_;
+
+  std::vector<TreeNode::Ptr> nodes_;
+  std::vector<Blackboard::Ptr> blackboards_;
+};
+
 }
 
 #endif   // DECORATOR_SUBTREE_NODE_H
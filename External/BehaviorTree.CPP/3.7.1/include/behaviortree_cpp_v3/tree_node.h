@@ -223,8 +223,10 @@ inline Result TreeNode::getInput(const std::string& key, T& destination) const
                                            "but BB is invalid");
         }
 
-        std::unique_lock<std::mutex> entry_lock( config_.blackboard->entryMutex() );
-        const Any* val = config_.blackboard->getAny(static_cast<std::string>(remapped_key));
+        auto entry_lock = config_.blackboard->lockEntry();
+        // Read through the const blackboard, to also find the entries shared with other blackboards.
+        const Blackboard& blackboard = *config_.blackboard;
+        const Any* val = blackboard.getAny(static_cast<std::string>(remapped_key));
         if (val && val->empty() == false)
         {
             if (std::is_same<T, std::string>::value == false && val->type() == typeid(std::string))
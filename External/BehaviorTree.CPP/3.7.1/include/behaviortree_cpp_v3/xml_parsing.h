@@ -33,7 +33,8 @@ class XMLParser: public Parser
   private:
 
     struct Pimpl;
-    Pimpl* _p;
+    // Shared with the lazy Subtrees, which instantiate their nodes from the parsed documents.
+    std::shared_ptr<Pimpl> _p;
 
 };
 
@@ -4,7 +4,7 @@ namespace BT{
 
 void Blackboard::setPortInfo(std::string key, const PortInfo& info)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
+    auto lock = lockStorage();
 
     if( auto parent = parent_bb_.lock())
     {
@@ -33,7 +33,7 @@ void Blackboard::setPortInfo(std::string key, const PortInfo& info)
 
 const PortInfo* Blackboard::portInfo(const std::string &key)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
+    auto lock = lockStorage();
     auto it = storage_.find(key);
     if( it == storage_.end() )
     {
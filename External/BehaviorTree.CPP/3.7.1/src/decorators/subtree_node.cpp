@@ -35,3 +35,55 @@ BT::NodeStatus BT::SubtreePlusNode::tick()
     return child_node_->executeTick();
 }
 
+
+//--------------------------------
+BT::LazySubtreeNode::LazySubtreeNode(const std::string &name, const std::string &registration_ID,
+                                     Instantiator instantiator, double release_after) :
+    DecoratorNode(name, {} ),
+    instantiator_(std::move(instantiator)),
+    release_after_(release_after)
+{
+  setRegistrationID(registration_ID);
+}
+
+void BT::LazySubtreeNode::instantiate()
+{
+    if (child_node_)
+    {
+        return;
+    }
+
+    instantiator_(nodes_, blackboards_);
+
+    if (nodes_.empty())
+    {
+        throw RuntimeError("The Subtree [", name(), "] is empty");
+    }
+    setChild(nodes_.front().get());
+}
+
+void BT::LazySubtreeNode::release()
+{
+    if (!child_node_)
+    {
+        return;
+    }
+
+    haltChild();
+    child_node_ = nullptr;
+
+    nodes_.clear();
+    blackboards_.clear();
+}
+
+BT::NodeStatus BT::LazySubtreeNode::tick()
+{
+    instantiate();
+
+    NodeStatus prev_status = status();
+    if (prev_status == NodeStatus::IDLE)
+    {
+        setStatus(NodeStatus::RUNNING);
+    }
+    return child_node_->executeTick();
+}
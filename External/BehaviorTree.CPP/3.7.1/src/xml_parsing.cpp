@@ -46,13 +46,27 @@ auto StrEqual = [](const char* str1, const char* str2) -> bool {
     return strcmp(str1, str2) == 0;
 };
 
+// Attributes of the Subtree elements which are options of the parser, not remappings.
+auto IsLazySubtreeOption = [](const char* attr_name) -> bool {
+    return strcmp(attr_name, "__lazy") == 0 || strcmp(attr_name, "__release_after") == 0;
+};
+
 
-struct XMLParser::Pimpl
+struct XMLParser::Pimpl : public std::enable_shared_from_this<XMLParser::Pimpl>
 {
     TreeNode::Ptr createNodeFromXML(const XMLElement* element,
                                     const Blackboard::Ptr& blackboard,
                                     const TreeNode::Ptr& node_parent);
 
+    TreeNode::Ptr createLazySubtree(const XMLElement* element,
+                                    const std::string& instance_name,
+                                    const Blackboard::Ptr& blackboard);
+
+    Blackboard::Ptr createSubtreeBlackboard(const XMLElement* element,
+                                            const std::string& tree_ID,
+                                            const Blackboard::Ptr& blackboard,
+                                            std::vector<Blackboard::Ptr>& blackboard_stack);
+
     void recursivelyCreateTree(const std::string& tree_ID,
                                Tree& output_tree,
                                Blackboard::Ptr blackboard,
@@ -92,14 +106,11 @@ struct XMLParser::Pimpl
 #endif
 
 XMLParser::XMLParser(const BehaviorTreeFactory &factory) :
-  _p( new Pimpl(factory) )
+  _p( std::make_shared<Pimpl>(factory) )
 {
 }
 
-XMLParser::~XMLParser()
-{
-    delete _p;
-}
+XMLParser::~XMLParser() = default;
 
 void XMLParser::loadFromFile(const std::string& filename, bool add_includes)
 {
@@ -528,7 +539,14 @@ TreeNode::Ptr XMLParser::Pimpl::createNodeFromXML(const XMLElement *element,
     //---------------------------------------------
     TreeNode::Ptr child_node;
 
-    if( factory.builders().count(ID) != 0)
+    const bool is_subtree = element_name == "SubTree" || element_name == "SubTreePlus";
+    const char* attr_lazy = element->Attribute("__lazy");
+
+    if( is_subtree && attr_lazy && convertFromString<bool>(attr_lazy) )
+    {
+        child_node = createLazySubtree(element, instance_name, blackboard);
+    }
+    else if( factory.builders().count(ID) != 0)
     {
         const auto& manifest = factory.manifests().at(ID);
 
@@ -653,116 +671,164 @@ void BT::XMLParser::Pimpl::recursivelyCreateTree(const std::string& tree_ID,
         auto node = createNodeFromXML(element, blackboard, parent);
         output_tree.nodes.push_back(node);
 
-        if( node->type() == NodeType::SUBTREE )
+        if( dynamic_cast<const LazySubtreeNode*>(node.get()) )
+        {
+            // instantiated when ticked
+        }
+        else if( node->type() == NodeType::SUBTREE )
+        {
+            auto subtree_bb = createSubtreeBlackboard(element, node->name(), blackboard,
+                                                      output_tree.blackboard_stack);
+            recursivelyCreateTree( node->name(), output_tree, subtree_bb, node );
+        }
+        else
         {
-            if( dynamic_cast<const SubtreeNode*>(node.get()) )
+            for (auto child_element = element->FirstChildElement(); child_element;
+                 child_element = child_element->NextSiblingElement())
             {
-                bool is_isolated = true;
+                recursiveStep(node, child_element);
+            }
+        }
+    };
 
-                for (const XMLAttribute* attr = element->FirstAttribute(); attr != nullptr; attr = attr->Next())
-                {
-                    if( strcmp(attr->Name(), "__shared_blackboard") == 0  &&
-                        convertFromString<bool>(attr->Value()) == true )
-                    {
-                        is_isolated = false;
-                    }
-                }
+    auto it = tree_roots.find(tree_ID);
+    if( it == tree_roots.end() )
+    {
+        throw std::runtime_error(std::string("Can't find a tree with name: ") + tree_ID);
+    }
 
-                if( !is_isolated )
-                {
-                    recursivelyCreateTree( node->name(), output_tree, blackboard, node );
-                }
-                else{
-                    // Creating an isolated
-                    auto new_bb = Blackboard::create(blackboard);
+    auto root_element = it->second->FirstChildElement();
 
-                    for (const XMLAttribute* attr = element->FirstAttribute(); attr != nullptr; attr = attr->Next())
-                    {
-                        if( strcmp(attr->Name(), "ID") == 0 )
-                        {
-                            continue;
-                        }
-                        new_bb->addSubtreeRemapping( attr->Name(), attr->Value() );
-                    }
-                    output_tree.blackboard_stack.emplace_back(new_bb);
-                    recursivelyCreateTree( node->name(), output_tree, new_bb, node );
-                }
-            }
-            else if( dynamic_cast<const SubtreePlusNode*>(node.get()) )
-            {
-                auto new_bb = Blackboard::create(blackboard);
-                output_tree.blackboard_stack.emplace_back(new_bb);
-                std::set<StringView> mapped_keys;
+    // start recursion
+    recursiveStep(root_parent, root_element);
+}
 
-                bool do_autoremap = false;
+TreeNode::Ptr XMLParser::Pimpl::createLazySubtree(const XMLElement* element,
+                                                  const std::string& instance_name,
+                                                  const Blackboard::Ptr& blackboard)
+{
+    if( tree_roots.count(instance_name) == 0 )
+    {
+        throw RuntimeError("Can't find a tree with name: ", instance_name);
+    }
 
-                for (const XMLAttribute* attr = element->FirstAttribute(); attr != nullptr; attr = attr->Next())
-                {
-                    const char* attr_name = attr->Name();
-                    const char* attr_value = attr->Value();
+    double release_after = -1.0;
+    if( auto attr_release = element->Attribute("__release_after") )
+    {
+        release_after = convertFromString<double>(attr_release);
+    }
 
-                    if( StrEqual(attr_name, "ID") )
-                    {
-                        continue;
-                    }
-                    if( StrEqual(attr_name, "__autoremap") )
-                    {
-                        do_autoremap = convertFromString<bool>(attr_value);
-                        continue;
-                    }
+    // Keep the parsed documents alive as long as the node may instantiate the Subtree.
+    auto self = shared_from_this();
+    auto instantiator = [self, element, instance_name, blackboard](
+                            std::vector<TreeNode::Ptr>& nodes,
+                            std::vector<Blackboard::Ptr>& blackboards)
+    {
+        Tree subtree;
+        auto subtree_bb = self->createSubtreeBlackboard(element, instance_name, blackboard,
+                                                        subtree.blackboard_stack);
+        self->recursivelyCreateTree(instance_name, subtree, subtree_bb, TreeNode::Ptr());
 
-                    if( TreeNode::isBlackboardPointer(attr_value))
-                    {
-                        // do remapping
-                        StringView port_name = TreeNode::stripBlackboardPointer(attr_value);
-                        new_bb->addSubtreeRemapping( attr_name, port_name );
-                        mapped_keys.insert(attr_name);
-                    }
-                    else{
-                        // constant string: just set that constant value into the BB
-                        new_bb->set(attr_name, static_cast<std::string>(attr_value) );
-                        mapped_keys.insert(attr_name);
-                    }
-                }
+        nodes = std::move(subtree.nodes);
+        blackboards = std::move(subtree.blackboard_stack);
+    };
 
-                if( do_autoremap )
-                {
-                    std::vector<std::string> remapped_ports;
-                    auto new_root_element = tree_roots[node->name()]->FirstChildElement();
+    return std::make_unique<LazySubtreeNode>(instance_name, element->Name(),
+                                             std::move(instantiator), release_after);
+}
 
-                    getPortsRecursively( new_root_element, remapped_ports );
-                    for( const auto& port: remapped_ports)
-                    {
-                        if( mapped_keys.count(port) == 0)
-                        {
-                            new_bb->addSubtreeRemapping( port, port );
-                        }
-                    }
-                }
+Blackboard::Ptr XMLParser::Pimpl::createSubtreeBlackboard(const XMLElement* element,
+                                                          const std::string& tree_ID,
+                                                          const Blackboard::Ptr& blackboard,
+                                                          std::vector<Blackboard::Ptr>& blackboard_stack)
+{
+    if( StrEqual(element->Name(), "SubTreePlus") )
+    {
+        auto new_bb = Blackboard::create(blackboard);
+        blackboard_stack.emplace_back(new_bb);
+        std::set<StringView> mapped_keys;
+
+        bool do_autoremap = false;
 
-                recursivelyCreateTree( node->name(), output_tree, new_bb, node  );
+        for (const XMLAttribute* attr = element->FirstAttribute(); attr != nullptr; attr = attr->Next())
+        {
+            const char* attr_name = attr->Name();
+            const char* attr_value = attr->Value();
+
+            if( StrEqual(attr_name, "ID") || IsLazySubtreeOption(attr_name) )
+            {
+                continue;
+            }
+            if( StrEqual(attr_name, "__autoremap") )
+            {
+                do_autoremap = convertFromString<bool>(attr_value);
+                continue;
+            }
+
+            if( TreeNode::isBlackboardPointer(attr_value))
+            {
+                // do remapping
+                StringView port_name = TreeNode::stripBlackboardPointer(attr_value);
+                new_bb->addSubtreeRemapping( attr_name, port_name );
+                mapped_keys.insert(attr_name);
+            }
+            else{
+                // constant string: just set that constant value into the BB
+                new_bb->set(attr_name, static_cast<std::string>(attr_value) );
+                mapped_keys.insert(attr_name);
             }
         }
-        else
+
+        if( do_autoremap )
         {
-            for (auto child_element = element->FirstChildElement(); child_element;
-                 child_element = child_element->NextSiblingElement())
+            std::vector<std::string> remapped_ports;
+            auto new_root_element = tree_roots[tree_ID]->FirstChildElement();
+
+            getPortsRecursively( new_root_element, remapped_ports );
+            for( const auto& port: remapped_ports)
             {
-                recursiveStep(node, child_element);
+                if( mapped_keys.count(port) == 0)
+                {
+                    new_bb->addSubtreeRemapping( port, port );
+                }
             }
         }
-    };
 
-    auto it = tree_roots.find(tree_ID);
-    if( it == tree_roots.end() )
+        // The constant values are restored when the tree is reset to be reused.
+        new_bb->saveInitialValues();
+
+        return new_bb;
+    }
+
+    bool is_isolated = true;
+
+    for (const XMLAttribute* attr = element->FirstAttribute(); attr != nullptr; attr = attr->Next())
     {
-        throw std::runtime_error(std::string("Can't find a tree with name: ") + tree_ID);
+        if( strcmp(attr->Name(), "__shared_blackboard") == 0  &&
+            convertFromString<bool>(attr->Value()) == true )
+        {
+            is_isolated = false;
+        }
     }
 
-    auto root_element = it->second->FirstChildElement();
+    if( !is_isolated )
+    {
+        return blackboard;
+    }
 
-    // start recursion
-    recursiveStep(root_parent, root_element);
+    // Creating an isolated
+    auto new_bb = Blackboard::create(blackboard);
+
+    for (const XMLAttribute* attr = element->FirstAttribute(); attr != nullptr; attr = attr->Next())
+    {
+        if( strcmp(attr->Name(), "ID") == 0 || IsLazySubtreeOption(attr->Name()) )
+        {
+            continue;
+        }
+        new_bb->addSubtreeRemapping( attr->Name(), attr->Value() );
+    }
+    blackboard_stack.emplace_back(new_bb);
+    return new_bb;
 }
 
 void XMLParser::Pimpl::getPortsRecursively(const XMLElement *element,
@@ -246,6 +246,14 @@ void duDebugDrawNavMesh(duDebugDraw* dd, const dtNavMesh& mesh, unsigned char fl
 	}
 }
 
+void duDebugDrawNavMeshTile(struct duDebugDraw* dd, const dtNavMesh& mesh, const dtMeshTile* tile, unsigned char flags)
+{
+	if (!dd) return;
+	if (!tile || !tile->header) return;
+
+	drawMeshTile(dd, mesh, 0, tile, flags);
+}
+
 void duDebugDrawNavMeshWithClosedList(struct duDebugDraw* dd, const dtNavMesh& mesh, const dtNavMeshQuery& query, unsigned char flags)
 {
 	if (!dd) return;
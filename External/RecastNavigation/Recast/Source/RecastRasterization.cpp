@@ -23,6 +23,19 @@
 #include "RecastAlloc.h"
 #include "RecastAssert.h"
 
+// The batched rasterizer uses AVX2 when the compiler targets it, SSE2 on x86, and a scalar fallback otherwise.
+#if defined(RC_DISABLE_SIMD_RASTERIZATION)
+#define RC_RASTER_SIMD_WIDTH 1
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define RC_RASTER_SIMD_WIDTH 8
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RC_RASTER_SIMD_WIDTH 4
+#else
+#define RC_RASTER_SIMD_WIDTH 1
+#endif
+
 inline bool overlapBounds(const float* amin, const float* amax, const float* bmin, const float* bmax)
 {
 	bool overlap = true;
@@ -452,3 +465,421 @@ bool rcRasterizeTriangles(rcContext* ctx, const float* verts, const unsigned cha
 
 	return true;
 }
+
+// Same as addSpan(), but the new span reuses the node of the first span it is merged with,
+// so merging spans does not allocate a new node and free the merged ones.
+static bool addSpanMerged(rcHeightfield& hf, const int x, const int y,
+						  const unsigned short smin, const unsigned short smax,
+						  const unsigned char area, const int flagMergeThr)
+{
+	const int idx = x + y*hf.width;
+
+	// Store the span values the same way they are stored in a span node.
+	rcSpan s;
+	s.smin = smin;
+	s.smax = smax;
+	s.area = area;
+
+	rcSpan* prev = 0;
+	rcSpan* cur = hf.spans[idx];
+
+	// Skip the spans below the new span.
+	while (cur && cur->smax < s.smin)
+	{
+		prev = cur;
+		cur = cur->next;
+	}
+
+	rcSpan* node = 0;
+
+	// Merge the overlapping spans into the new span.
+	while (cur && cur->smin <= s.smax)
+	{
+		if (cur->smin < s.smin)
+			s.smin = cur->smin;
+		if (cur->smax > s.smax)
+			s.smax = cur->smax;
+
+		if (rcAbs((int)s.smax - (int)cur->smax) <= flagMergeThr)
+			s.area = rcMax(s.area, cur->area);
+
+		rcSpan* next = cur->next;
+		if (node)
+			freeSpan(hf, cur);
+		else
+			node = cur;
+		cur = next;
+	}
+
+	if (!node)
+	{
+		node = allocSpan(hf);
+		if (!node)
+			return false;
+
+		if (prev)
+			prev->next = node;
+		else
+			hf.spans[idx] = node;
+	}
+
+	node->smin = s.smin;
+	node->smax = s.smax;
+	node->area = s.area;
+	node->next = cur;
+
+	return true;
+}
+
+// Snaps the span ranges of the cells [0, n) of a row to the heightfield height grid.
+// The cells are skipped (valid[i] = 0) when outside of the heightfield bbox, the same way rasterizeTri() does.
+static void snapSpans(const float* cellMin, const float* cellMax, unsigned char* valid,
+					  unsigned short* smins, unsigned short* smaxs, const int n,
+					  const float bminY, const float by, const float ich)
+{
+	int i = 0;
+
+#if RC_RASTER_SIMD_WIDTH == 8
+	const __m256 vbminY = _mm256_set1_ps(bminY);
+	const __m256 vby = _mm256_set1_ps(by);
+	const __m256 vich = _mm256_set1_ps(ich);
+	const __m256 vzero = _mm256_setzero_ps();
+	const __m256i vone = _mm256_set1_epi32(1);
+	const __m256i vmaxHeight = _mm256_set1_epi32(RC_SPAN_MAX_HEIGHT);
+
+	for (; i + 8 <= n; i += 8)
+	{
+		const __m256 smin = _mm256_sub_ps(_mm256_loadu_ps(cellMin + i), vbminY);
+		const __m256 smax = _mm256_sub_ps(_mm256_loadu_ps(cellMax + i), vbminY);
+
+		// Skip the span if it is outside the heightfield bbox.
+		const __m256 outside = _mm256_or_ps(_mm256_cmp_ps(smax, vzero, _CMP_LT_OQ), _mm256_cmp_ps(smin, vby, _CMP_GT_OQ));
+		const int outsideMask = _mm256_movemask_ps(outside);
+
+		// Clamp the span to the heightfield bbox. Values are positive, so floor is a truncation.
+		const __m256 cmin = _mm256_mul_ps(_mm256_blendv_ps(smin, vzero, _mm256_cmp_ps(smin, vzero, _CMP_LT_OQ)), vich);
+		const __m256 cmax = _mm256_mul_ps(_mm256_blendv_ps(smax, vby, _mm256_cmp_ps(smax, vby, _CMP_GT_OQ)), vich);
+
+		__m256i imin = _mm256_cvttps_epi32(cmin);
+		imin = _mm256_min_epi32(imin, vmaxHeight);
+
+		__m256i imax = _mm256_cvttps_epi32(cmax);
+		imax = _mm256_add_epi32(imax, _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(_mm256_cvtepi32_ps(imax), cmax, _CMP_LT_OQ)), vone));
+
+		// Same order than rcClamp(), the lower limit wins over the upper one.
+		const __m256i iminPlusOne = _mm256_add_epi32(imin, vone);
+		const __m256i below = _mm256_cmpgt_epi32(iminPlusOne, imax);
+		imax = _mm256_blendv_epi8(_mm256_min_epi32(imax, vmaxHeight), iminPlusOne, below);
+
+		int mins[8], maxs[8];
+		_mm256_storeu_si256((__m256i*)mins, imin);
+		_mm256_storeu_si256((__m256i*)maxs, imax);
+
+		for (int j = 0; j < 8; ++j)
+		{
+			if (outsideMask & (1 << j))
+				valid[i + j] = 0;
+			smins[i + j] = (unsigned short)mins[j];
+			smaxs[i + j] = (unsigned short)maxs[j];
+		}
+	}
+#elif RC_RASTER_SIMD_WIDTH == 4
+	const __m128 vbminY = _mm_set1_ps(bminY);
+	const __m128 vby = _mm_set1_ps(by);
+	const __m128 vich = _mm_set1_ps(ich);
+	const __m128 vzero = _mm_setzero_ps();
+	const __m128i vone = _mm_set1_epi32(1);
+	const __m128i vmaxHeight = _mm_set1_epi32(RC_SPAN_MAX_HEIGHT);
+
+	for (; i + 4 <= n; i += 4)
+	{
+		const __m128 smin = _mm_sub_ps(_mm_loadu_ps(cellMin + i), vbminY);
+		const __m128 smax = _mm_sub_ps(_mm_loadu_ps(cellMax + i), vbminY);
+
+		// Skip the span if it is outside the heightfield bbox.
+		const int outsideMask = _mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(smax, vzero), _mm_cmpgt_ps(smin, vby)));
+
+		// Clamp the span to the heightfield bbox. Values are positive, so floor is a truncation.
+		const __m128 minBelow = _mm_cmplt_ps(smin, vzero);
+		const __m128 maxAbove = _mm_cmpgt_ps(smax, vby);
+		const __m128 cmin = _mm_mul_ps(_mm_andnot_ps(minBelow, smin), vich);
+		const __m128 cmax = _mm_mul_ps(_mm_or_ps(_mm_and_ps(maxAbove, vby), _mm_andnot_ps(maxAbove, smax)), vich);
+
+		__m128i imin = _mm_cvttps_epi32(cmin);
+		__m128i above = _mm_cmpgt_epi32(imin, vmaxHeight);
+		imin = _mm_or_si128(_mm_and_si128(above, vmaxHeight), _mm_andnot_si128(above, imin));
+
+		__m128i imax = _mm_cvttps_epi32(cmax);
+		imax = _mm_add_epi32(imax, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(_mm_cvtepi32_ps(imax), cmax)), vone));
+
+		// Same order than rcClamp(), the lower limit wins over the upper one.
+		const __m128i iminPlusOne = _mm_add_epi32(imin, vone);
+		const __m128i below = _mm_cmpgt_epi32(iminPlusOne, imax);
+		above = _mm_cmpgt_epi32(imax, vmaxHeight);
+		imax = _mm_or_si128(_mm_and_si128(above, vmaxHeight), _mm_andnot_si128(above, imax));
+		imax = _mm_or_si128(_mm_and_si128(below, iminPlusOne), _mm_andnot_si128(below, imax));
+
+		int mins[4], maxs[4];
+		_mm_storeu_si128((__m128i*)mins, imin);
+		_mm_storeu_si128((__m128i*)maxs, imax);
+
+		for (int j = 0; j < 4; ++j)
+		{
+			if (outsideMask & (1 << j))
+				valid[i + j] = 0;
+			smins[i + j] = (unsigned short)mins[j];
+			smaxs[i + j] = (unsigned short)maxs[j];
+		}
+	}
+#endif
+
+	for (; i < n; ++i)
+	{
+		float smin = cellMin[i] - bminY;
+		float smax = cellMax[i] - bminY;
+		if (smax < 0.0f || smin > by)
+		{
+			valid[i] = 0;
+			continue;
+		}
+		if (smin < 0.0f) smin = 0;
+		if (smax > by) smax = by;
+
+		smins[i] = (unsigned short)rcClamp((int)floorf(smin * ich), 0, RC_SPAN_MAX_HEIGHT);
+		smaxs[i] = (unsigned short)rcClamp((int)ceilf(smax * ich), (int)smins[i]+1, RC_SPAN_MAX_HEIGHT);
+	}
+}
+
+// Working buffers of the batched rasterizer, holding the span ranges of a heightfield row.
+struct rcRasterRowBuffers
+{
+	float* cellMin;
+	float* cellMax;
+	unsigned short* smin;
+	unsigned short* smax;
+	unsigned char* valid;
+};
+
+// Same as rasterizeTri(), but the spans of each row are computed first, then snapped all at once and added.
+static bool rasterizeTriBatch(const float* v0, const float* v1, const float* v2,
+							  const unsigned char area, rcHeightfield& hf,
+							  const float* bmin, const float* bmax,
+							  const float cs, const float ics, const float ich,
+							  const int flagMergeThr, rcRasterRowBuffers& row)
+{
+	const int w = hf.width;
+	const int h = hf.height;
+	float tmin[3], tmax[3];
+	const float by = bmax[1] - bmin[1];
+
+	rcVcopy(tmin, v0);
+	rcVcopy(tmax, v0);
+	rcVmin(tmin, v1);
+	rcVmin(tmin, v2);
+	rcVmax(tmax, v1);
+	rcVmax(tmax, v2);
+
+	// Calculate the footprint of the triangle on the grid's y-axis
+	int y0 = (int)((tmin[2] - bmin[2])*ics);
+	int y1 = (int)((tmax[2] - bmin[2])*ics);
+	y0 = rcClamp(y0, 0, h-1);
+	y1 = rcClamp(y1, 0, h-1);
+
+	float buf[7*3*4];
+	float *in = buf, *inrow = buf+7*3, *p1 = inrow+7*3, *p2 = p1+7*3;
+
+	rcVcopy(&in[0], v0);
+	rcVcopy(&in[1*3], v1);
+	rcVcopy(&in[2*3], v2);
+	int nvrow, nvIn = 3;
+
+	for (int y = y0; y <= y1; ++y)
+	{
+		// Clip polygon to row. Store the remaining polygon as well
+		const float cz = bmin[2] + y*cs;
+		dividePoly(in, nvIn, inrow, &nvrow, p1, &nvIn, cz+cs, 2);
+		rcSwap(in, p1);
+		if (nvrow < 3) continue;
+
+		// find the horizontal bounds in the row
+		float minX = inrow[0], maxX = inrow[0];
+		for (int i=1; i<nvrow; ++i)
+		{
+			if (minX > inrow[i*3])	minX = inrow[i*3];
+			if (maxX < inrow[i*3])	maxX = inrow[i*3];
+		}
+		int x0 = (int)((minX - bmin[0])*ics);
+		int x1 = (int)((maxX - bmin[0])*ics);
+		x0 = rcClamp(x0, 0, w-1);
+		x1 = rcClamp(x1, 0, w-1);
+
+		int nv, nv2 = nvrow;
+		const int n = x1 - x0 + 1;
+
+		// Clip the polygon to each column of the row, and keep the vertical range of each cell.
+		for (int x = x0; x <= x1; ++x)
+		{
+			const float cx = bmin[0] + x*cs;
+			dividePoly(inrow, nv2, p1, &nv, p2, &nv2, cx+cs, 0);
+			rcSwap(inrow, p2);
+
+			const int i = x - x0;
+			if (nv < 3)
+			{
+				row.valid[i] = 0;
+				row.cellMin[i] = 0.0f;
+				row.cellMax[i] = 0.0f;
+				continue;
+			}
+
+			float smin = p1[1], smax = p1[1];
+			for (int j = 1; j < nv; ++j)
+			{
+				smin = rcMin(smin, p1[j*3+1]);
+				smax = rcMax(smax, p1[j*3+1]);
+			}
+
+			row.valid[i] = 1;
+			row.cellMin[i] = smin;
+			row.cellMax[i] = smax;
+		}
+
+		snapSpans(row.cellMin, row.cellMax, row.valid, row.smin, row.smax, n, bmin[1], by, ich);
+
+		for (int i = 0; i < n; ++i)
+		{
+			if (!row.valid[i])
+				continue;
+
+			if (!addSpanMerged(hf, x0 + i, y, row.smin[i], row.smax[i], area, flagMergeThr))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// Computes the mask of the triangles [first, first + count) overlapping the heightfield bbox.
+static unsigned int overlapTriangles(const float* verts, const int* tris, const int first, const int count,
+									 const float* bmin, const float* bmax)
+{
+	unsigned int mask = 0;
+	int i = 0;
+
+#if RC_RASTER_SIMD_WIDTH > 1
+	const int W = RC_RASTER_SIMD_WIDTH;
+	for (; i + W <= count; i += W)
+	{
+		float tmin[3][W], tmax[3][W];
+		for (int j = 0; j < W; ++j)
+		{
+			const int* t = &tris[(first+i+j)*3];
+			for (int k = 0; k < 3; ++k)
+			{
+				const float a = verts[t[0]*3+k], b = verts[t[1]*3+k], c = verts[t[2]*3+k];
+				tmin[k][j] = rcMin(rcMin(a, b), c);
+				tmax[k][j] = rcMax(rcMax(a, b), c);
+			}
+		}
+
+#if RC_RASTER_SIMD_WIDTH == 8
+		__m256 outside = _mm256_setzero_ps();
+		for (int k = 0; k < 3; ++k)
+		{
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_set1_ps(bmin[k]), _mm256_loadu_ps(tmax[k]), _CMP_GT_OQ));
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_set1_ps(bmax[k]), _mm256_loadu_ps(tmin[k]), _CMP_LT_OQ));
+		}
+		mask |= (unsigned int)(~_mm256_movemask_ps(outside) & 0xFF) << i;
+#else
+		__m128 outside = _mm_setzero_ps();
+		for (int k = 0; k < 3; ++k)
+		{
+			outside = _mm_or_ps(outside, _mm_cmpgt_ps(_mm_set1_ps(bmin[k]), _mm_loadu_ps(tmax[k])));
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_set1_ps(bmax[k]), _mm_loadu_ps(tmin[k])));
+		}
+		mask |= (unsigned int)(~_mm_movemask_ps(outside) & 0xF) << i;
+#endif
+	}
+#endif
+
+	for (; i < count; ++i)
+	{
+		const int* t = &tris[(first+i)*3];
+		float tmin[3], tmax[3];
+		rcVcopy(tmin, &verts[t[0]*3]);
+		rcVcopy(tmax, &verts[t[0]*3]);
+		rcVmin(tmin, &verts[t[1]*3]);
+		rcVmin(tmin, &verts[t[2]*3]);
+		rcVmax(tmax, &verts[t[1]*3]);
+		rcVmax(tmax, &verts[t[2]*3]);
+		if (overlapBounds(bmin, bmax, tmin, tmax))
+			mask |= 1u << i;
+	}
+
+	return mask;
+}
+
+/// @par
+///
+/// Produces the same heightfield than rcRasterizeTriangles(). Triangles are culled against
+/// the heightfield bounds by batches, the spans of each row are snapped to the height grid
+/// at once, and merged spans reuse their nodes instead of going through the span allocator.
+///
+/// @see rcHeightfield
+bool rcRasterizeTrianglesBatch(rcContext* ctx, const float* verts, const int /*nv*/,
+							   const int* tris, const unsigned char* areas, const int nt,
+							   rcHeightfield& solid, const int flagMergeThr)
+{
+	rcAssert(ctx);
+
+	rcScopedTimer timer(ctx, RC_TIMER_RASTERIZE_TRIANGLES);
+
+	const float ics = 1.0f/solid.cs;
+	const float ich = 1.0f/solid.ch;
+
+	// Row buffers are padded to be read by full SIMD batches.
+	const int rowSize = solid.width + RC_RASTER_SIMD_WIDTH;
+	unsigned char* mem = (unsigned char*)rcAlloc(rowSize*(sizeof(float)*2 + sizeof(unsigned short)*2 + 1), RC_ALLOC_TEMP);
+	if (!mem)
+	{
+		ctx->log(RC_LOG_ERROR, "rcRasterizeTrianglesBatch: Out of memory 'rows' (%d).", rowSize);
+		return false;
+	}
+
+	rcRasterRowBuffers row;
+	row.cellMin = (float*)mem;
+	row.cellMax = row.cellMin + rowSize;
+	row.smin = (unsigned short*)(row.cellMax + rowSize);
+	row.smax = row.smin + rowSize;
+	row.valid = (unsigned char*)(row.smax + rowSize);
+
+	static const int BATCH_SIZE = 32;
+	bool ok = true;
+
+	for (int first = 0; first < nt && ok; first += BATCH_SIZE)
+	{
+		const int count = rcMin(BATCH_SIZE, nt - first);
+		unsigned int mask = overlapTriangles(verts, tris, first, count, solid.bmin, solid.bmax);
+
+		for (int i = 0; mask != 0; ++i, mask >>= 1)
+		{
+			if (!(mask & 1))
+				continue;
+
+			const int t = first + i;
+			const float* v0 = &verts[tris[t*3+0]*3];
+			const float* v1 = &verts[tris[t*3+1]*3];
+			const float* v2 = &verts[tris[t*3+2]*3];
+			if (!rasterizeTriBatch(v0, v1, v2, areas[t], solid, solid.bmin, solid.bmax, solid.cs, ics, ich, flagMergeThr, row))
+			{
+				ctx->log(RC_LOG_ERROR, "rcRasterizeTrianglesBatch: Out of memory.");
+				ok = false;
+				break;
+			}
+		}
+	}
+
+	rcFree(mem);
+
+	return ok;
+}